@@ -45,6 +45,19 @@
  *
  *   // Draw the player using the body's position
  *   RGL_DrawBillboard(player_sprite, player_body.position, ...);
+ *
+ * @section batch_example Batches
+ *   Crowds, debris and other large groups belong in a DynamoBodyBatch. It stores each field
+ *   as its own array, so Dynamo_UpdateBatch3D integrates 4 (SSE2/NEON) or 8 (AVX2) bodies
+ *   per instruction. Each body takes the same step Dynamo_Update3D would give it.
+ *
+ *   DynamoBodyBatch crowd;
+ *   Dynamo_InitBatch(&crowd, 4096);
+ *   Dynamo_AddBodyToBatch(&crowd, &npc_body);
+ *   ...
+ *   Dynamo_UpdateBatch3D(&crowd, crowd.count, delta_time);
+ *   // Fill ground_y[i] / ground_normal[i] from RGL_GetGroundAt (-FLT_MAX where there is no ground)
+ *   Dynamo_ResolveGroundBatch(&crowd, crowd.count, ground_y, ground_normal);
  */
 #ifndef DYNAMO_H
 #define DYNAMO_H
@@ -55,6 +68,24 @@
 // --- Configuration ---
 #define DYNAMO_GRAVITY_3D ((vec3){0.0f, -9.81f, 0.0f}) // World units (meters) per second^2
 #define DYNAMO_GRAVITY_2D ((vec2){0.0f, -9.81f})       // For 2D side-scrollers
+// Define DYNAMO_NO_SIMD to force the scalar batch kernel (e.g. to compare results).
+
+// --- SIMD Selection (batch kernel only) ---
+#if !defined(DYNAMO_NO_SIMD) && defined(__AVX2__)
+    #include <immintrin.h>
+    #define DYNAMO_SIMD_AVX2 1
+    #define DYNAMO_SIMD_WIDTH 8
+#elif !defined(DYNAMO_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define DYNAMO_SIMD_SSE2 1
+    #define DYNAMO_SIMD_WIDTH 4
+#elif !defined(DYNAMO_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #include <arm_neon.h>
+    #define DYNAMO_SIMD_NEON 1
+    #define DYNAMO_SIMD_WIDTH 4
+#else
+    #define DYNAMO_SIMD_WIDTH 1
+#endif
 
 // --- Public Types and Structs ---
 
@@ -75,6 +106,28 @@ typedef struct {
 
 } DynamoBody;
 
+/**
+ * @brief Many bodies stored structure-of-arrays for the batch integrator.
+ * Every array has `capacity` entries and lives in one allocation owned by the batch.
+ * Mass is kept as its inverse: 0 marks a static body, exactly as mass 0 does in DynamoBody.
+ */
+typedef struct {
+    float* position_x;
+    float* position_y;
+    float* position_z;
+    float* velocity_x;
+    float* velocity_y;
+    float* velocity_z;
+    float* acceleration_x;
+    float* acceleration_y;
+    float* acceleration_z;
+    float* inverse_mass;
+    float* bounciness;
+    float* drag;
+    int count;
+    int capacity;
+} DynamoBodyBatch;
+
 
 // --- API Function Declarations ---
 
@@ -126,6 +179,55 @@ SITAPI void Dynamo_Update2D(DynamoBody* body, float delta_time);
  */
 SITAPI void Dynamo_ResolveCollision(DynamoBody* body, float contact_y, vec3 surface_normal);
 
+/**
+ * @brief Allocates an empty batch able to hold `capacity` bodies.
+ * @return false if the allocation failed (the batch is left empty).
+ */
+SITAPI bool Dynamo_InitBatch(DynamoBodyBatch* batch, int capacity);
+
+/**
+ * @brief Frees a batch's arrays and zeroes it.
+ */
+SITAPI void Dynamo_FreeBatch(DynamoBodyBatch* batch);
+
+/**
+ * @brief Copies a body into the next free slot of a batch, growing it if needed.
+ * @return The body's index in the batch, or -1 if the batch could not grow.
+ */
+SITAPI int Dynamo_AddBodyToBatch(DynamoBodyBatch* batch, const DynamoBody* body);
+
+/**
+ * @brief Removes a body by moving the last body into its slot. Indices of other bodies may change.
+ */
+SITAPI void Dynamo_RemoveBodyFromBatch(DynamoBodyBatch* batch, int index);
+
+/**
+ * @brief Reads one body of a batch back into a DynamoBody.
+ */
+SITAPI void Dynamo_GetBodyFromBatch(const DynamoBodyBatch* batch, int index, DynamoBody* out_body);
+
+/**
+ * @brief Writes a DynamoBody into an existing slot of a batch.
+ */
+SITAPI void Dynamo_SetBodyInBatch(DynamoBodyBatch* batch, int index, const DynamoBody* body);
+
+/**
+ * @brief Updates the first `count` bodies of a batch with the same step as Dynamo_Update3D, several at a time.
+ * Static bodies (inverse mass 0) are left untouched.
+ * @param batch The batch to update.
+ * @param count How many bodies to update, from index 0 (clamped to batch->count).
+ * @param delta_time The time elapsed since the last frame.
+ */
+SITAPI void Dynamo_UpdateBatch3D(DynamoBodyBatch* batch, int count, float delta_time);
+
+/**
+ * @brief Resolves ground contact for the first `count` bodies, as Dynamo_ResolveCollision does.
+ * Only bodies below their ground height are touched, so this is a cheap pass after the update.
+ * @param ground_y Ground height under each body (e.g. RGLGroundInfo.ground_y); -FLT_MAX where there is none.
+ * @param ground_normal Surface normal under each body (e.g. RGLGroundInfo.surface_normal).
+ */
+SITAPI void Dynamo_ResolveGroundBatch(DynamoBodyBatch* batch, int count, const float* ground_y, const vec3* ground_normal);
+
 
 // ===================================================================================
 // --- IMPLEMENTATION ---
@@ -133,6 +235,7 @@ SITAPI void Dynamo_ResolveCollision(DynamoBody* body, float contact_y, vec3 surf
 #ifdef DYNAMO_IMPLEMENTATION
 
 #include <string.h> // For memset
+#include <stdlib.h> // For malloc/free (batches)
 
 SITAPI void Dynamo_InitBody(DynamoBody* body, vec3 position, float mass, float bounciness, float drag) {
     if (!body) return;
@@ -223,5 +326,209 @@ SITAPI void Dynamo_ResolveCollision(DynamoBody* body, float contact_y, vec3 surf
     }
 }
 
+// --- Body Batches ---
+
+#define DYNAMO_BATCH_ARRAY_COUNT 12 // float arrays in a DynamoBodyBatch, in declaration order
+
+static void _Dynamo_GetBatchArrays(DynamoBodyBatch* batch, float** out_arrays[DYNAMO_BATCH_ARRAY_COUNT]) {
+    float** arrays[DYNAMO_BATCH_ARRAY_COUNT] = {
+        &batch->position_x, &batch->position_y, &batch->position_z,
+        &batch->velocity_x, &batch->velocity_y, &batch->velocity_z,
+        &batch->acceleration_x, &batch->acceleration_y, &batch->acceleration_z,
+        &batch->inverse_mass, &batch->bounciness, &batch->drag
+    };
+    memcpy(out_arrays, arrays, sizeof(arrays));
+}
+
+static bool _Dynamo_ReserveBatch(DynamoBodyBatch* batch, int capacity) {
+    if (capacity <= batch->capacity) return true;
+
+    // One block for all twelve arrays; each array starts on a 32-byte boundary of the block.
+    size_t stride = ((size_t)capacity + 7) & ~(size_t)7;
+    float* block = (float*)malloc(sizeof(float) * stride * DYNAMO_BATCH_ARRAY_COUNT);
+    if (!block) return false;
+
+    float** arrays[DYNAMO_BATCH_ARRAY_COUNT];
+    _Dynamo_GetBatchArrays(batch, arrays);
+    float* old_block = batch->position_x; // position_x always owns the block
+    for (int i = 0; i < DYNAMO_BATCH_ARRAY_COUNT; i++) {
+        float* dst = block + stride * i;
+        if (batch->count > 0) memcpy(dst, *arrays[i], sizeof(float) * batch->count);
+        *arrays[i] = dst;
+    }
+    free(old_block);
+    batch->capacity = capacity;
+    return true;
+}
+
+SITAPI bool Dynamo_InitBatch(DynamoBodyBatch* batch, int capacity) {
+    if (!batch) return false;
+    memset(batch, 0, sizeof(DynamoBodyBatch));
+    return _Dynamo_ReserveBatch(batch, capacity > 0 ? capacity : 64);
+}
+
+SITAPI void Dynamo_FreeBatch(DynamoBodyBatch* batch) {
+    if (!batch) return;
+    free(batch->position_x);
+    memset(batch, 0, sizeof(DynamoBodyBatch));
+}
+
+SITAPI int Dynamo_AddBodyToBatch(DynamoBodyBatch* batch, const DynamoBody* body) {
+    if (!batch || !body) return -1;
+    if (batch->count == batch->capacity) {
+        int new_capacity = batch->capacity > 0 ? batch->capacity * 2 : 64;
+        if (!_Dynamo_ReserveBatch(batch, new_capacity)) return -1;
+    }
+    int index = batch->count++;
+    Dynamo_SetBodyInBatch(batch, index, body);
+    return index;
+}
+
+SITAPI void Dynamo_RemoveBodyFromBatch(DynamoBodyBatch* batch, int index) {
+    if (!batch || index < 0 || index >= batch->count) return;
+    int last = --batch->count;
+    if (index == last) return;
+    float** arrays[DYNAMO_BATCH_ARRAY_COUNT];
+    _Dynamo_GetBatchArrays(batch, arrays);
+    for (int i = 0; i < DYNAMO_BATCH_ARRAY_COUNT; i++) (*arrays[i])[index] = (*arrays[i])[last];
+}
+
+SITAPI void Dynamo_GetBodyFromBatch(const DynamoBodyBatch* batch, int index, DynamoBody* out_body) {
+    if (!batch || !out_body || index < 0 || index >= batch->count) return;
+    out_body->position[0] = batch->position_x[index];
+    out_body->position[1] = batch->position_y[index];
+    out_body->position[2] = batch->position_z[index];
+    out_body->velocity[0] = batch->velocity_x[index];
+    out_body->velocity[1] = batch->velocity_y[index];
+    out_body->velocity[2] = batch->velocity_z[index];
+    out_body->acceleration[0] = batch->acceleration_x[index];
+    out_body->acceleration[1] = batch->acceleration_y[index];
+    out_body->acceleration[2] = batch->acceleration_z[index];
+    out_body->mass = (batch->inverse_mass[index] > 0.0f) ? 1.0f / batch->inverse_mass[index] : 0.0f;
+    out_body->bounciness = batch->bounciness[index];
+    out_body->drag = batch->drag[index];
+}
+
+SITAPI void Dynamo_SetBodyInBatch(DynamoBodyBatch* batch, int index, const DynamoBody* body) {
+    if (!batch || !body || index < 0 || index >= batch->count) return;
+    batch->position_x[index] = body->position[0];
+    batch->position_y[index] = body->position[1];
+    batch->position_z[index] = body->position[2];
+    batch->velocity_x[index] = body->velocity[0];
+    batch->velocity_y[index] = body->velocity[1];
+    batch->velocity_z[index] = body->velocity[2];
+    batch->acceleration_x[index] = body->acceleration[0];
+    batch->acceleration_y[index] = body->acceleration[1];
+    batch->acceleration_z[index] = body->acceleration[2];
+    batch->inverse_mass[index] = (body->mass > 0.0f) ? 1.0f / body->mass : 0.0f;
+    batch->bounciness[index] = body->bounciness;
+    batch->drag[index] = body->drag;
+}
+
+// One axis of the Dynamo_Update3D step for a single body, in the same float operation order:
+// a = (a + g) + (v * -drag) * (1/m);  v += a * dt;  p += v * dt;  a = 0.
+static inline void _Dynamo_IntegrateAxis(float* p, float* v, float* a, float gravity, float neg_drag, float inv_mass, float dt) {
+    float accel = (*a + gravity) + (*v * neg_drag) * inv_mass;
+    *v += accel * dt;
+    *p += *v * dt;
+    *a = 0.0f;
+}
+
+// --- SIMD lane helpers: one set per instruction set, same names ---
+#if defined(DYNAMO_SIMD_AVX2)
+typedef __m256 _dynamo_vf;
+#define _dyn_load(p)          _mm256_loadu_ps(p)
+#define _dyn_store(p, v)      _mm256_storeu_ps(p, v)
+#define _dyn_set1(x)          _mm256_set1_ps(x)
+#define _dyn_add(a, b)        _mm256_add_ps(a, b)
+#define _dyn_mul(a, b)        _mm256_mul_ps(a, b)
+#define _dyn_live(inv)        _mm256_cmp_ps(inv, _mm256_setzero_ps(), _CMP_GT_OQ)
+#define _dyn_select(m, a, b)  _mm256_blendv_ps(b, a, m)
+#elif defined(DYNAMO_SIMD_SSE2)
+typedef __m128 _dynamo_vf;
+#define _dyn_load(p)          _mm_loadu_ps(p)
+#define _dyn_store(p, v)      _mm_storeu_ps(p, v)
+#define _dyn_set1(x)          _mm_set1_ps(x)
+#define _dyn_add(a, b)        _mm_add_ps(a, b)
+#define _dyn_mul(a, b)        _mm_mul_ps(a, b)
+#define _dyn_live(inv)        _mm_cmpgt_ps(inv, _mm_setzero_ps())
+#define _dyn_select(m, a, b)  _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b))
+#elif defined(DYNAMO_SIMD_NEON)
+typedef float32x4_t _dynamo_vf;
+#define _dyn_load(p)          vld1q_f32(p)
+#define _dyn_store(p, v)      vst1q_f32(p, v)
+#define _dyn_set1(x)          vdupq_n_f32(x)
+#define _dyn_add(a, b)        vaddq_f32(a, b)
+#define _dyn_mul(a, b)        vmulq_f32(a, b)
+#define _dyn_live(inv)        vreinterpretq_f32_u32(vcgtq_f32(inv, vdupq_n_f32(0.0f)))
+#define _dyn_select(m, a, b)  vbslq_f32(vreinterpretq_u32_f32(m), a, b)
+#endif
+
+#if DYNAMO_SIMD_WIDTH > 1
+// The vector form of _Dynamo_IntegrateAxis; static lanes (mask clear) keep their old values.
+static inline void _Dynamo_IntegrateAxisSIMD(float* p, float* v, float* a, _dynamo_vf live, _dynamo_vf gravity, _dynamo_vf neg_drag, _dynamo_vf inv_mass, _dynamo_vf dt) {
+    _dynamo_vf pv = _dyn_load(p), vv = _dyn_load(v), av = _dyn_load(a);
+    _dynamo_vf accel = _dyn_add(_dyn_add(av, gravity), _dyn_mul(_dyn_mul(vv, neg_drag), inv_mass));
+    _dynamo_vf new_v = _dyn_add(vv, _dyn_mul(accel, dt));
+    _dynamo_vf new_p = _dyn_add(pv, _dyn_mul(new_v, dt));
+    _dyn_store(v, _dyn_select(live, new_v, vv));
+    _dyn_store(p, _dyn_select(live, new_p, pv));
+    _dyn_store(a, _dyn_select(live, _dyn_set1(0.0f), av));
+}
+#endif
+
+SITAPI void Dynamo_UpdateBatch3D(DynamoBodyBatch* batch, int count, float delta_time) {
+    if (!batch || count <= 0) return;
+    if (count > batch->count) count = batch->count;
+
+    const float gx = DYNAMO_GRAVITY_3D[0], gy = DYNAMO_GRAVITY_3D[1], gz = DYNAMO_GRAVITY_3D[2];
+    int i = 0;
+
+#if DYNAMO_SIMD_WIDTH > 1
+    // 1. --- Full vectors ---
+    _dynamo_vf dt = _dyn_set1(delta_time);
+    _dynamo_vf vgx = _dyn_set1(gx), vgy = _dyn_set1(gy), vgz = _dyn_set1(gz);
+    _dynamo_vf neg_one = _dyn_set1(-1.0f);
+    for (; i + DYNAMO_SIMD_WIDTH <= count; i += DYNAMO_SIMD_WIDTH) {
+        _dynamo_vf inv = _dyn_load(&batch->inverse_mass[i]);
+        _dynamo_vf live = _dyn_live(inv);
+        _dynamo_vf neg_drag = _dyn_mul(_dyn_load(&batch->drag[i]), neg_one);
+        _Dynamo_IntegrateAxisSIMD(&batch->position_x[i], &batch->velocity_x[i], &batch->acceleration_x[i], live, vgx, neg_drag, inv, dt);
+        _Dynamo_IntegrateAxisSIMD(&batch->position_y[i], &batch->velocity_y[i], &batch->acceleration_y[i], live, vgy, neg_drag, inv, dt);
+        _Dynamo_IntegrateAxisSIMD(&batch->position_z[i], &batch->velocity_z[i], &batch->acceleration_z[i], live, vgz, neg_drag, inv, dt);
+    }
+#endif
+
+    // 2. --- Remainder (or everything, without SIMD) ---
+    for (; i < count; i++) {
+        float inv = batch->inverse_mass[i];
+        if (inv <= 0.0f) continue;
+        float neg_drag = -batch->drag[i];
+        _Dynamo_IntegrateAxis(&batch->position_x[i], &batch->velocity_x[i], &batch->acceleration_x[i], gx, neg_drag, inv, delta_time);
+        _Dynamo_IntegrateAxis(&batch->position_y[i], &batch->velocity_y[i], &batch->acceleration_y[i], gy, neg_drag, inv, delta_time);
+        _Dynamo_IntegrateAxis(&batch->position_z[i], &batch->velocity_z[i], &batch->acceleration_z[i], gz, neg_drag, inv, delta_time);
+    }
+}
+
+SITAPI void Dynamo_ResolveGroundBatch(DynamoBodyBatch* batch, int count, const float* ground_y, const vec3* ground_normal) {
+    if (!batch || !ground_y || !ground_normal || count <= 0) return;
+    if (count > batch->count) count = batch->count;
+
+    for (int i = 0; i < count; i++) {
+        if (batch->position_y[i] >= ground_y[i]) continue;
+
+        // Same response as Dynamo_ResolveCollision: snap to the surface, reflect, damp.
+        batch->position_y[i] = ground_y[i];
+        const float* n = ground_normal[i];
+        float dot = batch->velocity_x[i] * n[0] + batch->velocity_y[i] * n[1] + batch->velocity_z[i] * n[2];
+        if (dot < 0.0f) {
+            float e = batch->bounciness[i];
+            batch->velocity_x[i] = (batch->velocity_x[i] - 2.0f * dot * n[0]) * e;
+            batch->velocity_y[i] = (batch->velocity_y[i] - 2.0f * dot * n[1]) * e;
+            batch->velocity_z[i] = (batch->velocity_z[i] - 2.0f * dot * n[2]) * e;
+        }
+    }
+}
+
 #endif // DYNAMO_IMPLEMENTATION
-#endif // DYNAMO_H
\ No newline at end of file
+#endif // DYNAMO_H
@@ -14,14 +14,71 @@
     #error "rgl.h requires situation_api.h to be included first."
 #endif
 
+// Storage class for per-thread recording state (see RGL_BeginCommandList).
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define RGL_THREAD_LOCAL __declspec(thread)
+#else
+    #define RGL_THREAD_LOCAL _Thread_local
+#endif
+
 // --- Configuration ---
 #define RGL_DEFAULT_BATCH_CAPACITY 8192
 #define RGL_MAX_BATCH_CAPACITY 65536
+#define RGL_VERTEX_RING_SEGMENTS 3        // Persistently mapped batch VBO segments (frames in flight)
+#define RGL_IMMEDIATE_VERTEX_RESERVE 64   // Vertices at the head of the batch VBO kept for immediate-mode glBufferSubData draws
+#ifndef RGL_PACKED_VERTICES
+#define RGL_PACKED_VERTICES 1             // 1 = 28-byte quantized batch vertices, 0 = 56-byte float vertices (use if UVs exceed half-float range)
+#endif
+#ifndef RGL_BINDLESS_TEXTURES
+#define RGL_BINDLESS_TEXTURES 1           // 1 = use GL_ARB_bindless_texture when present, so a batch run is never split by a texture change
+#endif
+#define RGL_MAX_BINDLESS_TEXTURES 4096    // Textures the batch can address through its per-vertex texture index (index 0 = untextured)
+#define RGL_TEXTURE_ATLAS_PAGE_SIZE 2048  // Width and height of a sprite atlas page
+#define RGL_TEXTURE_ATLAS_MAX_IMAGE 512   // Images larger than this (either side) get their own texture instead of an atlas slot
+#define RGL_TEXTURE_ATLAS_PADDING 1       // Border of repeated edge texels around each atlas image; stops bilinear bleeding
+#define RGL_COMMAND_LIST_DEFAULT_CAPACITY 1024 // Initial size of a per-thread command list (grows on demand)
+#define RGL_PATH_SAMPLE_SPACING 5.0f      // Z distance between cached path samples (also the road renderer's segment length)
+#define RGL_GPU_ROAD_QUADS_PER_SEGMENT 11 // Surface, 2 shoulders, split and up to 7 lane lines; injected into the vertex shader's road mode
+#define RGL_LEVEL_GRID_TARGET_ITEMS 32    // Walls/flats/things per level grid cell the culling grid is sized for
+#define RGL_LEVEL_GRID_MAX_DIM 64         // Maximum level grid cells along X and along Z
+#define RGL_BILLBOARD_BOUNDS_SCALE 0.7072f // Bounding radius of a billboard per unit of size (half diagonal)
 #define RGL_DEFAULT_FOV_DEGREES 60.0f
 #define RGL_DEFAULT_NEAR_PLANE 0.1f
 #define RGL_DEFAULT_FAR_PLANE 3000.0f
 #define RGL_SHAPE_SEGMENTS 36
+#define RGL_MAX_PARTICLE_BURSTS 256       // Live RGL_EmitParticles bursts; further emits are dropped until one expires
+#define RGL_PARTICLE_WORKGROUP_SIZE 256   // local_size_x of the particle compute shaders
 #define RGL_FONT_ATLAS_CHAR_COUNT 256
+#define RGL_TEXT_RUN_CACHE_SIZE 256       // Cached bitmap-font text layouts (power of two); the least recently used is replaced
+#define RGL_TEXT_RUN_PROBE_LENGTH 8       // Cache slots searched per lookup before a layout is rebuilt
+#define RGL_MESH_FILE_MAGIC 0x4D4C4752u   // "RGLM" as little-endian bytes; first field of a binary mesh file
+#define RGL_MESH_FILE_VERSION 1u          // Bumped whenever the binary mesh layout changes; older caches are rebuilt
+#define RGL_MESH_FILE_ALIGNMENT 16        // Every data block of a binary mesh file starts on this boundary
+#define RGL_MESH_FILE_EXTENSION ".rglmesh" // Appended to an .obj path to name its binary cache
+#ifndef RGL_ASYNC_UPLOAD_BUDGET
+#define RGL_ASYNC_UPLOAD_BUDGET (8u * 1024u * 1024u) // Default bytes of decoded assets uploaded to the GPU per frame by the async loader
+#endif
+#ifndef RGL_PROFILE_FRAME_HISTORY
+#define RGL_PROFILE_FRAME_HISTORY 120     // Frames kept in the profiler ring (RGL_GetFrameProfile / RGL_ExportProfileTrace)
+#endif
+#define RGL_PROFILE_MAX_ZONES 64          // Timed zones recorded per frame; later ones only bump dropped_zones
+#define RGL_PROFILE_MAX_DEPTH 16          // Deepest zone nesting that is recorded
+#define RGL_PROFILE_GPU_LATENCY 3         // Frames a GPU timestamp query is left in flight before it is read back
+#define RGL_RENDER_TARGET_POOL_SIZE 32    // Virtual displays the render-target pool keeps; targets beyond it are created and destroyed directly
+#define RGL_RENDER_TARGET_IDLE_SECONDS 2.0 // A released pooled target unused this long is destroyed at the next RGL_Begin
+#define RGL_DYNAMIC_RES_MAX_PASSES 4      // RGL_Begin/RGL_End pairs timed separately on the GPU per dynamic-resolution frame; later ones extend the last
+#define RGL_RETRO_LUT_SIZE 32             // Texels per axis of the baked YPQ conversion lookup textures (trilinear-filtered)
+#ifndef RGL_RETRO_PALETTE_LUT_SIZE
+#define RGL_RETRO_PALETTE_LUT_SIZE 32     // Texels per axis of the palette lookup texture; input channels are matched at this resolution
+#endif
+#ifndef RGL_FRAME_ARENA_INITIAL_SIZE
+#define RGL_FRAME_ARENA_INITIAL_SIZE (256u * 1024u) // Starting bytes of the per-frame scratch arena; RGL_Begin resizes it to the high-water mark of recent frames
+#endif
+#ifndef RGL_FRAME_ARENA_WINDOW
+#define RGL_FRAME_ARENA_WINDOW 120        // Frames (RGL_Begin/RGL_End pairs) the arena's high-water mark looks back over; older peaks stop holding memory
+#endif
+#define RGL_FRAME_ARENA_ALIGNMENT 16      // Every frame arena allocation starts on this boundary
+// Define RGL_ENABLE_BENCHMARKS before including rgl.h to build RGL_RunBenchmarks and its scenes (off by default).
 
 #define WHITE   (Color){255, 255, 255, 255}
 #define RED     (Color){255, 0, 0, 255}
@@ -34,6 +91,7 @@ typedef struct {
     SituationTexture texture;       // The opaque resource handle
     uint64_t bindless_handle;       // Cached bindless handle for shaders
     int virtual_display_id;         // -1 if standard texture, >= 0 if a Render Target
+    bool is_opaque;                 // Hint: no translucent texels. Lets the batcher draw it in the opaque (front-to-back, no blend) pass.
 } RGLTexture;
 
 /**
@@ -57,8 +115,28 @@ typedef struct {
     vec2* cpu_texcoords;
     vec3* cpu_normals;
     unsigned int* cpu_indices;
+
+    // Shadow-volume data, built once at load time so casting never walks the triangles on the CPU.
+    unsigned int* cpu_adjacency; // 6 indices per triangle (GL_TRIANGLES_ADJACENCY order); NULL for temporary meshes.
+    GLuint shadow_vao;           // Object-space positions + adjacency indices for the silhouette shader. 0 if not built.
+    GLuint shadow_vbo;
+    GLuint shadow_ibo;
 } RGLMesh;
 
+/** @brief Handle to an asset requested with RGL_LoadTextureAsync / RGL_LoadMeshAsync. 0 is never a valid handle. */
+typedef uint32_t RGLAssetHandle;
+
+/** @brief Progress of an asynchronous load, as seen by the render thread. */
+typedef enum {
+    RGL_ASSET_INVALID = 0, // Unknown or released handle
+    RGL_ASSET_LOADING,     // Reading/decoding on a worker, or decoded and waiting for upload budget; the placeholder is returned
+    RGL_ASSET_READY,       // Uploaded; the real texture or mesh is returned
+    RGL_ASSET_FAILED       // The file could not be read or decoded; the placeholder keeps being returned
+} RGLAssetState;
+
+/** @brief Called on the render thread (inside RGL_Begin) when an async load becomes READY or FAILED. */
+typedef void (*RGLAssetCallback)(RGLAssetHandle handle, bool success, void* user_data);
+
 // --- Public Types and Structs ---
 
 /**
@@ -163,8 +241,10 @@ typedef struct {
     int first_char;            // ASCII code of first character
 } RGLTrueTypeFont;
 
-#define RGL_MAX_LIGHTS 64
-#define MAX_SHADER_LIGHTS 32
+#define RGL_MAX_LIGHTS 4096
+#define RGL_CLUSTER_GRID_X 16           // Clustered lighting: screen tiles across
+#define RGL_CLUSTER_GRID_Y 9            // Clustered lighting: screen tiles down
+#define RGL_CLUSTER_GRID_Z 24           // Clustered lighting: logarithmic depth slices between the default near and far planes
 #define RGL_LIGHT_CULLING_BIAS 30.0f // Keep lights active up to 30 units behind the camera
 
 /**
@@ -256,6 +336,22 @@ typedef struct {
     int attached_light_id; // ID of an RGLLight, or 0 if none
 } RGLThing;
 
+// One indexed draw range of a level's cached static geometry: the walls and flats of one grid cell sharing a texture.
+typedef struct {
+    RGLTexture texture;
+    uint32_t cell;              // Grid cell the range belongs to (see RGLLevelCell)
+    uint32_t first_index;       // Offset into the level's static index buffer
+    uint32_t index_count;
+} RGLLevelDrawRange;
+
+// One cell of a level's uniform XZ culling grid.
+typedef struct {
+    vec3 bounds_min;            // World-space AABB of everything assigned to the cell
+    vec3 bounds_max;
+    uint32_t first_thing;       // This cell's things: cell_things[first_thing .. first_thing + thing_count)
+    uint32_t thing_count;
+} RGLLevelCell;
+
 typedef struct {
     char name[32];
 
@@ -276,8 +372,33 @@ typedef struct {
     RGLThing* things;
     size_t thing_count;
     size_t thing_capacity;
+
+    // --- Cached static geometry (walls + flats), rebuilt only when edited or moved ---
+    bool geometry_dirty;                // Set by RGL_AddVertex/AddWall/AddFlat/AddThing
+    mat4 static_transform;              // Level transform baked into the cached vertices
+    GLuint static_vao;
+    GLuint static_vbo;
+    GLuint static_ibo;
+    RGLLevelDrawRange* static_ranges;   // One per (texture, cell), texture-major, in index-buffer order
+    size_t static_range_count;
+    size_t static_opaque_range_count;   // Ranges [0, this) use opaque textures; the translucent ones follow
+
+    // --- Spatial index: uniform XZ grid over walls, flats and things, rebuilt with the cache ---
+    int grid_cols, grid_rows;
+    vec2 grid_origin;                   // Level-local XZ of the grid's minimum corner
+    vec2 grid_inv_cell_size;            // Cells per local unit along X and Z
+    RGLLevelCell* cells;
+    size_t cell_count;
+    uint32_t* cell_things;              // Thing indices grouped by cell
 } RGLLevel;
 
+// One RGL_DrawLevel call waiting for the flush. Each call keeps its own visible-cell mask, so a level
+// drawn twice in one batch from different cameras (mirrors, split screen) gets each view's culling.
+typedef struct {
+    int level_index;
+    uint32_t first_visibility_word; // Mask bits: static_level_visibility[first_visibility_word ...], one bit per cell
+} RGLQueuedLevel;
+
 // --- Path & Path System Types ---
 
 #define RGL_MAX_SCENERY_TYPES 256 // Define a max number of styles we can register
@@ -340,9 +461,10 @@ typedef struct {
     RGLJunctionType type;          // The geometric type of the junction.
 
     // Connection info for each possible choice. A path_name[0] == '\0' indicates no valid choice in that direction.
-    struct { char path_name[32]; float z_pos; } choice_left;
-    struct { char path_name[32]; float z_pos; } choice_right;
-    struct { char path_name[32]; float z_pos; } choice_straight;
+    // path_index is the destination resolved when the path's scenery index was built (-1 if none or not loaded).
+    struct { char path_name[32]; float z_pos; int path_index; } choice_left;
+    struct { char path_name[32]; float z_pos; int path_index; } choice_right;
+    struct { char path_name[32]; float z_pos; int path_index; } choice_straight;
 
 } RGLJunctionInfo;
 
@@ -420,6 +542,59 @@ typedef struct {
     vec3 world_pos;
 } RGLMarkerInfo;
 
+/** @brief One request of RGL_QuerySceneryBatch: a Z range, or a sphere when radius > 0. */
+typedef struct {
+    int path_index;             // Path to search (see RGL_GetPathIndex)
+    RGLSceneryType type;        // Only this type, or RGL_SCENERY_NONE for every type
+    float start_z, end_z;       // Inclusive Z range, used when radius <= 0
+    vec3 center;                // Sphere center, used when radius > 0
+    float radius;
+    int max_results;            // Cap for this query (0 = only the shared output limits it)
+
+    // --- Filled in by the query ---
+    int first_result;           // Index of this query's first hit in the output array
+    int result_count;           // Hits written, or -1 if the path is unknown or its index is out of date
+} RGLSceneryQuery;
+
+/** @brief One scenery object found by RGL_QuerySceneryBatch. */
+typedef struct {
+    const RGLScenery* scenery;  // Points into the path; valid until the path is edited or destroyed
+    vec3 world_pos;
+    int point_index;            // Control point holding the scenery
+    int slot;                   // 0 = left, 1 = right, 2 = overhead
+} RGLSceneryHit;
+
+/** @brief One request of RGL_QueryJunctionBatch. */
+typedef struct {
+    int path_index;
+    float player_z;
+    float search_radius;        // Forward distance to look for a junction trigger
+} RGLJunctionQuery;
+
+/**
+ * @brief A caller-owned bookmark for the re-entrant path queries (RGL_GetPathPropertiesAtEx and friends).
+ * Zero-initialize it. One cursor per caller (vehicle, AI agent, job) keeps the segment search O(1) for
+ * queries that move a little each frame; a cursor moved to another path is simply re-clamped.
+ */
+typedef struct {
+    int segment_index;          // Control point the last query landed on
+} RGLPathCursor;
+
+/**
+ * @brief Distance-based level of detail for a path's road and scenery (see RGL_SetPathLOD).
+ * Distances are measured along Z from the player; 0 disables that cutoff. Each cutoff fades its
+ * feature out over the last fade_distance units instead of popping it.
+ */
+typedef struct {
+    float full_detail_distance; // Segments keep the sample spacing up to here; the step then doubles every time the distance doubles
+    int max_segment_step;       // Most samples one far segment may span (rounded down to a power of two, 1 = never merge)
+    float line_distance;        // Lane markings end here
+    float rumble_distance;      // Rumble strips / shoulders end here
+    float scenery_distance;     // Scenery ends here; leave 0 to keep scenery out to the horizon
+    float impostor_distance;    // Sprite scenery beyond this is drawn as Y-locked instanced impostor quads, one draw per sprite
+    float fade_distance;        // Width of the cross-fade band before each cutoff
+} RGLPathLOD;
+
 typedef struct {
     Color bg_dark_gray;
     Color grid_white;
@@ -472,11 +647,129 @@ typedef struct {
 
 typedef struct {
     int active_lights_per_frame;
-    float light_ubo_upload_time_ms;
+    float light_ubo_upload_time_ms;  // CPU time spent culling, binning and uploading lights this frame
+    int light_cluster_rebuilds;      // Flushes this frame that had to rebuild the light grid (the rest reused it)
     int downward_shadows_drawn;
     int stencil_volumes_drawn;
+    int text_runs_built;             // Bitmap-font strings laid out this frame (cache misses); repeated strings cost 0
+    size_t async_bytes_uploaded;     // Decoded texture/mesh bytes the async loader sent to the GPU this frame
+    int commands_flushed;            // Batched commands the flushes turned into vertices this frame
+    size_t bytes_uploaded;           // Batch vertex, instance and light bytes the flushes sent to the GPU this frame
+    size_t frame_arena_used;         // Peak transient scratch bytes taken from the frame arena this frame
+    size_t frame_arena_high_water;   // Largest frame_arena_used of the last RGL_FRAME_ARENA_WINDOW frames; the arena is sized to it at RGL_Begin
 } RGLStats;
 
+/** @brief One timed zone of a profiled frame. Times are in milliseconds from the start of the frame. */
+typedef struct {
+    const char* name;       // Label given to RGL_BeginProfileZone (not copied)
+    int depth;              // Nesting depth; 0 = outermost
+    float cpu_start_ms;
+    float cpu_ms;
+    float gpu_start_ms;     // From the frame's first GPU timestamp; -1 until resolved or if unavailable
+    float gpu_ms;           // -1 until resolved or if unavailable
+} RGLProfileZone;
+
+/** @brief The zones recorded between one RGL_Begin and its RGL_End. */
+typedef struct {
+    uint64_t frame_index;   // Profiled frames since profiling was first enabled
+    double cpu_start_ms;    // Frame start on the SituationTimerGetTime clock
+    float cpu_ms;           // RGL_Begin to RGL_End on the CPU
+    float gpu_ms;           // First to last GPU timestamp of the frame; -1 until resolved
+    bool gpu_resolved;      // GPU times arrive RGL_PROFILE_GPU_LATENCY frames late
+    int zone_count;
+    int dropped_zones;      // Zones beyond RGL_PROFILE_MAX_ZONES or RGL_PROFILE_MAX_DEPTH
+    RGLProfileZone zones[RGL_PROFILE_MAX_ZONES]; // In begin order
+} RGLFrameProfile;
+
+#ifdef RGL_ENABLE_BENCHMARKS
+/** @brief The fixed-seed scenes RGL_RunBenchmarks can measure. */
+typedef enum {
+    RGL_BENCHMARK_SPRITES = 0,  // sprite_count rotated, tinted RGL_DrawSpritePro quads over 4 textures
+    RGL_BENCHMARK_PATH,         // A path_point_count point road with scenery, one result per draw distance
+    RGL_BENCHMARK_LEVEL,        // A level_grid x level_grid maze of walls, floors and things seen from an orbiting camera
+    RGL_BENCHMARK_LIGHTS,       // light_count moving point lights over a lit floor, plus stencil_casters shadow-casting cubes
+    RGL_BENCHMARK_TEXT,         // A text_lines HUD, half static strings (layout cache hits) and half changing every frame
+    RGL_BENCHMARK_COUNT
+} RGLBenchmarkScenario;
+
+typedef struct {
+    uint32_t scenarios;         // Bit mask of (1u << RGLBenchmarkScenario); 0 runs every scenario
+    uint32_t seed;              // Seeds every random placement, so runs are comparable across releases
+    int frames;                 // Measured frames per result
+    int warmup_frames;          // Unmeasured frames first (cache builds, buffer growth)
+    int virtual_display_id;     // Render target, as for RGL_Begin (-1 for the main screen)
+    bool cpu_only;              // Flushes sort, assemble and bin lights but submit nothing; stencil casters are skipped
+
+    int sprite_count;
+    int path_point_count;
+    int draw_distances[4];      // RGL_DrawPath draw distances measured for the path scenario
+    int draw_distance_count;
+    int level_grid;
+    int light_count;
+    int stencil_casters;
+    int text_lines;
+} RGLBenchmarkConfig;
+
+/** @brief One measured scenario (and, for the path scenario, one draw distance). All values are per-frame averages. */
+typedef struct {
+    RGLBenchmarkScenario scenario;
+    int variant;                // Draw distance for RGL_BENCHMARK_PATH, otherwise 0
+    int frames;
+    double cpu_ms;              // RGL_Begin to RGL_End on the CPU
+    double commands;            // Batched commands flushed
+    double ns_per_command;      // cpu_ms spread over the commands
+    double flushes;
+    double draw_calls;
+    double bytes_uploaded;      // In cpu_only mode, the batch vertex bytes that would have been uploaded
+} RGLBenchmarkResult;
+#endif // RGL_ENABLE_BENCHMARKS
+
+/**
+ * @brief Dynamic-resolution settings (see RGL_SetDynamicResolution).
+ * The world is rendered into a pooled virtual display at scale x the main display's size, and the
+ * scale follows the frame's work time: down when frames run over target, back up once they run under it.
+ */
+typedef struct {
+    float target_frame_ms;      // Frame time to hold (16.67 for 60 fps)
+    float min_scale;            // Lowest scale per axis, in (0, 1]
+    float max_scale;            // Highest scale per axis, in [min_scale, 1]
+    float scale_step;           // Scales are rounded to multiples of this, so a few pooled targets cover every scale
+    float headroom;             // Scale up only when the average frame is this fraction under target (0.1 = 10%)
+    float margin;               // Scale down only when the average frame is this fraction over target (0.05 = 5%)
+    int adjust_interval_frames; // Frames between scale changes; the average settles in between
+    SituationScalingMode scaling_mode; // How the world display is upscaled (SITUATION_SCALING_STRETCH filters linearly)
+} RGLDynamicResolution;
+
+/**
+ * @brief The retro color effects applied by RGL_ApplyRetroEffects, each the full-screen counterpart
+ * of a per-color YPQ function. Effects with a zero strength are skipped.
+ */
+typedef struct {
+    float scanline_intensity;   // RGL_ColorScanline: luminance lost on odd scanlines
+    float scanline_height;      // Pixel rows per scanline (0 counts as 1)
+    float noise_strength;       // RGL_ColorTVNoise
+    float bloom_strength;       // RGL_ColorCRTBloom
+    float ghost_offset;         // RGL_ColorTVGhost: phase offset of the ghost, as a fraction of the cycle
+    float ghost_strength;       // RGL_ColorTVGhost: blend of the ghost over the picture
+    float ghost_shift;          // Pixels the ghost trails to the right (0 = the pixel itself, like RGL_ColorTVGhost)
+    int tv_channel;             // RGL_YPQFromTVChannel channel whose carrier shows through a weak signal
+    float signal_loss;          // 0 = clean picture; up to 1 fades toward the channel's color (signal strength 1 - signal_loss)
+    const Color* palette;       // RGL_ColorClosest quantization applied last, through a lookup texture (NULL = off)
+    int palette_size;
+} RGLRetroEffects;
+
+/**
+ * @brief An opaque, growable list of batched draw commands recorded off the render thread.
+ * See RGL_BeginCommandList() and RGL_SubmitCommandList().
+ */
+typedef struct RGLCommandList RGLCommandList;
+
+/**
+ * @brief An opaque, retained layer of batched draws, sorted and assembled once and kept on the GPU.
+ * See RGL_BeginDrawList() and RGL_DrawDrawList().
+ */
+typedef struct RGLDrawList RGLDrawList;
+
 // --- API Function Declarations ---
 
 //==================================================================================
@@ -500,6 +793,28 @@ SITAPI void RGL_End(void);                                                  // E
 SITAPI void RGL_SetTransform(mat4 transform);                               // Sets a global 3D model matrix for subsequent RGL_Draw... calls.
 SITAPI void RGL_ResetTransform(void);                                       // Resets the global 3D model matrix to identity.
 //==================================================================================
+// Core Module: Multithreaded Command Recording
+//==================================================================================
+SITAPI RGLCommandList* RGL_CreateCommandList(size_t initial_capacity);     // Creates an empty command list for recording batched draws on a worker thread.
+SITAPI void RGL_DestroyCommandList(RGLCommandList* list);                  // Frees a command list. It must not be bound to any thread.
+SITAPI void RGL_BeginCommandList(RGLCommandList* list);                    // Binds a list to the calling thread; batched RGL_Draw... calls then append to it instead of the frame batch.
+SITAPI void RGL_EndCommandList(void);                                      // Unbinds the calling thread's command list.
+SITAPI void RGL_SubmitCommandList(RGLCommandList* list);                   // (Render thread) Appends a recorded list to the frame batch and clears it for reuse.
+SITAPI size_t RGL_GetCommandListSize(const RGLCommandList* list);          // Returns the number of commands currently recorded in a list.
+#ifdef SITUATION_ENABLE_THREADING
+SITAPI void RGL_RecordParallel(SituationThreadPool* pool, int job_count, void (*record_func)(int job_index, void* user_data), void* user_data); // Runs record_func for each job on the pool, each into its own list, then submits them in job order.
+#endif
+//==================================================================================
+// Core Module: Retained Draw Lists
+//==================================================================================
+SITAPI RGLDrawList* RGL_CreateDrawList(void);                               // Creates an empty retained draw list for layers that rarely change (HUDs, panels, minimaps).
+SITAPI void RGL_DestroyDrawList(RGLDrawList* list);                         // Frees a draw list and its GPU buffers.
+SITAPI void RGL_BeginDrawList(RGLDrawList* list);                           // (Render thread) Starts re-recording a list; batched RGL_Draw... calls then go into it instead of the frame.
+SITAPI bool RGL_EndDrawList(void);                                          // Sorts and assembles the recording once and uploads it as static buffers.
+SITAPI void RGL_DrawDrawList(const RGLDrawList* list, mat4 transform);      // Replays a recorded list at this point in the frame, under a model transform (NULL for identity).
+SITAPI void RGL_InvalidateDrawList(RGLDrawList* list);                      // Marks a list as stale; it draws nothing until it is recorded again.
+SITAPI bool RGL_IsDrawListValid(const RGLDrawList* list);                   // Returns true if the list holds a recording that has not been invalidated.
+//==================================================================================
 // Camera & View Module
 //==================================================================================
 SITAPI void RGL_SetCamera2D(Vector2 target, float rotation_degrees, float zoom); // Configures an orthographic camera for 2D rendering.
@@ -529,6 +844,9 @@ SITAPI void RGL_DrawPath(float player_z, int draw_distance);                // D
 SITAPI void RGL_DrawPathAsRoad(float player_z, int draw_distance);          // Convenience wrapper to draw the active path as a classic road.
 SITAPI void RGL_DrawPathAsMap(RGLTexture target, Vector2 center_pos_xz, float world_width, Color bg_color); // Renders a top-down 2D map of the active path to a texture.
 SITAPI const RGLPathStyle* RGL_GetDefaultRoadStyle(void);                   // Gets a pointer to the built-in road style, for use with RGL_SetPathStyle.
+SITAPI const RGLPathStyle* RGL_GetGPURoadStyle(void);                       // Gets the built-in road style whose quads are expanded on the GPU from the path's samples.
+SITAPI bool RGL_SetPathLOD(const char* path_name, const RGLPathLOD* lod);  // Enables distance-based LOD for a path's road and scenery (NULL disables it).
+SITAPI RGLPathLOD RGL_GetDefaultPathLOD(void);                              // Returns LOD settings tuned for the default draw distances.
 //==================================================================================
 // World Systems: Level Management
 //==================================================================================
@@ -539,7 +857,7 @@ SITAPI bool RGL_AddFlat(const char* level_name, RGLFlat flat);              // A
 SITAPI bool RGL_AddThing(const char* level_name, RGLThing thing);           // Adds a billboard-style object (e.g., enemy, item) to a named level.
 SITAPI bool RGL_SetActiveLevel(const char* level_name);                     // Sets the currently active level for drawing.
 SITAPI bool RGL_DestroyLevelByName(const char* level_name);                 // Destroys a named level and frees all its associated geometry data.
-SITAPI void RGL_DrawLevel(void);                                            // Draws the active level, including walls, flats, and things, with dynamic lighting.
+SITAPI void RGL_DrawLevel(void);                                            // (Render thread) Draws the active level, including walls, flats, and things, with dynamic lighting.
 SITAPI bool RGL_PlaceLevelOnPath(const char* level_name, const char* path_name, float path_z, Vector3 offset, float yaw_offset_degrees); // Positions a level relative to a point on a path.
 SITAPI void RGL_DrawWorld(float camera_z, int Path_draw_distance);          // High-level helper to draw both the active path and all loaded levels.
 //==================================================================================
@@ -554,23 +872,59 @@ SITAPI bool RGL_GetDistanceToMarker(float player_z, const char* marker_name, flo
 SITAPI int RGL_FindMarkersInRange(float start_z, float end_z, RGLMarkerInfo out_markers[], int max_markers); // Finds all event markers within a Z-range.
 SITAPI int RGL_FindSceneryInRange(float start_z, float end_z, RGLScenery* out_scenery[], int max_scenery); // Finds all scenery objects within a Z-range.
 SITAPI int RGL_FindSceneryInRadius(Vector3 world_pos, float radius, RGLScenery* out_objects[], int max_objects); // Finds all scenery objects within a 3D radius.
+SITAPI int RGL_GetPathIndex(const char* path_name);                         // Returns a path's index for the by-index and batch queries, or -1. Indices shift when a path is destroyed.
+SITAPI bool RGL_SetActivePathByIndex(int path_index);                       // Sets the active path by index (e.g. a junction choice's path_index).
+SITAPI void RGL_UpdateSceneryIndices(void);                                 // (Main thread) Rebuilds the scenery index of every edited path, so the batch queries can run on any thread.
+SITAPI int RGL_QuerySceneryBatch(RGLSceneryQuery* queries, int query_count, RGLSceneryHit* out_hits, int max_hits); // Answers many scenery range/radius queries across paths; read-only and thread-safe.
+SITAPI int RGL_QueryJunctionBatch(const RGLJunctionQuery* queries, int query_count, RGLJunctionInfo* out_infos); // Answers many junction queries across paths; read-only and thread-safe.
+SITAPI bool RGL_GetPathPropertiesAtEx(int path_index, float z_pos, RGLPathCursor* cursor, RGLPathPoint* out_point); // Re-entrant RGL_GetPathPropertiesAt on any path with a caller-owned cursor; read-only and thread-safe.
+SITAPI bool RGL_GetGroundAtEx(int path_index, vec2 world_xz, RGLPathCursor* cursor, RGLGroundInfo* out_info); // Re-entrant RGL_GetGroundAt on any path with a caller-owned cursor; read-only and thread-safe.
+SITAPI int RGL_GetGroundAtBatch(int path_index, const vec2* world_xz, int count, RGLPathCursor* cursor, RGLGroundInfo* out_infos); // Ground queries for many XZ points on one path; read-only and thread-safe.
 SITAPI Vector3 RGL_LevelToWorld(const char* level_name, Vector3 local_pos);       // Converts a 3D coordinate from a level's local space to global world space.
 SITAPI Vector3 RGL_WorldToLevel(const char* level_name, Vector3 world_pos);       // Converts a 3D coordinate from global world space to a level's local space.
 //==================================================================================
 // Mesh & Resource Management
 //==================================================================================
 SITAPI RGLTexture RGL_LoadTexture(const char* filename, bool generate_mipmaps); // Loads a texture from a file.
-SITAPI RGLTexture RGL_CreateRenderTexture(int width, int height);           // Creates a new texture that can be used as a rendering target.
+SITAPI RGLTexture RGL_CreateRenderTexture(int width, int height);           // Creates a texture that can be used as a rendering target (pooled: a reused one keeps its old contents).
 SITAPI void RGL_SetRenderTarget(RGLTexture texture);                        // Sets the current rendering target to a specific texture.
 SITAPI void RGL_ResetRenderTarget(void);                                    // Resets the rendering target back to the main screen or virtual display.
 SITAPI void RGL_UnloadTexture(RGLTexture texture);                          // Unloads a texture from memory.
+SITAPI void RGL_SetTextureOpaque(RGLTexture* texture, bool is_opaque);      // Marks a texture as fully opaque so fully-opaque draws using it skip blending and sort front-to-back.
+SITAPI RGLSprite RGL_AddImageToAtlas(SituationImage image);                 // Packs an image into a shared sprite atlas page; the sprite's source_rect points at it.
+SITAPI RGLSprite RGL_LoadSpriteIntoAtlas(const char* filename);             // Loads an image file into the sprite atlas.
+SITAPI SitRectangle RGL_GetAtlasSubRect(RGLSprite atlas_sprite, SitRectangle local_rect); // Maps a rectangle in the original image to its place on the atlas page (sprite sheet frames).
+SITAPI void RGL_UnloadSpriteAtlas(void);                                    // Frees every atlas page; sprites packed into them become invalid.
 SITAPI void RGL_DestroyRenderTexture(RGLTexture texture);                   // Destroys a render texture and its associated framebuffer object.
+SITAPI RGLTexture RGL_AcquireRenderTexture(int width, int height);          // Gets a render texture of this size from the pool, creating one only if none is free.
+SITAPI void RGL_ReleaseRenderTexture(RGLTexture texture);                   // Returns a render texture to the pool for reuse by a later acquire of the same size.
+SITAPI void RGL_TrimRenderTexturePool(double max_idle_seconds);             // Destroys released pooled targets idle for longer than this (0 = every released target).
+SITAPI bool RGL_SetDynamicResolution(const RGLDynamicResolution* settings); // Enables frame-time driven resolution scaling for the world display (NULL disables it).
+SITAPI RGLDynamicResolution RGL_GetDefaultDynamicResolution(void);          // Returns settings that hold 60 fps down to half resolution.
+SITAPI int RGL_UpdateDynamicResolution(float frame_time_ms);                // Feeds the last frame's work time (0 = measured by RGL) and returns the display to render the world into this frame.
+SITAPI float RGL_GetDynamicResolutionScale(void);                           // Returns the current world resolution scale (1 when disabled).
 SITAPI SitRectangle RGL_GetTextureRect(RGLTexture texture);                    // Returns a rectangle representing the full dimensions of a texture.
 SITAPI RGLMesh RGL_LoadMeshFromFile(const char* filename);                  // Loads a 3D model from a .obj file into a manageable mesh object.
+SITAPI RGLMesh RGL_LoadMeshBinary(const char* filename);                    // Memory-maps a binary .rglmesh file and uploads it with no parsing.
+SITAPI bool RGL_SaveMeshBinary(RGLMesh mesh, const char* filename);         // Writes a mesh (and its shadow adjacency) as a binary .rglmesh file.
+SITAPI bool RGL_ConvertObjToMeshBinary(const char* obj_filename, const char* binary_filename); // Converts an .obj to .rglmesh without touching the GPU (works in offline tools).
+SITAPI RGLMesh RGL_LoadMeshCached(const char* obj_filename);                // Loads "<obj>.rglmesh" if it matches the .obj's timestamp, else loads the .obj and rewrites the cache.
 SITAPI RGLMesh RGL_CreateMeshFromLevel(const char* level_name);             // Creates a CPU-only mesh from a level's geometry, for use with stencil shadows.
 SITAPI bool RGL_SaveMeshToFile(RGLMesh mesh, const char* filename);         // Saves a mesh's CPU-side geometry to a .obj file.
 SITAPI void RGL_DestroyMesh(RGLMesh* mesh);                                 // Frees all CPU and GPU resources associated with a mesh.
 //==================================================================================
+// Asynchronous Asset Streaming
+//==================================================================================
+#ifdef SITUATION_ENABLE_THREADING
+SITAPI RGLAssetHandle RGL_LoadTextureAsync(SituationThreadPool* pool, const char* filename, bool generate_mipmaps, RGLAssetCallback callback, void* user_data); // Decodes an image on the pool's IO queue and uploads it in a later RGL_Begin; returns at once.
+SITAPI RGLAssetHandle RGL_LoadMeshAsync(SituationThreadPool* pool, const char* filename, RGLAssetCallback callback, void* user_data); // Parses an .obj (and its shadow adjacency) on the pool's IO queue and uploads it in a later RGL_Begin.
+#endif
+SITAPI RGLAssetState RGL_GetAssetState(RGLAssetHandle handle);             // Polls an async load.
+SITAPI RGLTexture RGL_GetAsyncTexture(RGLAssetHandle handle);              // Returns the loaded texture, or a checkerboard placeholder until it is READY.
+SITAPI RGLMesh RGL_GetAsyncMesh(RGLAssetHandle handle);                    // Returns the loaded mesh, or a unit cube placeholder until it is READY.
+SITAPI void RGL_ReleaseAsyncAsset(RGLAssetHandle handle);                  // Forgets a handle. A READY asset now belongs to the caller; an unfinished load is cancelled.
+SITAPI void RGL_SetAsyncUploadBudget(size_t bytes_per_frame);              // Caps decoded bytes uploaded per frame (0 restores RGL_ASYNC_UPLOAD_BUDGET).
+//==================================================================================
 // Procedural Mesh Generation
 //==================================================================================
 SITAPI RGLMesh RGL_GenMeshPlane(float width, float length, int subdivisions_x, int subdivisions_z); // Generates a flat plane mesh on the XZ axis.
@@ -602,6 +956,8 @@ SITAPI void RGL_DestroyLight(int light_id);                                 // D
 //==================================================================================
 // Shadow Rendering
 //==================================================================================
+SITAPI void RGL_BeginStencilShadows(const RGLShadowConfig* config);          // Opens a stencil shadow pass: one stencil clear shared by every caster until RGL_EndStencilShadows.
+SITAPI void RGL_EndStencilShadows(void);                                    // Closes the stencil shadow pass with a single darken pass in the color given to RGL_BeginStencilShadows.
 SITAPI void RGL_CastStencilShadowFromMesh(RGLMesh mesh, mat4 transform, const RGLShadowConfig* config); // Casts a high-quality, perspective-correct stencil shadow from a mesh.
 SITAPI void RGL_DrawSpriteWithShadow(RGLSprite sprite, Vector3 world_pos, Vector2 size, const RGLShadowConfig* config); // Convenience wrapper to cast a stencil shadow from a billboard sprite.
 SITAPI void RGL_DrawSpriteWithSimpleShadow(RGLSprite sprite, Vector3 world_pos, Vector2 size, int light_id); // Simplified helper to cast a default stencil shadow from a light.
@@ -638,7 +994,10 @@ SITAPI void RGL_DrawSprite(RGLSprite sprite, Vector2 position, float roll_degree
 SITAPI void RGL_DrawTexturePro(RGLSprite sprite, SitRectangle dest_rect, Vector2 origin, float rotation_degrees, Color tint); // Draws a textured quad with transformation options.
 SITAPI void RGL_DrawSpritePro(RGLSprite sprite, Vector3 position, Vector2 size, Vector2 origin_pct, Vector3 rotation_eul_deg, Vector2 skew, Color colors[4], float light_levels[4]); // The ultimate low-level sprite/quad drawing function with full options.
 SITAPI void RGL_DrawBillboard(RGLSprite sprite, Vector3 world_pos, Vector2 size, Color tint); // Draws a sprite in 3D that always faces the camera (spherical).
+SITAPI void RGL_DrawBillboardInstanced(RGLSprite sprite, const vec3* positions, const vec2* sizes, const Color* tints, int instance_count); // Draws many camera-facing copies of one sprite in a single instanced draw (tints may be NULL).
+SITAPI void RGL_DrawMeshInstanced(RGLMesh mesh, RGLTexture texture, const mat4* transforms, const Color* tints, int instance_count); // Draws many copies of a mesh in a single instanced draw, one model matrix each (tints may be NULL).
 SITAPI void RGL_DrawBillboardCylindricalY(RGLSprite sprite, Vector3 world_pos, Vector2 size, Color tint); // Draws a sprite in 3D that only pivots on the Y-axis to face the camera.
+SITAPI void RGL_DrawBillboardCylindricalYInstanced(RGLSprite sprite, const vec3* positions, const vec2* sizes, const Color* tints, int instance_count); // Draws many Y-axis-locked copies of one sprite in a single instanced draw (tints may be NULL).
 SITAPI void RGL_DrawPanoramaBackground(RGLTexture texture, float scroll_offset_x, float y_offset_pct, float height_scale, Color tint); // Draws a horizontally-scrolling panoramic background.
 SITAPI void RGL_DrawQuadPro(RGLTexture texture, SitRectangle source_rect, Vector3 position, Vector2 size, Vector2 origin_pct, Vector3 rotation_eul_deg, Vector2 skew, Color colors[4], float light_levels[4]); // DEPRECATED - Use DrawSpritePro.
 SITAPI void RGL_DrawQuad(RGLTexture texture, SitRectangle source_rect, Vector3 position, Vector2 size, Color tint); // DEPRECATED - Use DrawTexturePro or DrawSpritePro.
@@ -647,8 +1006,9 @@ SITAPI void RGL_DrawQuad(RGLTexture texture, SitRectangle source_rect, Vector3 p
 //==================================================================================
 SITAPI void RGL_InitParticles(size_t max_particles);                        // Initializes the particle system with a maximum capacity.
 SITAPI void RGL_EmitParticles(RGLParticleEmitter emitter);                  // Emits a burst of particles from a defined emitter.
-SITAPI void RGL_UpdateParticles(float delta_time);                          // Updates the physics and lifetime of all active particles.
-SITAPI void RGL_DrawParticles(void);                                        // Draws all active particles as billboards.
+SITAPI void RGL_UpdateParticles(float delta_time);                          // (Render thread) Updates the physics and lifetime of all active particles.
+SITAPI void RGL_DrawParticles(void);                                        // (Render thread) Draws all active particles as billboards.
+SITAPI void RGL_ShutdownParticles(void);                                    // Frees the particle pool and its GPU programs (also done by RGL_Shutdown).
 //==================================================================================
 // Font & Text Module
 //==================================================================================
@@ -675,6 +1035,7 @@ SITAPI void RGL_DrawTextTTF(const char* text, Vector2 position, RGLTrueTypeFont
 SITAPI void RGL_DrawTextBoxed(const char* text, SitRectangle bounds, RGLBitmapFont font, Color color, bool word_wrap); // Draws text within a rectangle, with optional word wrapping.
 SITAPI void RGL_UnloadBitmapFont(RGLBitmapFont font);                       // Unloads a bitmap font's texture atlas.
 SITAPI void RGL_UnloadTrueTypeFont(RGLTrueTypeFont font);                   // Unloads a TrueType font's texture atlas.
+SITAPI void RGL_ClearTextRunCache(void);                                    // Frees the cached bitmap-font text layouts used by RGL_DrawText/RGL_DrawTextBoxed/RGL_MeasureText.
 // --- Font Effects ---
 SITAPI void RGL_DrawTextWithShadow(const char* text, Vector2 position, RGLBitmapFont font, Color text_color, Color shadow_color, Vector2 shadow_offset); // Draws text with a drop shadow.
 SITAPI void RGL_DrawTextWithOutline(const char* text, Vector2 position, RGLBitmapFont font, Color text_color, Color outline_color, float outline_thickness); // Draws text with an outline.
@@ -732,6 +1093,8 @@ SITAPI Color RGL_ColorScanline(ColorYPQA color, float scanline_y, float intensit
 SITAPI Color RGL_ColorTVNoise(ColorYPQA base_color, float noise_strength, vec2 screen_pos); // Applies a procedural TV noise effect to a YPQ color.
 SITAPI Color RGL_ColorCRTBloom(ColorYPQA color, float bloom_strength);      // Applies a CRT phosphor bloom effect to a YPQ color.
 SITAPI Color RGL_ColorTVGhost(ColorYPQA color, float ghost_offset, float ghost_strength); // Applies a TV signal ghosting effect to a YPQ color.
+SITAPI void RGL_ApplyRetroEffects(const RGLRetroEffects* effects);          // Runs the YPQ effects and palette quantization over everything drawn so far, on the GPU.
+SITAPI RGLRetroEffects RGL_GetDefaultRetroEffects(void);                    // Returns a mild CRT look: light scanlines and bloom, no noise, ghost or palette.
 // --- YPQ Palettes & Gradients ---
 SITAPI void RGL_GenerateYPQGradient(ColorYPQA start, ColorYPQA end, Color* out_palette, int steps); // Generates a palette by interpolating in YPQ space for more natural results.
 SITAPI ColorYPQA RGL_YPQFromTVChannel(int channel, float signal_strength);  // Generates a pseudo-random TV-like color based on channel and signal strength.
@@ -760,6 +1123,22 @@ SITAPI ColorYPQA RGL_GetYPQBMagenta(void){ return SituationColorToYPQ((Color){25
 SITAPI ColorYPQA RGL_GetYPQBCyan(void)   { return SituationColorToYPQ((Color){ 85, 255, 255, 255}); } // Gets the YPQ representation of ANSI Bright Cyan
 SITAPI ColorYPQA RGL_GetYPQBWhite(void)  { return SituationColorToYPQ((Color){255, 255, 255, 255}); } // Gets the YPQ representation of ANSI Bright White
 //==================================================================================
+// Profiling Module
+//==================================================================================
+SITAPI void RGL_SetProfilingEnabled(bool enabled);                         // Starts or stops recording CPU/GPU zone timings for each RGL_Begin/RGL_End frame (off by default).
+SITAPI bool RGL_IsProfilingEnabled(void);                                   // Gets whether frames are being profiled.
+SITAPI void RGL_BeginProfileZone(const char* name);                         // Opens a timed zone (render thread only); zones nest and name must outlive the frame ring (use literals).
+SITAPI void RGL_EndProfileZone(void);                                       // Closes the innermost open zone.
+SITAPI int RGL_GetProfileFrameCount(void);                                  // Gets how many completed frames the profiler ring holds.
+SITAPI bool RGL_GetFrameProfile(int frames_ago, RGLFrameProfile* out_profile); // Copies a completed frame (0 = most recent); false if it is not in the ring.
+SITAPI size_t RGL_ExportProfileTrace(char* buf, size_t buf_size);          // Writes the ring as Chrome trace JSON (chrome://tracing, Perfetto); returns the full length like snprintf.
+SITAPI bool RGL_SaveProfileTrace(const char* file_path);                    // Writes the ring as a Chrome trace JSON file.
+#ifdef RGL_ENABLE_BENCHMARKS
+SITAPI RGLBenchmarkConfig RGL_GetDefaultBenchmarkConfig(void);              // Gets the standard benchmark setup (fixed seed, every scenario, GPU submission on).
+SITAPI int RGL_RunBenchmarks(const RGLBenchmarkConfig* config, RGLBenchmarkResult* out_results, int max_results); // Renders the fixed-seed scenarios outside any frame and returns how many results were written.
+SITAPI size_t RGL_FormatBenchmarkReport(const RGLBenchmarkResult* results, int count, char* buf, size_t buf_size); // Writes results as a text table; returns the full length like snprintf.
+#endif // RGL_ENABLE_BENCHMARKS
+//==================================================================================
 // Debug & Calibration Module
 //==================================================================================
 SITAPI void RGL_SetDebugDrawTriggers(bool enabled);                         // Sets whether invisible triggers (junctions, events) are visualized.
@@ -792,6 +1171,12 @@ SITAPI void RGL_DrawLabeledRectangle(SitRectangle rect, const char* label, RGLBi
 #include <math.h>
 #include <stdarg.h> // For va_list, va_start, va_end
 #include <float.h> // For FLT_EPSILON
+#if !defined(_WIN32)
+    #include <sys/mman.h> // For mmap (binary mesh files); Windows mapping comes from windows.h via situation_api.h
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
 
 #ifndef STB_IMAGE_IMPLEMENTATION
     #define STB_IMAGE_IMPLEMENTATION
@@ -830,6 +1215,45 @@ static inline float _RGL_Clamp01(float value) {
     return RGL_Clamp(value, 0.0f, 1.0f);
 }
 
+// Internal helper to convert a float to an IEEE 754 half float (round-to-nearest, handles subnormals/inf/NaN).
+static inline uint16_t _RGL_FloatToHalf(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint16_t sign = (uint16_t)((bits >> 16) & 0x8000u);
+    uint32_t raw_exp = (bits >> 23) & 0xFFu;
+    uint32_t mantissa = bits & 0x7FFFFFu;
+
+    if (raw_exp == 0xFFu) return sign | 0x7C00u | (mantissa ? 0x200u : 0u); // Inf / NaN
+    int32_t exp = (int32_t)raw_exp - 127 + 15;
+    if (exp >= 31) return sign | 0x7C00u;                                    // Overflow -> Inf
+    if (exp <= 0) {                                                          // Subnormal or zero
+        if (exp < -10) return sign;
+        mantissa |= 0x800000u;
+        uint32_t shift = (uint32_t)(14 - exp);
+        uint16_t half = sign | (uint16_t)(mantissa >> shift);
+        if ((mantissa >> (shift - 1)) & 1u) half++;
+        return half;
+    }
+    uint16_t half = sign | (uint16_t)(exp << 10) | (uint16_t)(mantissa >> 13);
+    if (mantissa & 0x1000u) half++; // Rounding may carry into the exponent, which is still correct.
+    return half;
+}
+
+// Internal helper to encode a direction as an octahedral SNORM16x2 normal (decoded by RGL_VERTEX_SHADER).
+static inline void _RGL_OctEncodeNormal(const vec3 normal, int16_t out_oct[2]) {
+    float l1 = fabsf(normal[0]) + fabsf(normal[1]) + fabsf(normal[2]);
+    if (l1 < 1e-8f) { out_oct[0] = 0; out_oct[1] = 0; return; } // Degenerate -> decodes to +Z
+    float x = normal[0] / l1;
+    float y = normal[1] / l1;
+    if (normal[2] < 0.0f) {
+        float fx = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        float fy = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = fx; y = fy;
+    }
+    out_oct[0] = (int16_t)lrintf(RGL_Clamp(x, -1.0f, 1.0f) * 32767.0f);
+    out_oct[1] = (int16_t)lrintf(RGL_Clamp(y, -1.0f, 1.0f) * 32767.0f);
+}
+
 // --- Internal State and Structs ---
 
 
@@ -847,6 +1271,57 @@ typedef struct {
     float light_levels[4]; // Base light contribution (0.0 to 1.0)
 } RGLInternalDraw;
 
+// A per-thread recording target. Commands are the same records the frame batch holds,
+// so submission is a bulk copy and sorting/vertex generation still happen once, at flush.
+struct RGLCommandList {
+    RGLInternalDraw* commands;
+    size_t command_count;
+    size_t command_capacity;
+};
+
+// Compact sort record for the batcher. The fat RGLInternalDraw array is never moved;
+// only these 16-byte records are sorted, and vertices are gathered through 'index'.
+// Key layout (ascending order == draw order):
+//   [63]     0 = opaque bucket, 1 = alpha bucket (all opaque commands draw first)
+//   Opaque bucket (state first, then front-to-back for early-Z rejection):
+//     [62..32] texture slot_index
+//     [31..1]  z_depth as an order-preserving value, ascending (near first)
+//   Alpha bucket (painter's order, as before):
+//     [62..31] z_depth as an order-preserving uint32, inverted so larger depths sort first (back-to-front)
+//     [30..1]  texture slot_index (groups texture binds within equal depths)
+//   [0]      0 = triangle, 1 = quad (triangles first)
+typedef struct {
+    uint64_t key;
+    uint32_t index;
+    uint32_t _pad;
+} RGLSortKey;
+
+#define RGL_SORT_KEY_ALPHA_BIT (1ull << 63)
+
+// One vertex as stored in the batch VBO. The packed layout more than halves upload bandwidth:
+// normals are octahedral-encoded (exact for the axis-aligned and banked normals RGL produces),
+// UVs are half floats, and color/light come from 8-bit sources anyway.
+#if RGL_PACKED_VERTICES
+typedef struct {
+    float position[3];      // float3
+    int16_t normal_oct[2];  // Octahedral unit normal, SNORM16x2
+    uint16_t tex_coord[2];  // IEEE 754 half2
+    uint8_t color[4];       // UNORM8x4 RGBA
+    uint8_t light_level;    // UNORM8
+    uint8_t _pad;
+    uint16_t texture_index; // Bindless handle table index (0 = untextured); see _RGL_GetBindlessTextureIndex
+} RGLBatchVertex;           // 28 bytes
+#else
+typedef struct {
+    float position[3];
+    float normal[3];
+    float tex_coord[2];
+    float color[4];
+    float light_level;
+    uint32_t texture_index;
+} RGLBatchVertex;           // 56 bytes
+#endif
+
 #define RGL_MATRIX_STACK_DEPTH 10
 
 // This holds a snapshot of the camera state
@@ -871,9 +1346,354 @@ static const RGLPathStyle RGL_DEFAULT_ROAD_STYLE = {
     .user_data = NULL
 };
 
+/** @brief (INTERNAL) One light as laid out in the clustered lighting SSBO (std430). */
+typedef struct {
+    vec4 pos_type;          // .xyz = position (point/spot), .w = type ID
+    vec4 color_intensity;   // .rgb = color, .a = intensity
+    vec4 direction;         // .xyz = direction (directional/spot)
+    vec4 params;            // .x = radius, .y = cos(outer_angle), .z = cos(inner_angle)
+} RGLShaderLight;
+
+/** @brief (INTERNAL) One emitter burst as laid out in the particle burst SSBO (std430). */
+typedef struct {
+    vec4 origin_lifetime;   // .xyz = spawn position, .w = particle lifetime in seconds
+    vec4 velocity_min_rate; // .xyz = velocity_range_min, .w = spawn rate (0 = all at once)
+    vec4 velocity_max;      // .xyz = velocity_range_max
+    vec4 gravity;           // .xyz = gravity_direction (an acceleration, not normalized)
+    vec4 tint_start;
+    vec4 tint_end;
+    vec4 size;              // .xy = size_start, .zw = size_end
+    vec4 uv_rect;           // .xy = UV origin, .zw = UV extent of the sprite's source rect
+} RGLShaderParticleBurst;
+
+/** @brief (INTERNAL) CPU bookkeeping for one burst: which pool slots it owns and what to draw them with. */
+typedef struct {
+    bool active;
+    uint64_t first;     // Position in the emission sequence; pool slot = sequence % capacity
+    uint32_t count;
+    double expire_time; // Particle clock time when its last particle dies
+    RGLTexture texture;
+} RGLParticleBurst;
+
+/** @brief (INTERNAL) One page of the sprite atlas, filled shelf by shelf. */
+typedef struct {
+    RGLTexture texture;
+    int shelf_x;        // Next free X on the current shelf
+    int shelf_y;        // Top of the current shelf
+    int shelf_height;   // Tallest image on the current shelf
+} RGLAtlasPage;
+
+/** @brief (INTERNAL) One laid-out glyph of a text run, relative to the run origin. */
+typedef struct {
+    vec2 offset;    // Top-left corner of the glyph quad
+    vec2 uv_min;
+    vec2 uv_max;
+} RGLGlyphQuad;
+
+/** @brief (INTERNAL) Everything a bitmap-font layout depends on besides the text itself. Zeroed before filling so it can be hashed and memcmp'd. */
+typedef struct {
+    uint32_t atlas_slot;
+    int atlas_width, atlas_height;
+    int char_width, char_height;
+    int chars_per_row;
+    int first_char, char_count;
+    float char_spacing, line_spacing;
+    float box_width, box_height; // Clip box of a RGL_DrawTextBoxed layout; 0 x 0 = unbounded RGL_DrawText layout
+    bool word_wrap;
+} RGLTextLayoutKey;
+
+/** @brief (INTERNAL) A cached layout of one string in one font, emitted straight into the batch. */
+typedef struct {
+    uint64_t hash;          // 0 = empty slot
+    RGLTextLayoutKey key;
+    char* text;             // Owned copy that confirms a hash match
+    size_t text_length;
+    RGLGlyphQuad* quads;
+    size_t quad_count;
+    size_t quad_capacity;
+    float width, height;    // Measured size (what RGL_MeasureText returns for unbounded layouts)
+    uint64_t last_used;     // Cache clock at the latest lookup; the lowest in a probe window is replaced
+} RGLTextRun;
+
+typedef enum {
+    RGL_ASYNC_TEXTURE,
+    RGL_ASYNC_MESH
+} RGLAsyncKind;
+
+#ifdef SITUATION_ENABLE_THREADING
+// Worker-side progress of an async load. Only the worker moves a load out of LOADING and only the
+// render thread moves it into CANCELLED, so one compare-exchange settles which side frees it.
+enum { RGL_ASYNC_DECODING, RGL_ASYNC_DECODED, RGL_ASYNC_DECODE_FAILED, RGL_ASYNC_CANCELLED };
+
+/** @brief (INTERNAL) One in-flight or finished RGL_Load...Async request. Heap-allocated so workers keep a stable pointer. */
+typedef struct RGLAsyncLoad {
+    RGLAssetHandle handle;
+    RGLAsyncKind kind;
+    atomic_int decode_state;    // RGL_ASYNC_DECODING -> DECODED / DECODE_FAILED (worker) or CANCELLED (render thread)
+    RGLAssetState state;        // Render-thread view returned by RGL_GetAssetState
+    bool released;              // RGL_ReleaseAsyncAsset was called; the entry is dropped at the next pump
+    char* filename;
+    bool generate_mipmaps;
+    RGLAssetCallback callback;
+    void* user_data;
+    size_t upload_bytes;        // Size of the GPU upload, charged against the per-frame budget
+    SituationImage image;       // Decoded pixels (texture loads), freed after upload
+    RGLVertex3D* gpu_vertices;  // Interleaved vertices (mesh loads), freed after upload
+    RGLTexture texture;         // Result once READY
+    RGLMesh mesh;               // CPU data once decoded, full mesh once READY
+} RGLAsyncLoad;
+#endif
+
+/**
+ * @brief (INTERNAL) Header of a binary .rglmesh file. All offsets are from the start of the file and
+ * aligned to RGL_MESH_FILE_ALIGNMENT; the blocks are stored in the writer's native (little-endian) layout.
+ */
+typedef struct {
+    uint32_t magic;             // RGL_MESH_FILE_MAGIC
+    uint32_t version;           // RGL_MESH_FILE_VERSION
+    uint32_t flags;             // Reserved, 0
+    uint32_t vertex_stride;     // sizeof(RGLVertex3D) of the writer; must match the reader
+    uint32_t vertex_count;
+    uint32_t index_count;
+    int64_t source_mod_time;    // Modification time of the .obj it was converted from, 0 if none
+    uint64_t interleaved_offset;// RGLVertex3D[vertex_count], handed to SituationCreateMesh as-is
+    uint64_t vertices_offset;   // vec3[vertex_count]
+    uint64_t texcoords_offset;  // vec2[vertex_count]
+    uint64_t normals_offset;    // vec3[vertex_count]
+    uint64_t indices_offset;    // uint32_t[index_count]
+    uint64_t adjacency_offset;  // uint32_t[index_count / 3 * 6], 0 if the adjacency was not stored
+    uint64_t file_size;         // Total size, checked against the mapping to catch truncated files
+} RGLMeshFileHeader;
+
+/** @brief (INTERNAL) A read-only memory mapping of a whole file. */
+typedef struct {
+    const unsigned char* data;
+    size_t size;
+#if defined(_WIN32)
+    HANDLE file;
+    HANDLE mapping;
+#endif
+} RGLMappedFile;
+
+/** @brief (INTERNAL) A mesh re-uploaded in the RGLBatchVertex format so the main shader can instance it. */
+typedef struct {
+    const void* key;        // The source mesh's cpu_vertices; shared by every copy of the RGLMesh
+    int vertex_count;       // Guards against a freed mesh's address being reused
+    GLuint vao, vbo, ibo;
+    GLsizei index_count;
+} RGLInstanceGeometry;
+
+/** @brief (INTERNAL) One instance in the instance SSBO (std430 layout of the shader's Instance struct). */
+typedef struct {
+    mat4 model;             // Billboards store their center in model[3] and their size in model[0].xy
+    vec4 tint;
+} RGLInstanceData;
+
+// Quad layers of a GPU road draw (u_road_layers).
+#define RGL_GPU_ROAD_LAYER_SURFACE   1u
+#define RGL_GPU_ROAD_LAYER_SHOULDERS 2u
+#define RGL_GPU_ROAD_LAYER_LINES     4u
+#define RGL_GPU_ROAD_LAYER_SPLIT     8u
+#define RGL_GPU_ROAD_LAYER_ALL       15u
+
+/** @brief (INTERNAL) A run of GPU road segments queued for the next flush (see RGL_GetGPURoadStyle). */
+typedef struct {
+    GLuint sample_ssbo;     // The path's buffers at queue time (bindings 11 and 12)
+    GLuint point_ssbo;
+    vec4 params;            // u_road: .x = base Z, .y = Z of sample 0, .z = sample spacing, .w = sample count
+    vec2 loop;              // u_road_loop: .x = loop_to_z (negative = no loop), .y = Z of the last control point
+    uint32_t window_segments; // Segments in the whole window; vertex order runs from its far end
+    uint32_t first_segment; // This draw's run within the window
+    uint32_t segment_count;
+    uint32_t layers;        // RGL_GPU_ROAD_LAYER_* bits drawn
+    bool bindless;          // Textures come from the per-point handle indices instead of the bound texture
+} RGLGPURoadDraw;
+
+/** @brief (INTERNAL) One instanced draw queued for the next flush. */
+typedef struct {
+    int mode;               // u_instance_mode: 1 = mesh, 2 = billboard, 3 = GPU road, 4 = Y-locked billboard
+    int geometry;           // Index into RGL.instancing.geometry, -1 for the billboard quad
+    RGLTexture texture;
+    vec4 uv_rect;           // Offset (xy) and scale (zw) applied to the geometry's texcoords
+    uint32_t first_instance;
+    uint32_t instance_count;
+    bool blend;
+    const RGLDrawList* draw_list; // Replays a retained draw list instead of geometry (see RGL_DrawDrawList)
+    RGLGPURoadDraw road;    // Mode 3 only
+} RGLInstancedDraw;
+
+/** @brief (INTERNAL) One run of a draw list's index buffer that shares a texture and an opacity bucket. */
+typedef struct {
+    uint32_t first_index;
+    uint32_t index_count;
+    RGLTexture texture;     // Bound when the replay is not bindless
+    uint16_t texture_index; // Bindless index baked into the range's vertices (0 = none)
+    bool blend;             // Alpha bucket; every opaque range comes first
+} RGLDrawListRange;
+
+// A retained layer. Recording reuses the command list path; RGL_EndDrawList sorts and assembles the
+// commands exactly like a flush would, once, and keeps the vertices in static buffers that a replay
+// draws in the instanced mesh mode, so its transform is a single instance.
+struct RGLDrawList {
+    RGLCommandList recording;       // Commands captured between RGL_BeginDrawList and RGL_EndDrawList
+    RGLInstanceGeometry geometry;   // Static VAO/VBO/IBO of the assembled vertices
+    RGLDrawListRange* ranges;       // In sort order, contiguous in the index buffer
+    size_t range_count;
+    size_t range_capacity;
+    bool bindless;                  // Every textured vertex carries a bindless handle index
+    uint32_t bindless_generation;   // RGL.bindless.table_generation once the indices were baked
+    bool valid;
+};
+
+#ifdef RGL_ENABLE_BENCHMARKS
+/** @brief (INTERNAL) One pre-generated benchmark sprite, so the measured frames spend no time on random numbers. */
+typedef struct {
+    vec3 position;
+    vec2 size;
+    float rotation_deg;
+    Color color;
+    int sprite;                 // Index into RGLBenchmarkScene.sprites
+} RGLBenchmarkSprite;
+
+/** @brief (INTERNAL) Everything the benchmark scenarios share while RGL_RunBenchmarks runs. */
+typedef struct {
+    const RGLBenchmarkConfig* config;
+    uint32_t random_state;
+    RGLTexture textures[3];
+    RGLSprite sprites[4];       // [0] untextured, then one per texture
+    RGLBenchmarkSprite* items;  // Sprite field, or the light scenario's casters
+    int item_count;
+    int draw_distance;          // Path scenario variant being measured
+    float level_extent;         // Side length of the generated level
+    int* light_ids;
+    int light_count;
+    RGLMesh caster_mesh;
+} RGLBenchmarkScene;
+#endif // RGL_ENABLE_BENCHMARKS
+
+/** @brief (INTERNAL) Inclusive range of light clusters touched by one light's bounding sphere. */
+typedef struct {
+    int16_t min_x, max_x;
+    int16_t min_y, max_y;
+    int16_t min_z, max_z;
+} RGLLightClusterBounds;
+
+/**
+ * @brief (INTERNAL) Path curve pre-evaluated every RGL_PATH_SAMPLE_SPACING units of Z, stored as
+ * parallel arrays. All arrays live in one allocation owned by `x_offset`.
+ */
+typedef struct {
+    float* x_offset;
+    float* y_offset;
+    float* roll_degrees;
+    float* ribbon_width;
+    float* split_offset;
+    float* split_width;
+    float* rumble_width;
+    int32_t* point_index;   // Control point (the segment's p1) whose appearance the sample inherits
+    size_t count;
+    size_t capacity;
+    float start_z;          // Z of sample 0, the first control point
+    bool valid;             // Cleared by any edit to the control points; set again only on the render thread
+} RGLPathSamples;
+
+/** @brief (INTERNAL) One path sample as laid out in the GPU road's sample SSBO (std430 RoadSample). */
+typedef struct {
+    float geometry[4];      // x_offset, y_offset, roll_degrees, ribbon_width
+    float extra[3];         // split_offset, split_width, rumble_width
+    int32_t point_index;
+} RGLGPURoadSample;
+
+/** @brief (INTERNAL) One control point's appearance as laid out in the GPU road's point SSBO (std430 RoadPoint). */
+typedef struct {
+    float surface_uv[4];    // u1, v1, u2, v2 of the surface sprite
+    float split_uv[4];
+    uint32_t colors[4];     // RGBA8: surface, rumble, lines, split surface
+    uint32_t info[4];       // .x = primary lanes, .y / .z = bindless index of the surface / split texture
+} RGLGPURoadPoint;
+
+/** @brief (INTERNAL) A path's copy of its samples and appearance on the GPU, for the GPU road style. */
+typedef struct {
+    GLuint sample_ssbo;
+    GLuint point_ssbo;
+    bool bindless;          // Every textured point has a bindless handle, so a window is one draw
+    bool single_texture_pair; // Every point shares its surface and split textures, so a window is one run
+    bool valid;             // Cleared whenever the sample cache is rebuilt
+    uint32_t bindless_generation; // RGL.bindless.table_generation when the bindless indices were baked
+} RGLPathGPURoad;
+
+/** @brief (INTERNAL) Per-point appearance of a Path, stored apart from its geometry. */
+typedef struct {
+    RGLSprite surface_texture;
+    Color color_surface;
+    Color color_rumble;
+    Color color_lines;
+    RGLSprite split_surface_texture;
+    Color split_surface_color;
+    int primary_lanes;
+    int split_lanes;
+} RGLPathAppearance;
+
+/** @brief (INTERNAL) Per-point scenery slots and gameplay tag of a Path. */
+typedef struct {
+    RGLScenery left;
+    RGLScenery right;
+    RGLScenery overhead;
+    int32_t user_tag;
+} RGLPathScenery;
+
+/** @brief (INTERNAL) One non-empty scenery slot of a path, with its world position resolved when the index is built. */
+typedef struct {
+    vec3 world_pos;
+    uint32_t point_index;   // Control point holding the scenery
+    uint32_t slot;          // 0 = left, 1 = right, 2 = overhead
+    uint32_t name_hash;     // Event markers: hash of data.event.name, so most lookups skip the string compare
+    int32_t junction;       // Junction triggers: row of RGLSceneryIndex.junction_targets, else -1
+} RGLSceneryAnchor;
+
+/** @brief (INTERNAL) Spatial index of a path's scenery, rebuilt lazily after edits. */
+typedef struct {
+    RGLSceneryAnchor* anchors;      // Every non-empty slot in path order, so world_pos[2] ascends
+    uint32_t* by_type;              // Anchor indices bucketed by type, each bucket in path order
+    uint32_t type_start[RGL_MAX_SCENERY_TYPES + 1]; // Bucket t is by_type[type_start[t] .. type_start[t + 1])
+    size_t anchor_count;
+    int32_t (*junction_targets)[3]; // Left, right, straight destination path indices (-1 = none or not loaded)
+    size_t junction_count;
+    uint32_t topology_version;      // RGL.path_topology_version the junction targets were resolved against
+    bool valid;                     // Cleared by any edit to the control points
+} RGLSceneryIndex;
+
+/** @brief (INTERNAL) One decoded entry of RGLPathSamples. */
+typedef struct {
+    float x_offset;
+    float y_offset;
+    float roll_degrees;
+    float ribbon_width;
+    float split_offset;
+    float split_width;
+    float rumble_width;
+    int32_t point_index;
+} RGLPathSample;
+
 // Holds all data related to the procedural Path system.
+// Control points are split hot/cold: the geometry queries and the road renderer walk only
+// the float arrays, while appearance and scenery live in parallel tables at the same index.
+// RGLPathPoint is only assembled on demand (see _RGL_LoadPathPoint).
 typedef struct {
-    RGLPathPoint* points;
+    // --- Geometry (structure-of-arrays) ---
+    float* world_z;
+    float* x_offset;
+    float* y_offset;
+    float* roll_degrees;
+    float* ribbon_width;
+    float* split_offset;
+    float* split_width;
+    float* rumble_width;
+
+    // --- Appearance and Scenery (parallel tables) ---
+    RGLPathAppearance* appearance;
+    RGLPathScenery* scenery;
+
     size_t num_points;
     size_t capacity;
 
@@ -884,13 +1704,50 @@ typedef struct {
     /** @brief A pointer to the style definition used to render this path. Defaults to the road style. */
     const RGLPathStyle* style;
 
+    RGLPathSamples samples;  // Lazily rebuilt curve cache read by the road renderer and ground queries.
+    RGLSceneryIndex scenery_index; // Lazily rebuilt anchor index read by the scenery, marker and junction queries.
+    RGLPathGPURoad gpu_road; // Uploaded on first draw with the GPU road style.
+    RGLPathLOD lod;          // Read by the road styles when lod_enabled (see RGL_SetPathLOD).
+    bool lod_enabled;
+
 } RGLPathData;
 
+/** @brief (INTERNAL) A far sprite scenery object waiting to be drawn as an impostor quad. */
+typedef struct {
+    RGLSprite sprite;
+    vec3 position;
+    vec2 size;
+    Color tint;
+    float distance;         // Ahead of the player along the path; runs are drawn far to near
+} RGLPathImpostor;
+
 typedef struct {
     char name[32];
     RGLPathData data;
 } RGLNamedPath;
 
+/** @brief (INTERNAL) One virtual display owned by the render-target pool. */
+typedef struct {
+    bool occupied;          // Zeroed state = empty pool
+    int display_id;
+    int width, height;      // Pool key: Situation virtual displays have one color format, so size is the whole key
+    bool in_use;            // Between acquire and release
+    double released_time;   // SituationTimerGetTime() at release, for idle trimming
+} RGLRenderTargetSlot;
+
+/** @brief (INTERNAL) A malloc'd block for a frame arena request that did not fit. Blocks form a stack so a rewind frees those taken after its mark. */
+typedef struct RGLFrameArenaBlock {
+    struct RGLFrameArenaBlock* next;
+    size_t size;            // Bytes requested, for the frame's peak
+} RGLFrameArenaBlock;
+
+/** @brief (INTERNAL) A frame arena position, taken by _RGL_FrameArenaMark and restored by _RGL_FrameArenaRewind. */
+typedef struct {
+    size_t offset;
+    RGLFrameArenaBlock* overflow;
+    size_t overflow_bytes;
+} RGLFrameArenaMark;
+
 typedef struct {
     SituationShader main_shader;
     GLint loc_view;
@@ -904,41 +1761,192 @@ typedef struct {
     GLint loc_shadow_projection;
     GLint loc_shadow_texture;
     GLint loc_shadow_tint;
+    GLuint blob_shadow_vao; // One streamed quad (position + uv) for RGL_DrawSpriteDownwardShadow; never the batch buffers.
+    GLuint blob_shadow_vbo;
+    GLuint blob_shadow_ibo;
 
     // --- Stencil Shadow State ---
-    SituationShader shadow_volume_shader;
+    GLuint shadow_volume_program; // VS + GS: extrudes silhouette edges from GL_TRIANGLES_ADJACENCY input.
     GLint loc_sv_view;
     GLint loc_sv_projection;
+    GLint loc_sv_model;
+    GLint loc_sv_light_pos;
+    GLint loc_sv_extrusion_length;
+    GLuint shadow_stream_vao; // Streams temporary casters (e.g. sprite quads) that have no cached shadow buffers.
+    GLuint shadow_stream_vbo;
+    GLuint shadow_stream_ibo;
+    unsigned int* shadow_scratch_adjacency; // Adjacency built per call for temporary casters.
+    size_t shadow_scratch_capacity;         // In indices.
+    struct {
+        bool active;          // Inside RGL_BeginStencilShadows / RGL_EndStencilShadows.
+        Color color;          // Darken color applied once at the end of the pass.
+        int caster_count;     // Casters drawn into the stencil this pass; 0 skips the darken pass.
+    } stencil_pass;
+
+    // --- Bindless texture table (SSBO binding 9, see _RGL_GetBindlessTextureIndex) ---
+    struct {
+        bool enabled;                                  // GL_ARB_bindless_texture present and RGL_BINDLESS_TEXTURES set
+        GLuint handle_ssbo;
+        GLint loc_enabled;                             // u_bindless on the main shader
+        uint64_t handles[RGL_MAX_BINDLESS_TEXTURES];   // CPU copy of the table; [0] stays 0 (untextured)
+        uint32_t slots[RGL_MAX_BINDLESS_TEXTURES];     // Texture slot owning each index (0 = free)
+        uint32_t generations[RGL_MAX_BINDLESS_TEXTURES];
+        uint32_t free_indices[RGL_MAX_BINDLESS_TEXTURES];
+        uint32_t free_count;
+        uint32_t count;                                // One past the highest index handed out
+        uint16_t* slot_to_index;                       // Texture slot -> table index (0 = not resident)
+        size_t slot_map_capacity;
+        uint32_t dirty_begin, dirty_end;               // Table range to upload at the next flush
+        uint32_t table_generation;                     // Bumped whenever an index is freed; baked indices recheck on change
+    } bindless;
+
+    // --- Hardware instancing (SSBO binding 10, see RGL_DrawMeshInstanced) ---
+    struct {
+        RGLInstanceGeometry* geometry;   // Batch-format copies of every mesh drawn instanced, kept until RGL_DestroyMesh
+        size_t geometry_count;
+        size_t geometry_capacity;
+        RGLInstanceGeometry quad;        // Unit quad shared by instanced billboards
+        RGLInstanceData* instances;      // This flush's instances, uploaded in one transfer
+        size_t instance_count;
+        size_t instance_capacity;
+        RGLInstancedDraw* draws;         // This flush's instanced draws, in submission order
+        size_t draw_count;
+        size_t draw_capacity;
+        GLuint instance_ssbo;
+        GLint loc_mode;                  // u_instance_mode / u_instance_base / u_instance_uv_rect on the main shader
+        GLint loc_base;
+        GLint loc_uv_rect;
+        GLuint road_vao;                 // Attribute-less VAO for the GPU road, whose vertices come from gl_VertexID
+        GLint loc_road;                  // u_road / u_road_loop / u_road_segments / u_road_layers
+        GLint loc_road_loop;
+        GLint loc_road_segments;
+        GLint loc_road_layers;
+    } instancing;
+
+    // --- Sprite atlas pages (see RGL_AddImageToAtlas) ---
+    struct {
+        RGLAtlasPage* pages;
+        size_t page_count;
+        size_t page_capacity;
+    } atlas;
+
+    // --- Bitmap-font text run cache (see _RGL_GetTextRun) ---
+    RGLTextRun text_runs[RGL_TEXT_RUN_CACHE_SIZE];
+    uint64_t text_run_clock;
 
     SituationShader shadow_darken_shader;
     GLint loc_sd_shadow_color;
     GLuint fullscreen_quad_vao;
 
+    // --- Retro post-process (RGL_ApplyRetroEffects); created on first use ---
+    struct {
+        bool initialized;
+        GLuint program;
+        GLuint frame_texture;       // Copy of the target the pass reads from
+        int frame_width, frame_height;
+        GLuint encode_lut;          // RGB -> (Y, chroma cos, chroma sin), baked from SituationColorToYPQ
+        GLuint decode_lut;          // (P, Y, Q) -> RGB, baked from SituationColorFromYPQ; P repeats
+        GLuint palette_lut;         // RGB -> closest palette color, rebuilt when the palette changes
+        uint32_t palette_hash;
+        int palette_size;
+        GLint loc_frame, loc_encode_lut, loc_decode_lut, loc_palette_lut, loc_lut_sizes;
+        GLint loc_scanline, loc_ghost, loc_signal, loc_use_palette, loc_origin;
+    } retro;
+
     // --- Shader locations for lighting ---
     GLint loc_camera_pos;
     GLint loc_ambient_light_color;
-    GLint loc_active_lights;
     GLint loc_light_pos;
     GLint loc_light_color;
     GLint loc_light_radius;
     GLint loc_light_intensity;
-    GLuint light_ubo;
 
     // --- Light management system ---
     RGLLight lights[RGL_MAX_LIGHTS];
     vec3 ambient_light_color;
     ma_mutex light_mutex;
+    uint32_t light_version;   // Bumped (under light_mutex) by every light create/destroy/setter
+    int light_slot_count;     // One past the highest slot in use; bounds the per-flush light scans
+
+    // --- Clustered light grid (SSBO bindings: 2 = lights, 3 = clusters, 4 = light indices) ---
+    struct {
+        GLuint light_ssbo;
+        GLuint cluster_ssbo;
+        GLuint index_ssbo;
+        RGLShaderLight* lights;        // Visible lights in GPU layout, directional lights first
+        RGLLightClusterBounds* bounds; // Cluster range covered by each visible point/spot light
+        uint32_t* clusters;            // (first index, count) pair per cluster
+        uint32_t* indices;             // Light indices grouped by cluster
+        size_t index_capacity;
+        float z_scale, z_bias;         // Depth slice = log(view depth) * z_scale + z_bias
+        // The grid is rebuilt only when the lights or the view it was built for change.
+        bool built;
+        uint32_t built_version;
+        mat4 built_view;
+        mat4 built_projection;
+        GLint built_viewport[4];
+        int built_directional_count;
+        GLint loc_directional_lights;
+        GLint loc_cluster_dims;
+        GLint loc_cluster_viewport;
+        GLint loc_cluster_z_params;
+    } light_clusters;
+
+    // --- GPU particles (SSBO bindings: 5 = position/age, 6 = velocity, 7 = burst index, 8 = bursts) ---
+    // Particle state never leaves the GPU. The CPU only tracks bursts: emission is one compute
+    // dispatch per burst, simulation one per frame, and drawing one instanced draw per burst.
+    struct {
+        bool initialized;
+        uint32_t capacity;
+        uint64_t emitted_total;        // Particles ever emitted; the pool is a ring over this sequence
+        double time;                   // Sum of RGL_UpdateParticles deltas
+        uint32_t seed;
+        GLuint position_ssbo;
+        GLuint velocity_ssbo;
+        GLuint burst_index_ssbo;
+        GLuint burst_ssbo;
+        GLuint vao;                    // Attribute-less; quads come from gl_VertexID
+        SituationComputePipeline emit_pipeline;
+        SituationComputePipeline simulate_pipeline;
+        GLuint draw_program;
+        RGLParticleBurst bursts[RGL_MAX_PARTICLE_BURSTS];
+        int next_burst;
+        GLint loc_emit_first, loc_emit_count, loc_emit_capacity, loc_emit_burst, loc_emit_seed;
+        GLint loc_sim_count, loc_sim_dt;
+        GLint loc_draw_view, loc_draw_projection, loc_draw_first, loc_draw_capacity, loc_draw_texture;
+    } particles;
 
     GLuint batch_vao;
     GLuint batch_vbo;
+    GLuint batch_ibo;         // Static quad index buffer {0,1,2, 0,2,3} + 4n, bound to batch_vao
     GLint default_fbo;
 
     RGLInternalDraw* commands;
     size_t command_count;
     size_t command_capacity;
 
-    float* cpu_vertex_buffer;
-    size_t cpu_vertex_buffer_floats_capacity;
+    // Internal lists used by RGL_RecordParallel, one per job, reused across frames.
+    RGLCommandList** parallel_lists;
+    int parallel_list_count;
+    RGLDrawList* recording_draw_list; // Between RGL_BeginDrawList and RGL_EndDrawList
+
+    RGLSortKey* sort_keys;         // (key, index) records built per flush, sized to command_capacity
+    RGLSortKey* sort_keys_scratch; // Ping-pong buffer for the radix sort passes
+
+    RGLBatchVertex* cpu_vertex_buffer; // Fallback staging buffer; only allocated if the persistent ring could not be mapped
+    size_t batch_vertex_capacity;      // Vertices one full batch can hold
+
+    // --- Persistent-mapped vertex ring ---
+    // batch_vbo is immutable storage mapped once for the lifetime of the buffer. The batcher writes
+    // vertices straight into the current segment; each segment is fenced when we move off it and
+    // waited on only when the ring wraps back around, so flushes never stall on glBufferSubData.
+    struct {
+        RGLBatchVertex* mapped;       // Base of the mapped buffer (NULL -> fallback path)
+        size_t segment_vertices;      // Vertices per segment; one segment always holds a full batch
+        size_t write_offset_vertices; // Next free vertex within the current segment
+        int segment;                // Segment currently being written
+        GLsync fences[RGL_VERTEX_RING_SEGMENTS];
+    } vertex_ring;
 
     mat4 current_projection_matrix;
     mat4 current_view_matrix;
@@ -964,16 +1972,79 @@ typedef struct {
     size_t Path_count;
     size_t Path_capacity;
     int active_Path_index; // The index of the Path we are currently on. -1 if none.
+    uint32_t path_topology_version; // Bumped when a path is created or destroyed; scenery indices re-resolve junction targets
+
+    // Far sprite scenery gathered while a window's scenery is drawn, then grouped by sprite into instanced draws (see RGLPathLOD)
+    struct {
+        RGLPathImpostor* items;
+        size_t count;
+        size_t capacity;
+        vec3* positions;            // One sprite's run, in the layout RGL_DrawBillboardInstanced takes
+        vec2* sizes;
+        Color* tints;
+        size_t run_capacity;
+    } path_impostors;
 
     RGLLevel* levels; // Array of levels
     size_t level_count;
     size_t level_capacity;
     int active_level_index; // Current level for drawing
+    RGLQueuedLevel* static_level_queue; // Levels queued by RGL_DrawLevel; their cached geometry is drawn at the next flush
+    size_t static_level_queue_count;
+    size_t static_level_queue_capacity;
+    uint32_t* static_level_visibility;  // Visible-cell masks of the queued calls; restarts when the queue is empty
+    size_t static_level_visibility_count; // In 32-bit words
+    size_t static_level_visibility_capacity;
 
     RGLMesh* meshes;
     size_t mesh_count;
     size_t mesh_capacity;
 
+    // --- Render-target pool and dynamic resolution ---
+    RGLRenderTargetSlot render_targets[RGL_RENDER_TARGET_POOL_SIZE];
+    struct {
+        bool enabled;
+        RGLDynamicResolution settings;
+        float scale;
+        float average_frame_ms;     // Exponential average of the frame times fed to RGL_UpdateDynamicResolution
+        int frames_since_change;
+        float work_ms;              // RGL_Begin to RGL_End time summed since the last update (the default input)
+        double work_begin_time;     // SituationTimerGetTime() at the open RGL_Begin
+        // GL_TIMESTAMP begin/end pairs per RGL_Begin/RGL_End, one set per frame in flight (independent of the profiler).
+        GLuint gpu_queries[RGL_PROFILE_GPU_LATENCY][RGL_DYNAMIC_RES_MAX_PASSES][2];
+        int gpu_pass_count[RGL_PROFILE_GPU_LATENCY]; // Closed pairs in each set
+        uint64_t gpu_query_frame[RGL_PROFILE_GPU_LATENCY]; // Update index + 1 whose passes a set holds; 0 = none
+        uint64_t frame_counter;     // RGL_UpdateDynamicResolution calls; the open frame records into set frame_counter % latency
+        bool gpu_pass_open;         // A begin timestamp was issued by the open RGL_Begin
+        bool gpu_queries_created;
+        float gpu_ms;               // GPU time of the newest resolved frame (0 until one resolves)
+        uint64_t gpu_ms_frame;      // Update index + 1 that gpu_ms belongs to
+        RGLTexture target;          // Pooled world display at the current scale, when has_target
+        bool has_target;
+    } dynamic_resolution;
+
+    // --- Per-frame scratch arena (render thread only, see _RGL_FrameAlloc) ---
+    struct {
+        uint8_t* base;
+        size_t capacity;
+        size_t offset;                  // Bytes handed out from base since the last reset or rewind
+        RGLFrameArenaBlock* overflow;   // Requests that did not fit (or came outside a frame), newest first; freed by rewind or reset
+        size_t overflow_bytes;
+        size_t recent_peaks[RGL_FRAME_ARENA_WINDOW]; // frame_arena_used of the last frames, a ring written at RGL_Begin
+        int recent_index;
+    } frame_arena;
+
+    // --- Asynchronous asset streaming ---
+    struct {
+        struct RGLAsyncLoad** loads;    // In request order; the upload pump walks it first-in first-out
+        size_t count;
+        size_t capacity;
+        RGLAssetHandle next_handle;
+        size_t upload_budget;           // Bytes uploaded per frame; 0 = RGL_ASYNC_UPLOAD_BUDGET
+        RGLTexture placeholder_texture; // Created on first async request
+        RGLMesh placeholder_mesh;
+    } async;
+
         // --- Performance pathing and debug state ---
     struct {
         uint64_t frames_rendered;
@@ -981,15 +2052,40 @@ typedef struct {
         uint64_t total_vertices_drawn;
         uint64_t batch_flushes;
         uint64_t memory_reallocations;
+        uint64_t vertex_ring_stalls; // Times the CPU had to wait on the GPU before reusing a ring segment
         float last_frame_time_ms;
         float avg_draw_calls_per_frame;
         float avg_vertices_per_frame;
         float avg_batch_efficiency;
         int active_lights_per_frame;
         float light_ubo_upload_time_ms;
+        int light_cluster_rebuilds;
         int downward_shadows_drawn;
         int stencil_volumes_drawn;
+        int text_runs_built;
+        size_t async_bytes_uploaded;
+        int commands_flushed;
+        size_t bytes_uploaded;
+        size_t frame_arena_used;
+        size_t frame_arena_high_water;
     } stats;
+#ifdef RGL_ENABLE_BENCHMARKS
+    bool benchmark_cpu_only; // Set by RGL_RunBenchmarks in cpu_only mode: flushes stop before any GPU submission
+#endif // RGL_ENABLE_BENCHMARKS
+
+    // --- Frame profiler ---
+    struct {
+        bool enabled;
+        bool frame_open;                // Between RGL_Begin and RGL_End of a profiled frame
+        RGLFrameProfile* frames;        // Ring of RGL_PROFILE_FRAME_HISTORY records, allocated on first enable
+        uint64_t frame_counter;         // Completed frames; the open frame records into frames[frame_counter % history]
+        double frame_start_time;        // SituationTimerGetTime() at the open frame's RGL_Begin
+        int depth;                      // Open zones, including unrecorded ones past RGL_PROFILE_MAX_DEPTH
+        int stack[RGL_PROFILE_MAX_DEPTH]; // Zone index per open level; -1 for a dropped zone
+        // GL_TIMESTAMP queries, one set per frame in flight: [0] frame begin, [1] frame end, then begin/end per zone.
+        GLuint queries[RGL_PROFILE_GPU_LATENCY][2 + RGL_PROFILE_MAX_ZONES * 2];
+        uint64_t query_frame[RGL_PROFILE_GPU_LATENCY]; // Frame index + 1 whose results a set holds; 0 = none
+    } profiler;
 
     struct {
         // Wireframe rendering state
@@ -1009,128 +2105,291 @@ typedef struct {
 
 static RGLState RGL;
 
+// The command list the calling thread records into, or NULL to write the frame batch directly.
+static RGL_THREAD_LOCAL RGLCommandList* g_rgl_recording_list = NULL;
+
 // --- Shader Source ---
+// The normal attribute depends on the batch vertex format (see RGLBatchVertex).
+#if RGL_PACKED_VERTICES
+#define RGL_VS_NORMAL_ATTRIBUTE "layout (location = 1) in vec2 aNormalOct;\n"
+#define RGL_VS_NORMAL_HELPERS \
+    "vec3 rgl_oct_decode(vec2 e) {\n" \
+    "    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));\n" \
+    "    if (n.z < 0.0) n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);\n" \
+    "    return normalize(n);\n" \
+    "}\n"
+#define RGL_VS_NORMAL_DECODE "    vec3 normal = rgl_oct_decode(aNormalOct);\n"
+#else
+#define RGL_VS_NORMAL_ATTRIBUTE "layout (location = 1) in vec3 aNormal;\n"
+#define RGL_VS_NORMAL_HELPERS ""
+#define RGL_VS_NORMAL_DECODE "    vec3 normal = normalize(aNormal);\n"
+#endif
+
+// Host constants the vertex shader shares, spliced into its source so the two cannot drift apart.
+#define RGL_SHADER_STRINGIFY_(x) #x
+#define RGL_SHADER_STRINGIFY(x) RGL_SHADER_STRINGIFY_(x)
+#define RGL_VS_ROAD_CONSTANTS "const uint ROAD_QUADS_PER_SEGMENT = uint(" RGL_SHADER_STRINGIFY(RGL_GPU_ROAD_QUADS_PER_SEGMENT) ");\n"
+
 static const char* RGL_VERTEX_SHADER =
-    "#version 330 core\n"
+    "#version 430 core\n"
     // -- Vertex Attributes --
     "layout (location = 0) in vec3 aPos;\n"
-    "layout (location = 1) in vec3 aNormal;\n"
+    RGL_VS_NORMAL_ATTRIBUTE
     "layout (location = 2) in vec2 aTexCoord;\n"
     "layout (location = 3) in vec4 aColor;\n"
     "layout (location = 4) in float aBaseLightLevel;\n"
+    "layout (location = 5) in uint aTexIndex;\n"
 
     // -- Outputs to Fragment Shader --
+    "flat out uint vTexIndex;\n"
     "out vec2 vTexCoord;\n"
     "out vec4 vColor;\n"
-    "out vec3 vLightColor;\n"
+    "out vec3 vWorldPos;\n"
+    "out vec3 vNormal;\n"
+    "out float vBaseLightLevel;\n"
+    "out float vViewDepth;\n"
 
     // -- Standard Uniforms --
     "layout (std140, binding = 1) uniform ViewData {\n"
     "    mat4 view;\n"
     "    mat4 projection;\n"
     "};\n"
-    "uniform vec3 u_camera_pos;\n"
 
-    // -- Global Lighting Uniforms --
-    "uniform vec3 u_ambient_light_color;\n"
-    "uniform int u_active_lights;\n"
-
-    // -- UBO for Unified Light Data --
-    "#define MAX_LIGHTS 16\n"
-    "#define LIGHT_TYPE_POINT 1\n"
-    "#define LIGHT_TYPE_DIRECTIONAL 2\n"
-    "#define LIGHT_TYPE_SPOT 3\n"
-    "layout(std140, binding = 0) uniform LightBlock {\n"
-    "    // .xyz = position (point/spot), .w = type ID\n"
-    "    vec4 u_light_pos_type[MAX_LIGHTS];\n"
-    "    // .rgb = color, .a = intensity\n"
-    "    vec4 u_light_color_intensity[MAX_LIGHTS];\n"
-    "    // .xyz = direction (directional/spot)\n"
-    "    vec4 u_light_direction[MAX_LIGHTS];\n"
-    "    // .x=radius, .y=cos(outer_angle), .z=cos(inner_angle)\n"
-    "    vec4 u_light_params[MAX_LIGHTS];\n"
+    // -- Hardware Instancing (RGL_DrawMeshInstanced / RGL_DrawBillboardInstanced / RGL_DrawBillboardCylindricalYInstanced) --
+    "uniform int u_instance_mode;        // 0 = batch vertices, 1 = instanced mesh, 2 = instanced billboard, 3 = GPU road, 4 = instanced Y-locked billboard\n"
+    "uniform uint u_instance_base;       // First instance of this draw in the instance buffer\n"
+    "uniform vec4 u_instance_uv_rect;    // .xy = offset, .zw = scale applied to instanced texcoords\n"
+    "struct Instance {\n"
+    "    mat4 model;                     // Billboards: model[3].xyz = center, model[0].xy = size\n"
+    "    vec4 tint;\n"
     "};\n"
-
+    "layout (std430, binding = 10) readonly buffer InstanceBuffer { Instance u_instances[]; };\n"
+
+    // -- GPU Road (u_instance_mode 3, see RGL_GetGPURoadStyle): RGL_GPU_ROAD_QUADS_PER_SEGMENT quads per segment from gl_VertexID --
+    RGL_VS_ROAD_CONSTANTS
+    "uniform vec4 u_road;                // .x = base Z, .y = Z of sample 0, .z = sample spacing, .w = sample count\n"
+    "uniform vec2 u_road_loop;           // .x = loop_to_z (negative = no loop), .y = Z of the last control point\n"
+    "uniform uint u_road_segments;       // Segments in the window; vertex order runs from its far end\n"
+    "uniform uint u_road_layers;         // 1 = surface, 2 = shoulders, 4 = lane lines, 8 = split\n"
+    "struct RoadSample {\n"
+    "    vec4 geometry;                  // x_offset, y_offset, roll_degrees, ribbon_width\n"
+    "    vec3 extra;                     // split_offset, split_width, rumble_width\n"
+    "    int point_index;\n"
+    "};\n"
+    "struct RoadPoint {\n"
+    "    vec4 surface_uv;                // u1, v1, u2, v2\n"
+    "    vec4 split_uv;\n"
+    "    uvec4 colors;                   // RGBA8: surface, rumble, lines, split surface\n"
+    "    uvec4 info;                     // .x = primary lanes, .y / .z = bindless surface / split texture\n"
+    "};\n"
+    "layout (std430, binding = 11) readonly buffer RoadSampleBuffer { RoadSample u_road_samples[]; };\n"
+    "layout (std430, binding = 12) readonly buffer RoadPointBuffer { RoadPoint u_road_points[]; };\n"
+    "RoadSample road_sample(float z) {  // _RGL_SamplePathAt\n"
+    "    float loop_length = u_road_loop.y - u_road_loop.x;\n"
+    "    if (u_road_loop.x >= 0.0 && z > u_road_loop.y && loop_length > 0.001) z = mod(z - u_road_loop.x, loop_length) + u_road_loop.x;\n"
+    "    float f = clamp((z - u_road.y) / u_road.z, 0.0, u_road.w - 1.0);\n"
+    "    uint i = uint(f);\n"
+    "    uint j = min(i + 1u, uint(u_road.w) - 1u);\n"
+    "    RoadSample s = u_road_samples[i];\n"
+    "    s.geometry = mix(s.geometry, u_road_samples[j].geometry, f - float(i));\n"
+    "    s.extra = mix(s.extra, u_road_samples[j].extra, f - float(i));\n"
+    "    return s;\n"
+    "}\n"
+    "bool road_stripe(float z, float period) { return (abs(int(z / period)) & 1) == 0; }\n"
+    "bool expand_road(out vec3 world_pos, out vec2 tex_coord, out vec4 color, out vec3 normal, out uint tex_index) {\n"
+    "    const uint corner[6] = uint[6](0u, 1u, 2u, 0u, 2u, 3u); // Batch quad order: near right, near left, far left, far right\n"
+    "    uint vertex = uint(gl_VertexID);\n"
+    "    uint quad = (vertex / 6u) % ROAD_QUADS_PER_SEGMENT;\n"
+    "    uint layer = quad == 0u ? 1u : quad <= 2u ? 2u : quad == 3u ? 8u : 4u;\n"
+    "    if ((u_road_layers & layer) == 0u) return false;\n"
+    "    float z_near = u_road.x + float(u_road_segments - 1u - vertex / (ROAD_QUADS_PER_SEGMENT * 6u)) * u_road.z;\n"
+    "    float z_far = z_near + u_road.z;\n"
+    "    RoadSample near_sample = road_sample(z_near);\n"
+    "    RoadSample far_sample = road_sample(z_far);\n"
+    "    RoadPoint look = u_road_points[near_sample.point_index];\n"
+    "    float cn = near_sample.geometry.x, cf = far_sample.geometry.x;\n"
+    "    float hn = near_sample.geometry.w * 0.5, hf = far_sample.geometry.w * 0.5;\n"
+    "    vec4 x;                         // Near left, near right, far left, far right\n"
+    "    vec4 uv = vec4(0.0, 0.0, 1.0, 1.0);\n"
+    "    float lift = 0.0;\n"
+    "    tex_index = 0u;\n"
+    "    if (quad == 0u) {\n"
+    "        x = vec4(cn - hn, cn + hn, cf - hf, cf + hf);\n"
+    "        color = road_stripe(z_near, 10.0) ? unpackUnorm4x8(look.colors.x) : vec4(60.0, 60.0, 60.0, 255.0) / 255.0;\n"
+    "        uv = look.surface_uv; tex_index = look.info.y;\n"
+    "    } else if (quad <= 2u) {\n"
+    "        float w = near_sample.extra.z;\n"
+    "        if (w <= 0.0) return false;\n"
+    "        x = quad == 1u ? vec4(cn - hn - w, cn - hn, cf - hf - w, cf - hf) : vec4(cn + hn, cn + hn + w, cf + hf, cf + hf + w);\n"
+    "        color = road_stripe(z_near, 5.0) ? unpackUnorm4x8(look.colors.y) : vec4(1.0);\n"
+    "    } else if (quad == 3u) {\n"
+    "        if (near_sample.extra.y <= 0.01) return false;\n"
+    "        float sn = cn + near_sample.extra.x, sf = cf + far_sample.extra.x;\n"
+    "        x = vec4(sn - near_sample.extra.y * 0.5, sn + near_sample.extra.y * 0.5, sf - far_sample.extra.y * 0.5, sf + far_sample.extra.y * 0.5);\n"
+    "        color = road_stripe(z_near, 10.0) ? unpackUnorm4x8(look.colors.w) : vec4(50.0, 50.0, 50.0, 255.0) / 255.0;\n"
+    "        uv = look.split_uv; tex_index = look.info.z;\n"
+    "    } else {\n"
+    "        uint line = quad - 3u;\n"
+    "        if (line >= look.info.x || road_stripe(z_near, 4.0)) return false; // Dashed\n"
+    "        float offset = -hn + float(line) * (near_sample.geometry.w / float(look.info.x));\n"
+    "        x = vec4(cn + offset - 0.15, cn + offset + 0.15, cf + offset - 0.15, cf + offset + 0.15);\n"
+    "        color = unpackUnorm4x8(look.colors.z);\n"
+    "        lift = 0.01;\n"
+    "    }\n"
+    "    uint k = corner[vertex % 6u];\n"
+    "    bool far_edge = k >= 2u, right_edge = k == 0u || k == 3u;\n"
+    "    world_pos = vec3(far_edge ? (right_edge ? x.w : x.z) : (right_edge ? x.y : x.x),\n"
+    "                     (far_edge ? far_sample.geometry.y : near_sample.geometry.y) + lift, far_edge ? z_far : z_near);\n"
+    "    tex_coord = vec2(far_edge ? uv.z : uv.x, right_edge ? uv.y : uv.w);\n"
+    "    float roll = radians(near_sample.geometry.z);\n"
+    "    normal = abs(near_sample.geometry.z) < 0.01 ? vec3(0.0, 1.0, 0.0) : vec3(-sin(roll), cos(roll), 0.0);\n"
+    "    return true;\n"
+    "}\n"
+
+    RGL_VS_NORMAL_HELPERS
     "void main() {\n"
-    "    gl_Position = projection * view * vec4(aPos, 1.0);\n"
-    "    vTexCoord = aTexCoord;\n"
-    "    vColor = aColor;\n"
-
-    "    // --- Lighting Calculation --- \n"
     "    vec3 world_pos = aPos;\n"
-    "    vec3 normal = normalize(aNormal);\n"
-    "    vec3 total_light_contrib = u_ambient_light_color * aBaseLightLevel;\n"
-
-    "    for (int i = 0; i < u_active_lights; i++) {\n"
-    "        int light_type = int(u_light_pos_type[i].w);\n"
-    "        vec3 light_color = u_light_color_intensity[i].rgb;\n"
-    "        float intensity = u_light_color_intensity[i].a;\n"
-    "        vec3 diffuse_color = vec3(0.0);\n"
-
-    "        if (light_type == LIGHT_TYPE_POINT) {\n"
-    "            vec3 light_pos = u_light_pos_type[i].xyz;\n"
-    "            float radius = u_light_params[i].x;\n"
-    "            vec3 light_dir = light_pos - world_pos;\n"
-    "            float dist = length(light_dir);\n"
-    "            if (dist < radius) {\n"
-    "                light_dir = normalize(light_dir);\n"
-    "                float attenuation = 1.0 - smoothstep(0.8, 1.0, dist / radius);\n"
-    "                attenuation /= (1.0 + 0.1*dist + 0.05*dist*dist);\n"
-    "                float diff = max(dot(normal, light_dir), 0.0);\n"
-    "                diffuse_color = diff * light_color * intensity * attenuation;\n"
-    "            }\n"
-    "        } else if (light_type == LIGHT_TYPE_DIRECTIONAL) {\n"
-    "            vec3 light_dir = normalize(u_light_direction[i].xyz);\n"
-    "            float diff = max(dot(normal, -light_dir), 0.0);\n"
-    "            diffuse_color = diff * light_color * intensity;\n"
-    "        } else if (light_type == LIGHT_TYPE_SPOT) {\n"
-    "            vec3 light_pos = u_light_pos_type[i].xyz;\n"
-    "            float radius = u_light_params[i].x;\n"
-    "            vec3 light_to_frag = light_pos - world_pos;\n"
-    "            float dist = length(light_to_frag);\n"
-    "            if (dist < radius) {\n"
-    "                vec3 light_to_frag_norm = normalize(light_to_frag);\n"
-    "                vec3 spot_dir = normalize(u_light_direction[i].xyz);\n"
-    "                float theta = dot(light_to_frag_norm, -spot_dir);\n"
-    "                float cos_outer = u_light_params[i].y;\n"
-    "                float cos_inner = u_light_params[i].z;\n"
-    "                if (theta > cos_outer) {\n"
-    "                    float spot_effect = smoothstep(cos_outer, cos_inner, theta);\n"
-    "                    float attenuation = 1.0 - smoothstep(0.8, 1.0, dist / radius);\n"
-    "                    attenuation /= (1.0 + 0.1*dist + 0.05*dist*dist);\n"
-    "                    float diff = max(dot(normal, light_to_frag_norm), 0.0);\n"
-    "                    diffuse_color = diff * light_color * intensity * attenuation * spot_effect;\n"
-    "                }\n"
-    "            }\n"
+    "    vec2 tex_coord = aTexCoord;\n"
+    "    vec4 color = aColor;\n"
+    "    uint tex_index = aTexIndex;\n"
+    "    float base_light = aBaseLightLevel;\n"
+    RGL_VS_NORMAL_DECODE
+    "    if (u_instance_mode == 3) {\n"
+    "        if (!expand_road(world_pos, tex_coord, color, normal, tex_index)) {\n"
+    "            gl_Position = vec4(0.0, 0.0, 2.0, 1.0); // Unused quad: outside the clip volume\n"
+    "            return;\n"
+    "        }\n"
+    "        base_light = 1.0;\n"
+    "    } else if (u_instance_mode != 0) {\n"
+    "        Instance inst = u_instances[u_instance_base + uint(gl_InstanceID)];\n"
+    "        tex_coord = u_instance_uv_rect.xy + aTexCoord * u_instance_uv_rect.zw;\n"
+    "        color *= inst.tint;\n"
+    "        if (u_instance_mode == 1) {\n"
+    "            world_pos = (inst.model * vec4(aPos, 1.0)).xyz;\n"
+    "            normal = normalize(mat3(inst.model) * normal);\n"
+    "        } else if (u_instance_mode == 4) {  // RGL_DrawBillboardCylindricalY\n"
+    "            vec3 camera_pos = -transpose(mat3(view)) * view[3].xyz;\n"
+    "            vec3 to_camera = camera_pos - inst.model[3].xyz;\n"
+    "            to_camera.y = 0.0;\n"
+    "            if (dot(to_camera, to_camera) < 0.001) to_camera = vec3(view[0][0], 0.0, view[2][0]); // Camera overhead\n"
+    "            to_camera = normalize(to_camera);\n"
+    "            vec3 right = normalize(cross(vec3(0.0, 1.0, 0.0), to_camera));\n"
+    "            world_pos = inst.model[3].xyz + right * (aPos.x * inst.model[0].x) + vec3(0.0, aPos.y * inst.model[0].y, 0.0);\n"
+    "            normal = to_camera;\n"
+    "        } else {\n"
+    "            vec3 right = vec3(view[0][0], view[1][0], view[2][0]);\n"
+    "            vec3 up = vec3(view[0][1], view[1][1], view[2][1]);\n"
+    "            world_pos = inst.model[3].xyz + right * (aPos.x * inst.model[0].x) + up * (aPos.y * inst.model[0].y);\n"
+    "            normal = vec3(view[0][2], view[1][2], view[2][2]); // Faces the camera\n"
     "        }\n"
-    "        total_light_contrib += diffuse_color;\n"
     "    }\n"
-    "    vLightColor = total_light_contrib;\n"
+    "    vec4 view_pos = view * vec4(world_pos, 1.0);\n"
+    "    gl_Position = projection * view_pos;\n"
+    "    vTexCoord = tex_coord;\n"
+    "    vTexIndex = tex_index;\n"
+    "    vColor = color;\n"
+    "    vWorldPos = world_pos;\n"
+    "    vNormal = normal;\n"
+    "    vBaseLightLevel = base_light;\n"
+    "    vViewDepth = -view_pos.z;\n"
     "}\n";
 
 // --- Shader Source ---
+// Lighting is evaluated per fragment from a clustered light grid: the view frustum is split into
+// RGL_CLUSTER_GRID_X * Y screen tiles and RGL_CLUSTER_GRID_Z logarithmic depth slices, and each
+// fragment loops only over the lights binned into its cluster (see _RGL_BuildLightClusters).
 static const char* RGL_FRAGMENT_SHADER =
-    "#version 330 core\n"
+    "#version 430 core\n"
+    "#extension GL_ARB_bindless_texture : enable\n"
     "out vec4 FragColor;\n"
 
     // -- Inputs from Vertex Shader --
+    "flat in uint vTexIndex;\n"
     "in vec2 vTexCoord;\n"
     "in vec4 vColor;\n"
-    "in vec3 vLightColor; // <-- MODIFIED: Receive full light color\n"
+    "in vec3 vWorldPos;\n"
+    "in vec3 vNormal;\n"
+    "in float vBaseLightLevel;\n"
+    "in float vViewDepth;\n"
 
     // -- Uniforms --
     "uniform sampler2D textureSampler;\n"
     "uniform bool useTexture;\n"
+    "uniform bool u_bindless;            // Sample the per-vertex handle instead of textureSampler\n"
+    "uniform vec3 u_ambient_light_color;\n"
+    "uniform int u_directional_lights;   // Lights [0, n) are directional and apply everywhere\n"
+    "uniform uvec3 u_cluster_dims;\n"
+    "uniform vec4 u_cluster_viewport;    // .xy = viewport origin, .zw = clusters per pixel\n"
+    "uniform vec2 u_cluster_z_params;    // slice = log(view_depth) * x + y\n"
+
+    // -- Clustered Light Data --
+    "#define LIGHT_TYPE_POINT 1\n"
+    "#define LIGHT_TYPE_DIRECTIONAL 2\n"
+    "#define LIGHT_TYPE_SPOT 3\n"
+    "struct Light {\n"
+    "    vec4 pos_type;         // .xyz = position (point/spot), .w = type ID\n"
+    "    vec4 color_intensity;  // .rgb = color, .a = intensity\n"
+    "    vec4 direction;        // .xyz = direction (directional/spot)\n"
+    "    vec4 params;           // .x = radius, .y = cos(outer_angle), .z = cos(inner_angle)\n"
+    "};\n"
+    "layout (std430, binding = 2) readonly buffer LightBuffer { Light u_lights[]; };\n"
+    "layout (std430, binding = 3) readonly buffer ClusterBuffer { uvec2 u_clusters[]; };  // .x = first index, .y = count\n"
+    "layout (std430, binding = 4) readonly buffer ClusterIndexBuffer { uint u_cluster_lights[]; };\n"
+
+    // -- Bindless Texture Table (index 0 = untextured) --
+    "#ifdef GL_ARB_bindless_texture\n"
+    "layout (std430, binding = 9) readonly buffer TextureHandleBuffer { uvec2 u_texture_handles[]; };\n"
+    "#endif\n"
+    "vec4 sample_base_color() {\n"
+    "#ifdef GL_ARB_bindless_texture\n"
+    "    if (u_bindless) return vTexIndex == 0u ? vec4(1.0) : texture(sampler2D(u_texture_handles[vTexIndex]), vTexCoord);\n"
+    "#endif\n"
+    "    return useTexture ? texture(textureSampler, vTexCoord) : vec4(1.0);\n"
+    "}\n"
+
+    "vec3 evaluate_light(Light light, vec3 world_pos, vec3 normal) {\n"
+    "    int light_type = int(light.pos_type.w);\n"
+    "    vec3 light_color = light.color_intensity.rgb * light.color_intensity.a;\n"
+    "    if (light_type == LIGHT_TYPE_DIRECTIONAL) {\n"
+    "        vec3 light_dir = normalize(light.direction.xyz);\n"
+    "        return max(dot(normal, -light_dir), 0.0) * light_color;\n"
+    "    }\n"
+    "    float radius = light.params.x;\n"
+    "    vec3 light_dir = light.pos_type.xyz - world_pos;\n"
+    "    float dist = length(light_dir);\n"
+    "    if (dist >= radius) return vec3(0.0);\n"
+    "    light_dir /= max(dist, 0.0001);\n"
+    "    float attenuation = 1.0 - smoothstep(0.8, 1.0, dist / radius);\n"
+    "    attenuation /= (1.0 + 0.1*dist + 0.05*dist*dist);\n"
+    "    if (light_type == LIGHT_TYPE_SPOT) {\n"
+    "        float theta = dot(light_dir, -normalize(light.direction.xyz));\n"
+    "        if (theta <= light.params.y) return vec3(0.0);\n"
+    "        attenuation *= smoothstep(light.params.y, light.params.z, theta);\n"
+    "    }\n"
+    "    return max(dot(normal, light_dir), 0.0) * light_color * attenuation;\n"
+    "}\n"
 
     "void main() {\n"
     "    // Get base color from texture or vertex color\n"
-    "    vec4 base_color = useTexture ? texture(textureSampler, vTexCoord) : vec4(1.0);\n"
+    "    vec4 base_color = sample_base_color();\n"
     "    vec4 final_color = base_color * vColor;\n"
 
-    "    // --- MODIFIED: Apply the lighting --- \n"
-    "    // Modulate the fragment's RGB by the calculated light color.\n"
-    "    // The alpha component is preserved from the original color.\n"
-    "    final_color.rgb *= vLightColor;\n"
+    "    // --- Clustered Lighting ---\n"
+    "    vec3 normal = normalize(vNormal);\n"
+    "    vec3 total_light = u_ambient_light_color * vBaseLightLevel;\n"
+    "    for (int i = 0; i < u_directional_lights; i++) {\n"
+    "        total_light += evaluate_light(u_lights[i], vWorldPos, normal);\n"
+    "    }\n"
+    "    uvec2 tile = uvec2(max((gl_FragCoord.xy - u_cluster_viewport.xy) * u_cluster_viewport.zw, vec2(0.0)));\n"
+    "    uint slice = uint(max(log(max(vViewDepth, 0.0001)) * u_cluster_z_params.x + u_cluster_z_params.y, 0.0));\n"
+    "    uvec3 cluster = min(uvec3(tile, slice), u_cluster_dims - uvec3(1));\n"
+    "    uvec2 range = u_clusters[cluster.x + u_cluster_dims.x * (cluster.y + u_cluster_dims.y * cluster.z)];\n"
+    "    for (uint i = 0u; i < range.y; i++) {\n"
+    "        total_light += evaluate_light(u_lights[u_cluster_lights[range.x + i]], vWorldPos, normal);\n"
+    "    }\n"
+
+    "    // Modulate the fragment's RGB by the accumulated light; alpha is preserved.\n"
+    "    final_color.rgb *= total_light;\n"
 
     "    FragColor = final_color;\n"
 
@@ -1168,82 +2427,399 @@ static const char* RGL_SHADOW_FRAGMENT_SHADER =
     "    finalColor = vec4(shadowTint.rgb, shadowTint.a * texColor.a);\n"
     "}\n";
 
-static const char* RGL_SHADOW_VOLUME_VERTEX_SHADER_ROBUST =
-    "#version 330 core\n"
-    "layout (location = 0) in vec4 aPos; // Use vec4: .xyz = position, .w = 0 for normal, 1 for extruded\n"
+// Silhouette shadow volumes. The mesh is drawn as GL_TRIANGLES_ADJACENCY from its cached
+// object-space buffers; the geometry shader keeps only the edges between a light-facing-away
+// triangle and a neighbour that is not, and extrudes each into a quad away from the light.
+static const char* RGL_SHADOW_VOLUME_VERTEX_SHADER =
+    "#version 430 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "uniform mat4 u_model;\n"
+    "out vec3 vWorldPos;\n"
+    "void main()\n"
+    "{\n"
+    "    vWorldPos = (u_model * vec4(aPos, 1.0)).xyz;\n"
+    "}\n";
 
-    "layout (std140, binding = 1) uniform ViewData {\n"
-    "    mat4 view;\n"
-    "    mat4 projection;\n"
-    "};\n"
+static const char* RGL_SHADOW_VOLUME_GEOMETRY_SHADER =
+    "#version 430 core\n"
+    "layout (triangles_adjacency) in;\n"
+    "layout (triangle_strip, max_vertices = 12) out;\n"
+    "in vec3 vWorldPos[];\n"
+    "uniform mat4 view;\n"
+    "uniform mat4 projection;\n"
     "uniform vec3 u_light_pos;\n"
+    "uniform float u_extrusion_length;\n"
+
+    "// Same test the CPU caster used: a triangle casts when it faces away from the light.\n"
+    "bool casts(vec3 a, vec3 b, vec3 c) {\n"
+    "    return dot(cross(b - a, c - a), a - u_light_pos) > 0.0;\n"
+    "}\n"
+
+    "void emit_side(vec3 a, vec3 b) {\n"
+    "    mat4 vp = projection * view;\n"
+    "    vec3 ea = a + normalize(a - u_light_pos) * u_extrusion_length;\n"
+    "    vec3 eb = b + normalize(b - u_light_pos) * u_extrusion_length;\n"
+    "    gl_Position = vp * vec4(a, 1.0);  EmitVertex();\n"
+    "    gl_Position = vp * vec4(b, 1.0);  EmitVertex();\n"
+    "    gl_Position = vp * vec4(ea, 1.0); EmitVertex();\n"
+    "    gl_Position = vp * vec4(eb, 1.0); EmitVertex();\n"
+    "    EndPrimitive();\n"
+    "}\n"
 
     "void main()\n"
     "{\n"
-    "    vec3 position = aPos.xyz;\n"
-    "    if (aPos.w > 0.5) { // If this is an extruded vertex\n"
-    "        // Extrude it from the light source out to infinity.\n"
-    "        // A directional vector from the light through the vertex position.\n"
-    "        vec3 light_dir = position - u_light_pos;\n"
-    "        // Projecting to infinity is done by setting W to 0 in the final clip space position.\n"
-    "        position = light_dir; // Treat as a direction, not a position\n"
-    "    }\n"
-    "    \n"
-    "    vec4 clip_pos = projection * view * vec4(position, aPos.w > 0.5 ? 0.0 : 1.0);\n"
-    "    gl_Position = clip_pos;\n"
+    "    vec3 p0 = vWorldPos[0], p1 = vWorldPos[1], p2 = vWorldPos[2];\n"
+    "    vec3 p3 = vWorldPos[3], p4 = vWorldPos[4], p5 = vWorldPos[5];\n"
+    "    if (!casts(p0, p2, p4)) return;\n"
+    "    // Open edges carry the triangle's own far vertex, so the neighbour reads as reversed (a silhouette).\n"
+    "    if (!casts(p0, p1, p2)) emit_side(p0, p2);\n"
+    "    if (!casts(p2, p3, p4)) emit_side(p2, p4);\n"
+    "    if (!casts(p4, p5, p0)) emit_side(p4, p0);\n"
     "}\n";
 
-// We will also need a shader to darken the scene.
-static const char* RGL_SHADOW_PASS_FRAGMENT_SHADER =
+static const char* RGL_SHADOW_VOLUME_FRAGMENT_SHADER =
+    "#version 430 core\n"
+    "out vec4 FragColor;\n"
+    "void main() { FragColor = vec4(0.0); } // Color writes are masked; only the stencil ops matter.\n";
+
+// Full-screen triangle from gl_VertexID; drawn with the attribute-less fullscreen_quad_vao.
+static const char* RGL_SHADOW_DARKEN_VERTEX_SHADER =
+    "#version 330 core\n"
+    "void main()\n"
+    "{\n"
+    "    vec2 p = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);\n"
+    "    gl_Position = vec4(p * 2.0 - 1.0, 0.0, 1.0);\n"
+    "}\n";
+
+// Retro post-process (RGL_ApplyRetroEffects): a full-screen triangle over a copy of the target.
+// Colors go through the same YPQ space as the per-color functions, via tables baked from Situation's
+// conversions: the encode table stores chroma as a vector so it filters cleanly across the hue seam,
+// and the decode table repeats along P. Each effect mirrors its CPU function in normalized units.
+static const char* RGL_RETRO_FRAGMENT_SHADER =
     "#version 330 core\n"
     "out vec4 FragColor;\n"
-    "uniform vec4 u_shadow_color;\n"
+    "uniform sampler2D u_frame;\n"
+    "uniform sampler3D u_encode_lut;\n"
+    "uniform sampler3D u_decode_lut;\n"
+    "uniform sampler3D u_palette_lut;\n"
+    "uniform vec2 u_lut_sizes;      // x = YPQ tables, y = palette table\n"
+    "uniform vec4 u_scanline;       // x = intensity, y = rows per line, z = noise strength, w = bloom strength\n"
+    "uniform vec4 u_ghost;          // x = phase offset, y = strength, z = shift in pixels\n"
+    "uniform vec4 u_signal;         // rgb = channel color, a = how far the picture fades toward it\n"
+    "uniform int u_use_palette;\n"
+    "uniform vec2 u_origin;         // Window position of the viewport the frame was copied from\n"
+    "\n"
+    "vec3 lut_coord(vec3 v, float n) { return clamp(v, 0.0, 1.0) * ((n - 1.0) / n) + 0.5 / n; }\n"
+    "vec3 to_ypq(vec3 rgb) {\n"
+    "    vec3 e = texture(u_encode_lut, lut_coord(rgb, u_lut_sizes.x)).rgb;\n"
+    "    vec2 chroma = e.gb * 2.0 - 1.0;\n"
+    "    float q = length(chroma);\n"
+    "    float p = q > 0.0001 ? fract(atan(chroma.y, chroma.x) * 0.15915494) : 0.0;\n"
+    "    return vec3(e.r, p, min(q, 1.0));\n"
+    "}\n"
+    "vec3 from_ypq(vec3 ypq) {\n"
+    "    vec3 c = lut_coord(vec3(0.0, ypq.x, ypq.z), u_lut_sizes.x);\n"
+    "    c.x = fract(ypq.y) + 0.5 / u_lut_sizes.x;\n"
+    "    return texture(u_decode_lut, c).rgb;\n"
+    "}\n"
     "void main()\n"
     "{\n"
-    "    FragColor = u_shadow_color;\n"
+    "    ivec2 size = textureSize(u_frame, 0);\n"
+    "    ivec2 pixel = ivec2(gl_FragCoord.xy - u_origin);\n"
+    "    vec4 source = texelFetch(u_frame, pixel, 0);\n"
+    "    vec3 rgb = source.rgb;\n"
+    "    vec2 screen = vec2(pixel.x, size.y - 1 - pixel.y); // Top-left origin, like the CPU functions' screen positions\n"
+    "\n"
+    "    // Weak signal: the picture fades toward the channel's carrier color (RGL_YPQFromTVChannel).\n"
+    "    if (u_signal.a > 0.0) rgb = mix(rgb, u_signal.rgb, u_signal.a);\n"
+    "    // RGL_ColorTVGhost: a dimmer, desaturated, phase-shifted copy blended over the picture.\n"
+    "    if (u_ghost.y > 0.0) {\n"
+    "        ivec2 ghost_pixel = clamp(pixel - ivec2(int(u_ghost.z), 0), ivec2(0), size - 1);\n"
+    "        vec3 ghost = to_ypq(u_ghost.z != 0.0 ? texelFetch(u_frame, ghost_pixel, 0).rgb : rgb);\n"
+    "        ghost = vec3(ghost.x * 0.7, ghost.y + u_ghost.x, ghost.z * 0.8);\n"
+    "        rgb = mix(rgb, from_ypq(ghost), u_ghost.y);\n"
+    "    }\n"
+    "    // RGL_ColorCRTBloom: brighter and slightly less saturated.\n"
+    "    if (u_scanline.w > 0.0) {\n"
+    "        vec3 ypq = to_ypq(rgb);\n"
+    "        ypq.x = min(ypq.x * (1.0 + u_scanline.w), 1.0);\n"
+    "        ypq.z = clamp(ypq.z * (1.0 - u_scanline.w * 0.3), 0.0, 1.0);\n"
+    "        rgb = from_ypq(ypq);\n"
+    "    }\n"
+    "    // RGL_ColorTVNoise: a positional luminance pattern.\n"
+    "    if (u_scanline.z > 0.0) {\n"
+    "        vec3 ypq = to_ypq(rgb);\n"
+    "        float noise = (sin(screen.x * 0.1) * cos(screen.y * 0.1) + 1.0) * 0.5;\n"
+    "        ypq.x = clamp(ypq.x + noise * u_scanline.z * (50.0 / 255.0), 0.0, 1.0);\n"
+    "        rgb = from_ypq(ypq);\n"
+    "    }\n"
+    "    // RGL_ColorScanline: odd lines lose luminance.\n"
+    "    if (u_scanline.x > 0.0 && (int(floor(screen.y / u_scanline.y)) & 1) == 1) {\n"
+    "        vec3 ypq = to_ypq(rgb);\n"
+    "        ypq.x = clamp(ypq.x * (1.0 - u_scanline.x), 0.0, 1.0);\n"
+    "        rgb = from_ypq(ypq);\n"
+    "    }\n"
+    "    // RGL_ColorClosest, one nearest-texel lookup instead of a scan of the palette.\n"
+    "    if (u_use_palette != 0) rgb = texture(u_palette_lut, lut_coord(rgb, u_lut_sizes.y)).rgb;\n"
+    "    FragColor = vec4(rgb, source.a);\n"
     "}\n";
 
-static const char* RGL_WIREFRAME_VERTEX_SHADER = "#version 330 core\n"
-    "layout (location = 0) in vec3 aPos; uniform mat4 mvp;"
-    "void main() { gl_Position = mvp * vec4(aPos, 1.0); }";
+// GPU particles. Positions and velocities live in SoA storage buffers; each particle also stores
+// the burst it came from, which supplies lifetime, gravity and the tint/size curves.
+#define RGL_PARTICLE_GLSL_BUFFERS \
+    "struct Burst { vec4 origin_lifetime; vec4 velocity_min_rate; vec4 velocity_max; vec4 gravity;\n" \
+    "               vec4 tint_start; vec4 tint_end; vec4 size; vec4 uv_rect; };\n" \
+    "layout (std430, binding = 5) buffer ParticlePositions { vec4 p_position_age[]; };  // .w = age (negative = not yet spawned)\n" \
+    "layout (std430, binding = 6) buffer ParticleVelocities { vec4 p_velocity[]; };\n" \
+    "layout (std430, binding = 7) buffer ParticleBurstIndices { uint p_burst[]; };\n" \
+    "layout (std430, binding = 8) readonly buffer ParticleBursts { Burst u_bursts[]; };\n"
+
+static const char* RGL_PARTICLE_EMIT_COMPUTE_SHADER =
+    "#version 430 core\n"
+    "layout (local_size_x = 256) in;\n"
+    RGL_PARTICLE_GLSL_BUFFERS
+    "uniform uint u_first;\n"
+    "uniform uint u_count;\n"
+    "uniform uint u_capacity;\n"
+    "uniform uint u_burst;\n"
+    "uniform uint u_seed;\n"
+
+    "float hash01(uint x) {\n"
+    "    x ^= x >> 16; x *= 0x7feb352du; x ^= x >> 15; x *= 0x846ca68bu; x ^= x >> 16;\n"
+    "    return float(x) * (1.0 / 4294967296.0);\n"
+    "}\n"
 
-static const char* RGL_WIREFRAME_FRAGMENT_SHADER = "#version 330 core\n"
-    "out vec4 FragColor; uniform vec4 color;"
-    "void main() { FragColor = color; }";
+    "void main()\n"
+    "{\n"
+    "    uint i = gl_GlobalInvocationID.x;\n"
+    "    if (i >= u_count) return;\n"
+    "    uint slot = (u_first + i) % u_capacity;\n"
+    "    Burst b = u_bursts[u_burst];\n"
+    "    uint h = u_seed ^ (i * 0x9E3779B9u);\n"
+    "    vec3 r = vec3(hash01(h), hash01(h + 0x68E31DA4u), hash01(h + 0xB5297A4Du));\n"
+    "    float rate = b.velocity_min_rate.w;\n"
+    "    // A spawn rate staggers the burst: particle i starts i / rate seconds late.\n"
+    "    float age = rate > 0.0 ? -float(i) / rate : 0.0;\n"
+    "    p_position_age[slot] = vec4(b.origin_lifetime.xyz, age);\n"
+    "    p_velocity[slot] = vec4(mix(b.velocity_min_rate.xyz, b.velocity_max.xyz, r), 0.0);\n"
+    "    p_burst[slot] = u_burst;\n"
+    "}\n";
 
+static const char* RGL_PARTICLE_SIMULATE_COMPUTE_SHADER =
+    "#version 430 core\n"
+    "layout (local_size_x = 256) in;\n"
+    RGL_PARTICLE_GLSL_BUFFERS
+    "uniform uint u_count;\n"
+    "uniform float u_dt;\n"
+    "void main()\n"
+    "{\n"
+    "    uint i = gl_GlobalInvocationID.x;\n"
+    "    if (i >= u_count) return;\n"
+    "    vec4 pa = p_position_age[i];\n"
+    "    Burst b = u_bursts[p_burst[i]];\n"
+    "    if (pa.w > b.origin_lifetime.w) return; // Dead; it stays dead until re-emitted\n"
+    "    float age = pa.w + u_dt;\n"
+    "    if (age > 0.0) {\n"
+    "        // Integrate only the part of the step after the particle's spawn time.\n"
+    "        float dt = min(u_dt, age);\n"
+    "        vec3 v = p_velocity[i].xyz + b.gravity.xyz * dt;\n"
+    "        p_velocity[i].xyz = v;\n"
+    "        pa.xyz += v * dt;\n"
+    "    }\n"
+    "    p_position_age[i] = vec4(pa.xyz, age);\n"
+    "}\n";
 
-//RGL Internal Static Helper Functions
-//==================================================================================
-// Core Batching & Rendering Helpers
-//==================================================================================
-static void _RGL_FlushBatch(void); // Processes all queued commands, sorts them, and issues batched draw calls to the GPU.
-static bool _RGL_EnsureCommandCapacity(size_t required_command_count); // Checks if the command buffer has space; if not, flushes the batch and/or grows the buffer.
-static int _RGL_CompareDrawCommands(const void* a, const void* b); // The qsort comparison function for sorting draw commands by Z-depth and texture ID.
-//==================================================================================
-// Dynamic Lighting Helpers
-//==================================================================================
+static const char* RGL_PARTICLE_VERTEX_SHADER =
+    "#version 430 core\n"
+    RGL_PARTICLE_GLSL_BUFFERS
+    "uniform mat4 view;\n"
+    "uniform mat4 projection;\n"
+    "uniform uint u_first;\n"
+    "uniform uint u_capacity;\n"
+    "out vec2 vTexCoord;\n"
+    "out vec4 vColor;\n"
+    "void main()\n"
+    "{\n"
+    "    uint i = (u_first + uint(gl_InstanceID)) % u_capacity;\n"
+    "    vec4 pa = p_position_age[i];\n"
+    "    Burst b = u_bursts[p_burst[i]];\n"
+    "    float lifetime = b.origin_lifetime.w;\n"
+    "    vTexCoord = vec2(0.0);\n"
+    "    vColor = vec4(0.0);\n"
+    "    if (pa.w < 0.0 || pa.w > lifetime) { gl_Position = vec4(0.0); return; } // Collapses the quad\n"
+    "    float t = pa.w / max(lifetime, 1e-6);\n"
+    "    vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1); // Triangle strip: BL, BR, TL, TR\n"
+    "    vec2 size = mix(b.size.xy, b.size.zw, t);\n"
+    "    vec3 right = vec3(view[0][0], view[1][0], view[2][0]);\n"
+    "    vec3 up = vec3(view[0][1], view[1][1], view[2][1]);\n"
+    "    vec3 world = pa.xyz + right * ((corner.x - 0.5) * size.x) + up * ((corner.y - 0.5) * size.y);\n"
+    "    gl_Position = projection * view * vec4(world, 1.0);\n"
+    "    vTexCoord = b.uv_rect.xy + vec2(corner.x, 1.0 - corner.y) * b.uv_rect.zw;\n"
+    "    vColor = mix(b.tint_start, b.tint_end, t);\n"
+    "}\n";
+
+static const char* RGL_PARTICLE_FRAGMENT_SHADER =
+    "#version 430 core\n"
+    "in vec2 vTexCoord;\n"
+    "in vec4 vColor;\n"
+    "out vec4 FragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 c = texture(texture0, vTexCoord) * vColor;\n"
+    "    if (c.a < 0.01) discard;\n"
+    "    FragColor = c;\n"
+    "}\n";
+
+// We will also need a shader to darken the scene.
+static const char* RGL_SHADOW_PASS_FRAGMENT_SHADER =
+    "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "uniform vec4 u_shadow_color;\n"
+    "void main()\n"
+    "{\n"
+    "    FragColor = u_shadow_color;\n"
+    "}\n";
+
+static const char* RGL_WIREFRAME_VERTEX_SHADER = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos; uniform mat4 mvp;"
+    "void main() { gl_Position = mvp * vec4(aPos, 1.0); }";
+
+static const char* RGL_WIREFRAME_FRAGMENT_SHADER = "#version 330 core\n"
+    "out vec4 FragColor; uniform vec4 color;"
+    "void main() { FragColor = color; }";
+
+
+//RGL Internal Static Helper Functions
+//==================================================================================
+// Core Batching & Rendering Helpers
+//==================================================================================
+static void _RGL_FlushBatch(void); // Processes all queued commands, sorts them, and issues batched draw calls to the GPU.
+static bool _RGL_EnsureCommandCapacity(size_t required_command_count); // Checks if the command buffer has space; if not, flushes the batch and/or grows the buffer.
+static bool _RGL_EnsureCommandListCapacity(RGLCommandList* list, size_t required_command_count); // Grows a per-thread command list so it can take required_command_count more commands.
+static inline RGLInternalDraw* _RGL_PeekCommand(void); // Returns the next free command slot in the calling thread's target (its command list or the frame batch).
+static inline void _RGL_CommitCommand(void); // Commits the slot returned by _RGL_PeekCommand.
+static inline RGLInternalDraw* _RGL_PushCommand(void); // Peeks and commits a command slot in one step.
+#ifdef SITUATION_ENABLE_THREADING
+static void _RGL_RecordParallelJob(int job_index, void* user_data); // Thread-pool trampoline: records one RGL_RecordParallel job into its own command list.
+#endif
+static inline bool _RGL_IsCommandOpaque(const RGLInternalDraw* cmd); // Classifies a command as opaque (no blending needed) from its vertex alphas and texture hint.
+static inline uint64_t _RGL_MakeSortKey(const RGLInternalDraw* cmd); // Packs a command's opacity bucket, Z-depth, texture slot and primitive type into a single 64-bit sort key.
+static RGLSortKey* _RGL_RadixSortKeys(RGLSortKey* keys, RGLSortKey* scratch, size_t count); // Stable LSD radix sort of (key, index) records; returns whichever buffer holds the result.
+static void _RGL_SetBatchVertexLayout(GLuint vao, GLuint vbo); // Points a VAO's attributes at a VBO laid out in the RGLBatchVertex format.
+static inline void _RGL_PackBatchVertex(RGLBatchVertex* out, const vec3 position, const vec3 normal, const vec2 tex_coord, const vec4 color, float light_level); // Writes one vertex in the active batch vertex format.
+static bool _RGL_CreateBatchVertexStorage(size_t vertex_capacity); // Creates the batch VBO as a persistently mapped ring (or a plain dynamic VBO as fallback) and sets up the VAO layout.
+static void _RGL_DestroyBatchVertexStorage(void); // Releases the batch VBO, quad index buffer, fences and any fallback staging buffer.
+static bool _RGL_CreateQuadIndexBuffer(size_t max_quads); // Builds the static quad index buffer and binds it to the batch VAO.
+static void _RGL_AdvanceVertexRing(void); // Fences the current ring segment and moves to the next one, waiting only if the GPU still uses it.
+static RGLBatchVertex* _RGL_AcquireBatchVertices(size_t max_vertices, size_t* out_first_vertex); // Returns a write pointer for up to max_vertices and the matching first-vertex index for draws.
+static void _RGL_InitBindlessTextures(void); // Detects GL_ARB_bindless_texture and creates the texture handle table SSBO (binding 9).
+static void _RGL_ShutdownBindlessTextures(void); // Makes every table handle non-resident and frees the table.
+static uint16_t _RGL_GetBindlessTextureIndex(const SituationTexture* texture); // Returns a texture's handle table index, making it resident on first use; 0 if unavailable.
+static void _RGL_ReleaseBindlessTexture(uint32_t slot_index); // Drops a texture from the handle table; call before the texture is deleted.
+static bool _RGL_IsBindlessIndexCurrent(const SituationTexture* texture, uint16_t index); // True while a baked table index still refers to the texture.
+static void _RGL_UploadBindlessHandles(void); // Uploads the changed range of the handle table before a flush draws.
+static int _RGL_GetInstanceGeometry(const RGLMesh* mesh); // Returns the index of a mesh's instancing copy, uploading it on first use; -1 on failure.
+static bool _RGL_UploadInstanceGeometry(RGLInstanceGeometry* geometry, const RGLBatchVertex* vertices, int vertex_count, const uint32_t* indices, int index_count); // Creates the VAO/VBO/IBO of an instancing copy.
+static void _RGL_ReleaseInstanceGeometry(const RGLMesh* mesh); // Deletes a mesh's instancing copy, if any. Called by RGL_DestroyMesh.
+static RGLInstanceData* _RGL_QueueInstancedDraw(int mode, int geometry, RGLTexture texture, const vec4 uv_rect, int instance_count, bool blend); // Reserves instance slots for a draw at the next flush; NULL on failure.
+static void _RGL_DrawBillboardInstances(int mode, const char* warning, RGLSprite sprite, const vec3* positions, const vec2* sizes, const Color* tints, int instance_count); // Shared body of the instanced billboard draws (mode 2 = spherical, 4 = Y-locked).
+static void _RGL_DrawQueuedInstances(bool blended); // (Flush-time) Issues the queued opaque or blended instanced draws; the opaque pass also uploads the instances.
+static void _RGL_DrawBlendedInstancePass(bool bindless); // (Flush-time) Draws the blended instanced draws over the opaque world without writing depth.
+static void _RGL_ShutdownInstancing(void); // Frees every instancing copy and the instance buffer.
+static bool _RGL_BuildDrawList(RGLDrawList* list); // Sorts and assembles a list's recording and uploads it as static buffers.
+static void _RGL_ReleaseDrawListGeometry(RGLDrawList* list); // Draws any queued replay of a list, then deletes its GPU buffers.
+static void _RGL_ReplayDrawList(const RGLDrawList* list, uint32_t instance, bool blended); // (Flush-time) Issues a list's opaque or blended ranges with its transform as the given instance.
+static void _RGL_DrawQueuedGPURoad(const RGLInstancedDraw* draw); // (Flush-time) Issues one queued GPU road run as an attribute-less glDrawArrays.
+//==================================================================================
+// Frame Arena Helpers
+//==================================================================================
+static void* _RGL_FrameAlloc(size_t size); // Returns aligned transient scratch that stays valid until the next rewind past it or RGL_Begin; NULL on failure.
+static inline RGLFrameArenaMark _RGL_FrameArenaMark(void); // Saves the arena position so a helper can hand its scratch back when done.
+static void _RGL_FrameArenaRewind(RGLFrameArenaMark mark); // Releases everything allocated since mark, freeing any overflow blocks taken after it.
+static void _RGL_ResetFrameArena(void); // (RGL_Begin) Empties the arena and resizes it to the recent high-water mark so later frames fit in one block.
+static void _RGL_ShutdownFrameArena(void); // Frees the arena block and any overflow.
+//==================================================================================
+// Dynamic Lighting Helpers
+//==================================================================================
 static int _RGL_FindFreeLightSlot(void); // Scans the internal lights array to find the first available empty slot.
-static int _RGL_CompareRankedLights(const void* a, const void* b); // The qsort comparison function for sorting visible lights by priority/distance.
+static void _RGL_OnLightSlotUsed(int index); // Extends the used slot range and bumps the light version after a light is created.
+static int _RGL_LightClusterSlice(float view_depth); // Maps a view-space depth to its logarithmic cluster slice.
+static bool _RGL_ComputeLightClusterBounds(const RGLLight* light, RGLLightClusterBounds* out_bounds); // Finds the clusters a light's bounding sphere overlaps; false if it covers none.
+static void _RGL_PackShaderLight(const RGLLight* light, RGLShaderLight* out_light); // Converts a light into its SSBO layout.
+static void _RGL_BuildLightClusters(void); // Culls the active lights, bins them into the cluster grid and uploads the light SSBOs.
+static void _RGL_SetLightClusterUniforms(int directional_count, const GLint viewport[4]); // Sets the clustered lighting uniforms on the bound main shader.
+//==================================================================================
+// GPU Particle Helpers
+//==================================================================================
+static void _RGL_BindParticleBuffers(void); // Binds the particle SSBOs to bindings 5-8 for the compute and draw programs.
+static void _RGL_DrawParticleRange(uint64_t first, uint32_t count); // Draws a run of the particle ring, splitting it where it wraps.
 static void _RGL_ExtractFrustumPlanes(const mat4 vp_matrix, vec4 out_frustum_planes[6]); // Calculates the six planes of the view frustum from a combined view-projection matrix.
 static bool _RGL_FrustumIntersectsSphere(const vec4 p[6], vec3 center, float radius, float bias); // Checks if a sphere is visible within the view frustum, with an optional near-plane bias.
+static bool _RGL_FrustumIntersectsAABB(const vec4 p[6], const vec3 box_min, const vec3 box_max); // Checks if an axis-aligned box is at least partly inside the view frustum.
 //==================================================================================
 // World System: Path Helpers
 //==================================================================================
 static int _RGL_FindPathIndex(const char* path_name); // Finds the internal array index for a path given its unique string name.
 static RGLPathData* _RGL_GetActivePathData(void); // Gets a direct pointer to the data of the currently active path.
-static int _RGL_FindPathPointIndexAt(RGLPathPoint* points, size_t num_points, float z_pos); // Performs a fast, O(log n) search to find the path segment index for a given Z-position.
+static int _RGL_FindPathPointIndexAt(const float* world_z, size_t num_points, float z_pos); // Performs a fast, O(log n) search to find the path segment index for a given Z-position.
+static bool _RGL_ReservePathPoints(RGLPathData* path, size_t capacity); // Grows every per-point array of a path to hold at least `capacity` points.
+static void _RGL_FreePathPoints(RGLPathData* path); // Releases every per-point array of a path.
+static void _RGL_StorePathPoint(RGLPathData* path, size_t index, const RGLPathPoint* point); // Scatters an RGLPathPoint into the path's geometry, appearance and scenery arrays.
+static void _RGL_LoadPathPoint(const RGLPathData* path, size_t index, RGLPathPoint* out_point); // Gathers a control point back into an RGLPathPoint view.
 static void _RGL_CalculateBankedSurface(RGLPathPoint* point, float lateral_offset, vec3 out_normal); // Calculates the 3D surface normal for a path, accounting for its bank angle.
+static void _RGL_CalculateBankedNormal(float roll_degrees, vec3 out_normal); // Calculates the surface normal for a given bank angle.
+static float _RGL_WrapPathZ(const RGLPathData* path, float z_pos); // Wraps a Z position into the loop range of a looping path.
+static bool _RGL_BuildPathSamples(RGLPathData* path); // (Render thread) (Re)evaluates the path's curve into its sample cache if it has been invalidated.
+static void _RGL_FreePathSamples(RGLPathData* path); // Releases a path's sample cache.
+static bool _RGL_SamplePathAt(const RGLPathData* path, float z_pos, RGLPathSample* out_sample); // Reads the cached curve at a Z position, interpolating between neighbouring samples; never rebuilds.
+static int _RGL_SeekPathSegment(const RGLPathData* path, float z_pos, int* cursor); // Walks a segment bookmark from its last position to the segment holding z_pos.
+static void _RGL_EvaluatePathSample(const RGLPathData* path, float z_pos, int* cursor, RGLPathSample* out_sample); // Evaluates the curve's geometry at a Z position straight from the control points.
+static void _RGL_EvaluatePathPoint(const RGLPathData* path, float z_pos, int* cursor, RGLPathPoint* out_point); // Evaluates the full interpolated path point (geometry, appearance, scenery) at a Z position.
+static void _RGL_ClassifyGround(const RGLPathSample* props, float world_x, RGLGroundInfo* out_info); // Resolves the ground height, normal and surface type across a sampled cross-section.
+static bool _RGL_BuildSceneryIndex(RGLPathData* path); // (Re)builds a path's scenery index if it was invalidated or the path set changed.
+static bool _RGL_IsSceneryIndexCurrent(const RGLPathData* path); // True if a path's scenery index can be read without rebuilding it.
+static void _RGL_FreeSceneryIndex(RGLPathData* path); // Releases a path's scenery index.
+static uint32_t _RGL_HashMarkerName(const char* name); // FNV-1a over the (at most 31 significant) characters of a marker name.
+static size_t _RGL_ScenerySpan(const RGLSceneryIndex* index, RGLSceneryType type, float start_z, float end_z, const uint32_t** out_ids, size_t* out_end); // Binary-searches the anchors of one type (or all) inside a Z range.
+static RGLScenery* _RGL_GetAnchorScenery(const RGLPathData* path, const RGLSceneryAnchor* anchor); // Returns the scenery slot an anchor refers to.
+static bool _RGL_FindJunctionIndexed(const RGLPathData* path, const RGLSceneryIndex* index, float player_z, float search_radius, RGLJunctionInfo* out_info); // Junction query over a built index; shared by RGL_QueryJunction and the batch.
 static void _RGL_DrawPathScene_Road(float player_z, int draw_distance, void* user_data); // The master drawing function for the default "road" style.
+static void _RGL_DrawPathScene_GPURoad(float player_z, int draw_distance, void* user_data); // The drawing function of the GPU road style: queues a few draws per window.
+static void _RGL_DrawPathSceneryWindow(RGLPathData* path, float player_z, int draw_distance, int start_idx); // Draws a window's scenery back-to-front; shared by both road styles.
+static bool _RGL_UploadGPURoad(RGLPathData* path); // (Re)uploads a path's samples and appearance to its GPU road buffers if the samples changed.
+static void _RGL_FreeGPURoad(RGLPathData* path); // Draws any queued run of a path's GPU road, then deletes its buffers.
+static void _RGL_QueueGPURoadRun(const RGLPathData* path, RGLGPURoadDraw* window, uint32_t first_segment, uint32_t segment_count, int point); // Queues one run's draws, split by the textures the fragment shader must bind.
+static int _RGL_PathLODStep(const RGLPathData* path, float distance); // Samples one road segment spans at a distance: 1, doubling past each multiple of the full-detail distance.
+static bool _RGL_IsPathLODEdge(const RGLPathData* path, int grid_index, float distance); // True if a sample-grid edge is kept at its distance; kept edges stay put as the player moves.
+static float _RGL_PathLODFade(float cutoff, float fade_distance, float distance); // 1 before the fade band, 0 past the cutoff (always 1 for a 0 cutoff).
+static Color _RGL_FadeColor(Color color, float fade); // Scales a color's alpha.
+static void _RGL_DrawPathSceneryLOD(const RGLPathData* path, size_t index, RGLScenery* scenery, float distance); // Applies the scenery cutoff, fade and impostor threshold, then draws through the style registry.
+static void _RGL_FlushPathImpostors(void); // Draws the gathered impostors, one Y-locked instanced billboard draw per sprite.
+static int _RGL_ComparePathImpostorSprites(const RGLPathImpostor* a, const RGLPathImpostor* b); // Orders impostors by texture, then source rectangle; 0 if they share a draw.
+static int _RGL_ComparePathImpostors(const void* a, const void* b); // qsort order of impostors: sprite, then far to near.
 //==================================================================================
 // World System: Level Helpers
 //==================================================================================
 static int _RGL_FindLevelIndex(const char* level_name); // Finds the internal array index for a level given its unique string name.
 static bool _RGL_TriangulateFlat(const RGLFlat* flat, const RGLVertex3D_pos* vertices, int* triangle_indices, size_t* triangle_count); // Converts a potentially non-convex polygon (a "flat") into a list of drawable triangles.
 static void _RGL_DrawLevelDebug(const RGLLevel* level); // The internal implementation for drawing a level's wireframe debug view.
+static void _RGL_ComputeLevelTransform(const RGLLevel* level, mat4 out_transform); // Builds a level's local-to-world matrix from its position and rotation.
+static bool _RGL_BuildLevelStaticGeometry(RGLLevel* level, mat4 transform); // Bakes walls and flats into a static indexed mesh in world space and builds the level's culling grid.
+static void _RGL_FreeLevelStaticGeometry(RGLLevel* level); // Releases a level's cached GPU geometry.
+static int _RGL_FindOrAddLevelTexture(RGLTexture** textures, size_t* count, size_t* capacity, RGLTexture texture); // Finds or appends a texture in the table used while baking a level.
+static inline uint32_t _RGL_LevelCellIndex(const RGLLevel* level, float x, float z); // Maps a level-local XZ position to its spatial grid cell.
+static inline void _RGL_ExpandLevelCell(RGLLevelCell* cell, const vec3 point, float padding); // Grows a grid cell's world-space bounds to include a point.
+static inline bool _RGL_IsLevelCellVisible(const uint32_t* visible, uint32_t cell); // Tests a cell's bit in a queued draw's visible-cell mask.
+static inline bool _RGL_IsLevelTextureOpaque(const RGLTexture* texture); // True if baked level geometry with this texture needs no blending.
+static void _RGL_DrawQueuedStaticLevels(bool translucent); // (Flush-time) Issues the opaque or the translucent indexed draws for every level queued this batch.
+static void _RGL_DrawTranslucentLevelPass(bool bindless); // (Flush-time) Draws the queued levels' translucent ranges over the opaque world without writing depth.
+static void _RGL_QueueActiveLevel(RGLLevel* level); // Revalidates a level's cache, culls its grid cells and queues the visible walls, flats and things.
 //==================================================================================
 // World System: Scenery Helpers
 //==================================================================================
-static void _RGL_DrawPathScenery(RGLPathPoint* path_point, RGLScenery* scenery); // The core scenery dispatcher; looks up the registered style for a scenery object and calls its drawing function.
+static void _RGL_DrawPathScenery(const RGLPathData* path, size_t index, RGLScenery* scenery); // The core scenery dispatcher; looks up the registered style for a scenery object and calls its drawing function.
+static void _RGL_GetPathSceneryPosition(const RGLPathData* path, size_t index, const RGLScenery* scenery, vec3 out_pos); // World position of a scenery object's anchor.
 //==================================================================================
 // 3D Primitive & Mesh Helpers
 //==================================================================================
@@ -1251,6 +2827,93 @@ static void _RGL_Draw3DQuad(vec3 center, vec3 right_vec, vec3 up_vec, float x_st
 static void _RGL_DrawCubeFaces(vec3 position, float size, RGLMaterial material); // Queues the 6 individual, correctly-lit faces of a 3D cube for drawing.
 static void _RGL_DrawLineQuad(vec3 start, vec3 end, float thickness, Color color); // Calculates the 4 vertices of a 3D quad that represents a thick line and queues it.
 static RGLMesh _RGL_CreateMeshFromParShape(par_shapes_mesh* shape); // The core mesh integration function; converts a par_shapes mesh into a fully managed RGLMesh.
+static bool _RGL_BuildMeshAdjacency(const vec3* vertices, int vertex_count, const unsigned int* indices, int index_count, unsigned int* out_adjacency); // Writes 6 adjacency indices per triangle, welding vertices by position.
+static bool _RGL_BuildMeshShadowData(RGLMesh* mesh); // Caches a mesh's adjacency and uploads its shadow-volume VAO. Called once when a mesh is created.
+static void _RGL_FreeMeshShadowData(RGLMesh* mesh); // Frees the adjacency and shadow-volume GPU buffers of a mesh.
+static GLuint _RGL_CreateShaderProgram(const char* vs_source, const char* gs_source, const char* fs_source); // Compiles and links a raw GL program; gs_source may be NULL. Returns 0 on failure.
+static bool _RGL_AtlasPageAllocate(RGLAtlasPage* page, int width, int height, int* out_x, int* out_y); // Reserves a rectangle on an atlas page's shelves; false if it does not fit.
+static RGLAtlasPage* _RGL_AddAtlasPage(void); // Creates an empty RGBA8 sprite atlas page.
+//==================================================================================
+// Text Run Helpers
+//==================================================================================
+static void _RGL_MakeTextLayoutKey(const RGLBitmapFont* font, float box_width, float box_height, bool word_wrap, RGLTextLayoutKey* out_key); // Captures the font metrics (and clip box) a layout depends on.
+static uint64_t _RGL_HashTextLayout(const char* text, size_t length, const RGLTextLayoutKey* key); // FNV-1a over the text and its layout key; never returns 0.
+static bool _RGL_ReserveGlyphQuads(RGLTextRun* run, size_t capacity); // Grows a run's glyph array to hold at least `capacity` quads.
+static bool _RGL_LayoutTextRun(RGLTextRun* run, const char* text); // Lays a string out into run->quads using run->key, and measures it.
+static RGLTextRun* _RGL_GetTextRun(const char* text, const RGLTextLayoutKey* key); // Returns the cached layout of a string, building it on a miss. NULL on failure.
+static void _RGL_FreeTextRun(RGLTextRun* run); // Frees a run's buffers and marks its slot empty.
+static void _RGL_EmitTextRun(const RGLTextRun* run, RGLTexture atlas, float x, float y, Color color); // Writes a run's glyph quads directly into the command buffer at (x, y).
+static void _RGL_DrawTextLayout(const char* text, const RGLTextLayoutKey* key, RGLTexture atlas, float x, float y, Color color); // Draws a layout through the cache, or uncached when recording on a worker thread.
+//==================================================================================
+// Async Asset Helpers
+//==================================================================================
+static bool _RGL_DecodeObjMesh(const char* filename, RGLMesh* out_mesh, RGLVertex3D** out_gpu_vertices); // (Any thread) Parses an .obj into a mesh's CPU arrays plus the interleaved upload buffer.
+static bool _RGL_UploadDecodedMesh(RGLMesh* mesh, RGLVertex3D* gpu_vertices); // (Render thread) Creates the GPU mesh and shadow buffers of a decoded mesh; frees gpu_vertices.
+static bool _RGL_BuildMeshShadowAdjacency(RGLMesh* mesh); // (Any thread) Fills mesh->cpu_adjacency; the CPU half of _RGL_BuildMeshShadowData.
+static void _RGL_EnsureAsyncPlaceholders(void); // Creates the checkerboard texture and cube returned while loads are pending.
+static struct RGLAsyncLoad* _RGL_FindAsyncLoad(RGLAssetHandle handle); // Looks up a live (unreleased) load.
+static void _RGL_PumpAsyncLoads(void); // (RGL_Begin) Uploads decoded loads within the frame budget, fires callbacks, drops released entries.
+static void _RGL_ShutdownAsyncLoads(void); // Releases every load and destroys the placeholders.
+#ifdef SITUATION_ENABLE_THREADING
+static void _RGL_FreeAsyncLoad(RGLAsyncLoad* load); // Frees a load and any decoded data it still owns.
+static void _RGL_AsyncLoadJob(void* data, void* user); // Pool job: reads and decodes one load's file, then hands it to the render thread.
+static RGLAssetHandle _RGL_SubmitAsyncLoad(SituationThreadPool* pool, RGLAsyncKind kind, const char* filename, bool generate_mipmaps, RGLAssetCallback callback, void* user_data); // Registers a load and queues its decode job.
+static bool _RGL_FinishAsyncLoad(RGLAsyncLoad* load); // (Render thread) Uploads a decoded load.
+#endif
+//==================================================================================
+// Render Target Pool Helpers
+//==================================================================================
+static int _RGL_FindRenderTargetSlot(int display_id); // Returns the pool slot holding a virtual display, or -1 if it is not pooled.
+static void _RGL_ConfigurePooledTarget(int display_id, bool visible); // Resets a pooled display to RGL_CreateRenderTexture's defaults, shown or hidden.
+static void _RGL_ShutdownRenderTargetPool(void); // Disables dynamic resolution and destroys every pooled display.
+static float _RGL_QuantizeDynamicScale(float scale); // Clamps a scale to the settings' range and rounds it to scale_step.
+static float _RGL_NextDynamicScale(const RGLDynamicResolution* settings, float scale, float average_ms); // The controller's step: the scale to move to for an average frame time (scale itself inside the dead band).
+static float _RGL_GetDynamicResolutionWorkTime(void); // Consumes the default controller input: the larger of the frame's CPU work time and its (late) GPU time.
+static void _RGL_DynamicResolutionBeginPass(void); // (RGL_Begin) Issues the pass's GPU begin timestamp.
+static void _RGL_DynamicResolutionEndPass(void); // (RGL_End) Issues the pass's GPU end timestamp.
+static void _RGL_ResolveDynamicResolutionQueries(int set, bool discard_pending); // Reads a finished set's pass times into gpu_ms.
+static void _RGL_DestroyDynamicResolutionQueries(void);
+//==================================================================================
+// Retro Post-Process Helpers
+//==================================================================================
+static bool _RGL_InitRetroEffects(void); // Builds the retro pass program and bakes the YPQ conversion lookup textures.
+static void _RGL_ShutdownRetroEffects(void); // Deletes the retro pass program and textures.
+static bool _RGL_UpdateRetroPalette(const Color* palette, int palette_size); // Rebakes the palette lookup texture if the palette changed.
+static GLuint _RGL_CreateLUT3D(int size, const uint8_t* texels, GLint filter, GLint wrap_s); // Uploads an RGBA8 cube of size^3 texels.
+//==================================================================================
+// Binary Mesh File Helpers
+//==================================================================================
+static bool _RGL_MapFile(const char* filename, RGLMappedFile* out_file); // Maps a whole file read-only. False if it is missing or empty.
+static void _RGL_UnmapFile(RGLMappedFile* file); // Releases a mapping made by _RGL_MapFile.
+static bool _RGL_ValidateMeshFile(const RGLMappedFile* file); // Checks a mapped .rglmesh header, that every block lies inside the file and that every index is in range.
+static void _RGL_ComputeMeshFileLayout(RGLMeshFileHeader* header, bool has_adjacency); // Fills the block offsets and file size from the counts.
+static bool _RGL_WriteMeshBinary(const RGLMesh* mesh, const char* filename, int64_t source_mod_time); // Writes a mesh's CPU data as .rglmesh.
+static bool _RGL_UploadMappedMesh(const RGLMappedFile* file, RGLMesh* out_mesh); // Creates a mesh straight from a validated mapping.
+//==================================================================================
+// Profiling Helpers
+//==================================================================================
+static void _RGL_ProfileBeginFrame(void); // (RGL_Begin) Opens the next ring record and issues the frame's first GPU timestamp.
+static void _RGL_ProfileEndFrame(void); // (RGL_End) Closes any open zones and the frame's record.
+static void _RGL_ProfileCloseZone(void); // Closes the innermost zone and issues its end timestamp.
+static void _RGL_ResolveProfileQueries(int set, bool discard_pending); // Reads back a query set's timestamps into its frame record, if the GPU has finished them.
+static void _RGL_ShutdownProfiler(void); // Deletes the timestamp queries and frees the frame ring.
+static void _RGL_TraceAppend(char* buf, size_t buf_size, size_t* length, const char* format, ...); // snprintf onto a trace buffer, counting the full length even past buf_size.
+static void _RGL_TraceAppendEvent(char* buf, size_t buf_size, size_t* length, const char* name, int tid, double start_us, double duration_us); // Appends one complete ("X") trace event.
+#ifdef RGL_ENABLE_BENCHMARKS
+//==================================================================================
+// Benchmark Helpers
+//==================================================================================
+static float _RGL_BenchmarkRandom(RGLBenchmarkScene* scene); // Fixed-seed xorshift32 in [0, 1).
+static void _RGL_BenchmarkMeasure(RGLBenchmarkScene* scene, RGLBenchmarkScenario scenario, int variant, void (*draw_frame)(RGLBenchmarkScene* scene, int frame), RGLBenchmarkResult* out_result); // Times warmup plus measured frames and averages their stats.
+static void _RGL_BenchmarkDrawSprites(RGLBenchmarkScene* scene, int frame); // One frame of the sprite scenario.
+static void _RGL_BenchmarkDrawPath(RGLBenchmarkScene* scene, int frame); // One frame of the path scenario.
+static void _RGL_BenchmarkDrawLevel(RGLBenchmarkScene* scene, int frame); // One frame of the level scenario.
+static void _RGL_BenchmarkDrawLights(RGLBenchmarkScene* scene, int frame); // One frame of the light and stencil shadow scenario.
+static void _RGL_BenchmarkDrawText(RGLBenchmarkScene* scene, int frame); // One frame of the text scenario.
+static bool _RGL_BenchmarkBuildPath(RGLBenchmarkScene* scene); // Generates and activates the benchmark path.
+static bool _RGL_BenchmarkBuildLevel(RGLBenchmarkScene* scene); // Generates and activates the benchmark level.
+static bool _RGL_BenchmarkGenerateItems(RGLBenchmarkScene* scene, int count, bool world_space); // Pre-generates the random sprites or casters.
+#endif // RGL_ENABLE_BENCHMARKS
 //==================================================================================
 // Debug & Calibration Helpers
 //==================================================================================
@@ -1271,6 +2934,8 @@ static float _lerp(float a, float b, float t); // Basic linear interpolation bet
 static float _catmull_rom(float p0, float p1, float p2, float p3, float t); // Calculates a point on a Catmull-Rom spline for smooth path curves.
 static inline unsigned char _RGL_ClampToU8(int value); // Clamps an integer to the valid range for an unsigned char [0-255].
 static inline float _RGL_Clamp01(float value); // Clamps a float to the normalized range [0.0-1.0].
+static inline uint16_t _RGL_FloatToHalf(float value); // Converts a float to an IEEE 754 half float (round-to-nearest), for packed vertex UVs.
+static inline void _RGL_OctEncodeNormal(const vec3 normal, int16_t out_oct[2]); // Encodes a direction as a 2-component SNORM16 octahedral normal.
 
 
 // --- Static Helper Implementations ---
@@ -1356,6 +3021,9 @@ static RGLMesh _RGL_CreateMeshFromParShape(par_shapes_mesh* shape) {
     par_shapes_free_mesh(shape);
 
     // --- 5. Finalize ---
+    // Shadow data is optional: without it, casting falls back to streaming per-call adjacency.
+    _RGL_BuildMeshShadowData(&rgl_mesh);
+
     // TODO: Add the mesh to a managed list and assign a real ID.
     // For now, a non-zero ID indicates success.
     rgl_mesh.id = 1;
@@ -1363,6 +3031,193 @@ static RGLMesh _RGL_CreateMeshFromParShape(par_shapes_mesh* shape) {
     return rgl_mesh;
 }
 
+typedef struct {
+    uint32_t a, b;      // Welded endpoints of a directed edge; a == UINT32_MAX marks an empty slot.
+    uint32_t opposite;  // Original index of the triangle's third vertex.
+} _RGLAdjacencyEdge;
+
+static inline uint32_t _RGL_HashVertexPosition(const vec3 position) {
+    uint32_t bits[3];
+    vec3 p = { position[0] + 0.0f, position[1] + 0.0f, position[2] + 0.0f }; // Folds -0.0 into +0.0
+    memcpy(bits, p, sizeof(bits));
+    return (bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u);
+}
+
+static inline bool _RGL_VertexPositionsEqual(const vec3 a, const vec3 b) {
+    return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+}
+
+static inline uint32_t _RGL_HashEdge(uint32_t a, uint32_t b) {
+    return (a * 2654435761u) ^ (b * 40503u + 0x9E3779B9u);
+}
+
+static bool _RGL_BuildMeshAdjacency(const vec3* vertices, int vertex_count, const unsigned int* indices, int index_count, unsigned int* out_adjacency) {
+    int triangle_count = index_count / 3;
+    if (!vertices || !indices || !out_adjacency || vertex_count <= 0 || triangle_count <= 0) return false;
+
+    // 1. --- Allocate the weld and edge tables (open addressing, power-of-two sizes) ---
+    size_t weld_size = 16;
+    while (weld_size < (size_t)vertex_count * 2) weld_size <<= 1;
+    size_t edge_size = 16;
+    while (edge_size < (size_t)triangle_count * 6) edge_size <<= 1;
+
+    uint32_t* canonical = (uint32_t*)malloc(sizeof(uint32_t) * vertex_count);
+    uint32_t* weld_table = (uint32_t*)malloc(sizeof(uint32_t) * weld_size);
+    _RGLAdjacencyEdge* edge_table = (_RGLAdjacencyEdge*)malloc(sizeof(_RGLAdjacencyEdge) * edge_size);
+    if (!canonical || !weld_table || !edge_table) {
+        free(canonical); free(weld_table); free(edge_table);
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate mesh adjacency tables.");
+        return false;
+    }
+    memset(weld_table, 0xFF, sizeof(uint32_t) * weld_size);
+    for (size_t i = 0; i < edge_size; i++) edge_table[i].a = UINT32_MAX;
+
+    // 2. --- Weld vertices by position ---
+    // The OBJ loader emits unindexed triangles, so shared edges can only be matched by position.
+    for (int v = 0; v < vertex_count; v++) {
+        size_t slot = _RGL_HashVertexPosition(vertices[v]) & (weld_size - 1);
+        while (weld_table[slot] != UINT32_MAX && !_RGL_VertexPositionsEqual(vertices[weld_table[slot]], vertices[v])) {
+            slot = (slot + 1) & (weld_size - 1);
+        }
+        if (weld_table[slot] == UINT32_MAX) weld_table[slot] = (uint32_t)v;
+        canonical[v] = weld_table[slot];
+    }
+
+    // 3. --- Insert every directed edge with the vertex opposite it ---
+    for (int t = 0; t < triangle_count; t++) {
+        const unsigned int* tri = &indices[t * 3];
+        if (tri[0] >= (unsigned int)vertex_count || tri[1] >= (unsigned int)vertex_count || tri[2] >= (unsigned int)vertex_count) {
+            free(canonical); free(weld_table); free(edge_table);
+            _SituationSetErrorFromCode(SITUATION_ERROR_INVALID_PARAM, "Mesh index out of range while building adjacency.");
+            return false;
+        }
+        for (int e = 0; e < 3; e++) {
+            uint32_t a = canonical[tri[e]], b = canonical[tri[(e + 1) % 3]];
+            size_t slot = _RGL_HashEdge(a, b) & (edge_size - 1);
+            while (edge_table[slot].a != UINT32_MAX) slot = (slot + 1) & (edge_size - 1);
+            edge_table[slot] = (_RGLAdjacencyEdge){ a, b, tri[(e + 2) % 3] };
+        }
+    }
+
+    // 4. --- Resolve each edge's neighbour through the reversed edge ---
+    // Open edges reuse the triangle's own far vertex: the shader sees a reversed neighbour and
+    // treats the edge as a silhouette, which is what a sprite quad or open level mesh needs.
+    for (int t = 0; t < triangle_count; t++) {
+        const unsigned int* tri = &indices[t * 3];
+        for (int e = 0; e < 3; e++) {
+            uint32_t a = canonical[tri[e]], b = canonical[tri[(e + 1) % 3]];
+            unsigned int neighbour = tri[(e + 2) % 3];
+            size_t slot = _RGL_HashEdge(b, a) & (edge_size - 1);
+            while (edge_table[slot].a != UINT32_MAX) {
+                if (edge_table[slot].a == b && edge_table[slot].b == a) { neighbour = edge_table[slot].opposite; break; }
+                slot = (slot + 1) & (edge_size - 1);
+            }
+            out_adjacency[t * 6 + e * 2 + 0] = tri[e];
+            out_adjacency[t * 6 + e * 2 + 1] = neighbour;
+        }
+    }
+
+    free(canonical);
+    free(weld_table);
+    free(edge_table);
+    return true;
+}
+
+static bool _RGL_BuildMeshShadowAdjacency(RGLMesh* mesh) {
+    if (!mesh || !mesh->cpu_vertices || !mesh->cpu_indices || mesh->index_count < 3) return false;
+
+    size_t adjacency_count = (size_t)(mesh->index_count / 3) * 6;
+    mesh->cpu_adjacency = (unsigned int*)malloc(sizeof(unsigned int) * adjacency_count);
+    if (!mesh->cpu_adjacency) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate mesh adjacency.");
+        return false;
+    }
+    if (!_RGL_BuildMeshAdjacency(mesh->cpu_vertices, mesh->vertex_count, mesh->cpu_indices, mesh->index_count, mesh->cpu_adjacency)) {
+        free(mesh->cpu_adjacency);
+        mesh->cpu_adjacency = NULL;
+        return false;
+    }
+    return true;
+}
+
+static bool _RGL_BuildMeshShadowData(RGLMesh* mesh) {
+    if (!mesh || !mesh->cpu_vertices || !mesh->cpu_indices || mesh->index_count < 3) return false;
+
+    // Async mesh loads already built the adjacency on their worker.
+    if (!mesh->cpu_adjacency && !_RGL_BuildMeshShadowAdjacency(mesh)) return false;
+    size_t adjacency_count = (size_t)(mesh->index_count / 3) * 6;
+
+    // Object-space positions only; the shadow shader applies the caster transform per draw.
+    glGenVertexArrays(1, &mesh->shadow_vao);
+    glGenBuffers(1, &mesh->shadow_vbo);
+    glGenBuffers(1, &mesh->shadow_ibo);
+    glBindVertexArray(mesh->shadow_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh->shadow_vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vec3) * mesh->vertex_count, mesh->cpu_vertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(vec3), (void*)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->shadow_ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * adjacency_count, mesh->cpu_adjacency, GL_STATIC_DRAW);
+    glBindVertexArray(0);
+    return true;
+}
+
+static void _RGL_FreeMeshShadowData(RGLMesh* mesh) {
+    if (!mesh) return;
+    if (mesh->shadow_vao) glDeleteVertexArrays(1, &mesh->shadow_vao);
+    if (mesh->shadow_vbo) glDeleteBuffers(1, &mesh->shadow_vbo);
+    if (mesh->shadow_ibo) glDeleteBuffers(1, &mesh->shadow_ibo);
+    free(mesh->cpu_adjacency);
+    mesh->cpu_adjacency = NULL;
+    mesh->shadow_vao = mesh->shadow_vbo = mesh->shadow_ibo = 0;
+}
+
+static GLuint _RGL_CompileShaderStage(GLenum stage, const char* source) {
+    GLuint shader = glCreateShader(stage);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    GLint ok = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+    if (!ok) {
+        char info_log[512];
+        glGetShaderInfoLog(shader, sizeof(info_log), NULL, info_log);
+        _SituationSetErrorFromCode(SITUATION_ERROR_OPENGL_SHADER_COMPILE_FAILED, info_log);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+static GLuint _RGL_CreateShaderProgram(const char* vs_source, const char* gs_source, const char* fs_source) {
+    GLuint vs = _RGL_CompileShaderStage(GL_VERTEX_SHADER, vs_source);
+    GLuint gs = gs_source ? _RGL_CompileShaderStage(GL_GEOMETRY_SHADER, gs_source) : 0;
+    GLuint fs = _RGL_CompileShaderStage(GL_FRAGMENT_SHADER, fs_source);
+    GLuint program = 0;
+
+    if (vs && fs && (gs || !gs_source)) {
+        program = glCreateProgram();
+        glAttachShader(program, vs);
+        if (gs) glAttachShader(program, gs);
+        glAttachShader(program, fs);
+        glLinkProgram(program);
+        GLint ok = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &ok);
+        if (!ok) {
+            char info_log[512];
+            glGetProgramInfoLog(program, sizeof(info_log), NULL, info_log);
+            _SituationSetErrorFromCode(SITUATION_ERROR_OPENGL_SHADER_LINK_FAILED, info_log);
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+
+    // The linked program keeps its own copy of the stages.
+    if (vs) glDeleteShader(vs);
+    if (gs) glDeleteShader(gs);
+    if (fs) glDeleteShader(fs);
+    return program;
+}
+
 // VISUAL TYPES (Always draw)
 static void _RGL_DrawScenery_Sprite(const RGLScenery* scenery, const RGLPathPoint* path_point, const vec3* world_pos, void* user_data) {
     (void)path_point; (void)user_data;
@@ -1426,24 +3281,92 @@ SITAPI void RGL_ToggleDebugDrawTriggers(void) {
     g_debug_draw_triggers = !g_debug_draw_triggers;
 }
 
-static int _RGL_CompareDrawCommands(const void* a, const void* b) {
-    const RGLInternalDraw* cmd_a = (const RGLInternalDraw*)a;
-    const RGLInternalDraw* cmd_b = (const RGLInternalDraw*)b;
+/**
+ * @brief (INTERNAL) Decides whether a command can be drawn in the opaque pass.
+ * A command is opaque when every vertex alpha is 1.0 and it is either untextured or uses a
+ * texture flagged with RGL_SetTextureOpaque(). Textures default to "may be translucent".
+ */
+static inline bool _RGL_IsCommandOpaque(const RGLInternalDraw* cmd) {
+    if (cmd->texture.texture.slot_index != 0 && !cmd->texture.is_opaque) return false;
+    int vertex_count = cmd->is_triangle ? 3 : 4;
+    for (int v = 0; v < vertex_count; v++) {
+        if (cmd->colors[v][3] < 1.0f) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief (INTERNAL) Builds the 64-bit batch sort key for a draw command.
+ * The float depth is mapped to an unsigned integer with the same ordering (flip all bits for
+ * negatives, set the sign bit for positives). Opaque commands are keyed texture-first and
+ * front-to-back; translucent commands keep the old painter's ordering: depth (back-to-front),
+ * then texture, then triangles first.
+ */
+static inline uint64_t _RGL_MakeSortKey(const RGLInternalDraw* cmd) {
+    uint32_t z_bits;
+    memcpy(&z_bits, &cmd->z_depth, sizeof(z_bits));
+    z_bits = (z_bits & 0x80000000u) ? ~z_bits : (z_bits | 0x80000000u);
 
-    // Primary sort: Z-depth, back-to-front for correct alpha blending.
-    if (cmd_a->z_depth > cmd_b->z_depth) return -1;
-    if (cmd_a->z_depth < cmd_b->z_depth) return 1;
+    uint64_t prim_bit = cmd->is_triangle ? 0u : 1u;
+    uint32_t slot = cmd->texture.texture.slot_index;
 
-    // Secondary sort: Group by texture to minimize binding changes.
-    // Use the slot_index for comparison in the new RGLTexture (wrapping SituationTexture)
-    if (cmd_a->texture.texture.slot_index < cmd_b->texture.texture.slot_index) return -1;
-    if (cmd_a->texture.texture.slot_index > cmd_b->texture.texture.slot_index) return 1;
+    if (_RGL_IsCommandOpaque(cmd)) {
+        if (slot > 0x7FFFFFFFu) slot = 0x7FFFFFFFu;
+        return ((uint64_t)slot << 32) | ((uint64_t)(z_bits >> 1) << 1) | prim_bit;
+    }
 
-    // Tertiary sort: Group triangles and quads together.
-    if (cmd_a->is_triangle && !cmd_b->is_triangle) return -1;
-    if (!cmd_a->is_triangle && cmd_b->is_triangle) return 1;
+    if (slot > 0x3FFFFFFFu) slot = 0x3FFFFFFFu;
+    z_bits = ~z_bits; // Descending depth
+    return RGL_SORT_KEY_ALPHA_BIT | ((uint64_t)z_bits << 31) | ((uint64_t)slot << 1) | prim_bit;
+}
 
-    return 0;
+/**
+ * @brief (INTERNAL) Sorts (key, index) records with an 8-bit-digit LSD radix sort.
+ * All eight digit histograms are built in a single pass. Passes where every key shares the
+ * same digit (e.g. the slot bits in an untextured batch, or the high depth bits of a flat 2D
+ * scene) are skipped entirely, so typical frames only pay for a few scatter passes.
+ *
+ * @param keys The records to sort.
+ * @param scratch A buffer of at least `count` records used for ping-ponging.
+ * @param count The number of records.
+ * @return A pointer to the sorted records (either `keys` or `scratch`).
+ */
+static RGLSortKey* _RGL_RadixSortKeys(RGLSortKey* keys, RGLSortKey* scratch, size_t count) {
+    if (count < 2) return keys;
+
+    // 1. --- Build all digit histograms in one pass ---
+    size_t histograms[8][256];
+    memset(histograms, 0, sizeof(histograms));
+    for (size_t i = 0; i < count; i++) {
+        uint64_t key = keys[i].key;
+        for (int pass = 0; pass < 8; pass++) {
+            histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+        }
+    }
+
+    // 2. --- Scatter, one pass per significant digit ---
+    RGLSortKey* src = keys;
+    RGLSortKey* dst = scratch;
+    for (int pass = 0; pass < 8; pass++) {
+        size_t* counts = histograms[pass];
+        int shift = pass * 8;
+
+        // Skip the pass if all keys land in one bucket; the order would not change.
+        if (counts[(src[0].key >> shift) & 0xFF] == count) continue;
+
+        size_t offset = 0;
+        for (int b = 0; b < 256; b++) {
+            size_t c = counts[b];
+            counts[b] = offset;
+            offset += c;
+        }
+        for (size_t i = 0; i < count; i++) {
+            dst[counts[(src[i].key >> shift) & 0xFF]++] = src[i];
+        }
+
+        RGLSortKey* tmp = src; src = dst; dst = tmp;
+    }
+    return src;
 }
 
 /**
@@ -1455,6 +3378,9 @@ static int _RGL_CompareDrawCommands(const void* a, const void* b) {
  * @return True on success, false on a fatal memory allocation failure.
  */
 static bool _RGL_EnsureCommandCapacity(size_t required_command_count) {
+    // Worker threads never touch the shared batch; they grow their own list.
+    if (g_rgl_recording_list) return _RGL_EnsureCommandListCapacity(g_rgl_recording_list, required_command_count);
+
     if (RGL.command_count + required_command_count <= RGL.command_capacity) return true; // Already have enough capacity
 
     size_t new_capacity = RGL.command_capacity;
@@ -1468,7 +3394,12 @@ static bool _RGL_EnsureCommandCapacity(size_t required_command_count) {
     // Clamp to a safe maximum to prevent runaway allocations.
     if (new_capacity > RGL_MAX_BATCH_CAPACITY) new_capacity = RGL_MAX_BATCH_CAPACITY;
 
-    if (new_capacity <= RGL.command_capacity) {
+    if (new_capacity < RGL.command_count + required_command_count) {
+        // At the size limit: draw what is queued and start over with an empty batch.
+        if (RGL.is_batching && RGL.command_count > 0 && required_command_count <= new_capacity) {
+            _RGL_FlushBatch();
+            return _RGL_EnsureCommandCapacity(required_command_count);
+        }
         _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Cannot grow batch buffer: maximum capacity reached.");
         return false;
     }
@@ -1480,23 +3411,34 @@ static bool _RGL_EnsureCommandCapacity(size_t required_command_count) {
     }
     RGL.commands = new_commands;
 
-    // Each command is a quad (6 vertices), with 10 floats each.
-    const int floats_per_vertex = 10;
-    size_t new_vbo_floats = new_capacity * 6 * floats_per_vertex;
+    // The sort records must be able to index every command slot.
+    RGLSortKey* new_keys = realloc(RGL.sort_keys, sizeof(RGLSortKey) * new_capacity);
+    if (!new_keys) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to reallocate batch sort keys");
+        return false;
+    }
+    RGL.sort_keys = new_keys;
+    RGLSortKey* new_scratch = realloc(RGL.sort_keys_scratch, sizeof(RGLSortKey) * new_capacity);
+    if (!new_scratch) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to reallocate batch sort scratch buffer");
+        return false;
+    }
+    RGL.sort_keys_scratch = new_scratch;
+
+    // Each command is a quad (4 vertices, indexed) in the batch vertex format.
+    size_t new_vbo_vertices = new_capacity * 4;
+    size_t old_vbo_vertices = RGL.batch_vertex_capacity;
 
-    float* new_vbo = realloc(RGL.cpu_vertex_buffer, new_vbo_floats * sizeof(float));
-    if (!new_vbo) {
+    // Any pending draws still reference the old buffer; GL defers its deletion until they retire.
+    _RGL_DestroyBatchVertexStorage();
+    if (!_RGL_CreateBatchVertexStorage(new_vbo_vertices)) {
         // This is not ideal, but not fatal. We can't grow the VBO, so we'll have to flush more often.
         _SituationSetWarning("Failed to grow vertex buffer, performance may be impacted.");
-        // We can't update the GPU buffer size, so we leave the old capacities in place.
-    } else {
-        RGL.cpu_vertex_buffer = new_vbo;
-        RGL.cpu_vertex_buffer_floats_capacity = new_vbo_floats;
-
-        // Update the size of the buffer on the GPU to match.
-        glBindBuffer(GL_ARRAY_BUFFER, RGL.batch_vbo);
-        glBufferData(GL_ARRAY_BUFFER, new_vbo_floats * sizeof(float), NULL, GL_DYNAMIC_DRAW);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        _RGL_DestroyBatchVertexStorage(); // Whatever the failed attempt left behind must not leak under the retry
+        if (!_RGL_CreateBatchVertexStorage(old_vbo_vertices)) {
+            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to recreate batch vertex buffer");
+            return false;
+        }
     }
 
     RGL.command_capacity = new_capacity;
@@ -1505,219 +3447,766 @@ static bool _RGL_EnsureCommandCapacity(size_t required_command_count) {
 }
 
 /**
- * @brief (INTERNAL) Processes and draws all queued commands with dynamic lighting.
+ * @brief (INTERNAL) Ensures a per-thread command list can take more commands.
+ * Lists only hold CPU records, so unlike the frame batch they have no GPU-side limit;
+ * submission splits them across flushes if needed.
  *
- * This is the heart of the renderer's performance. It follows a high-performance strategy:
- * 1.  Sorts all queued commands by Z-depth (for correct alpha blending) and then by texture
- *     (to minimize GPU state changes).
- * 2.  Assembles a single, large vertex buffer on the CPU for the new 13-float format
- *     (pos, normal, uv, color, light_level).
- * 3.  Performs frustum culling and priority sorting on all active lights in the scene.
- * 4.  Packs the data for the most important lights into a temporary struct.
- * 5.  Uploads the lighting data to the GPU's Uniform Buffer Object (UBO) in one transfer.
- * 6.  Uploads the entire vertex data buffer to the GPU's VBO in one transfer.
- * 7.  Iterates through the sorted commands, issuing the minimum number of batched 'glDrawArrays' calls.
+ * @param list The list to grow.
+ * @param required_command_count The minimum number of available command slots needed.
+ * @return True on success, false on a memory allocation failure.
  */
-static void _RGL_FlushBatch(void) {
-    if (!RGL.is_batching || RGL.command_count == 0) return;
-
-    RGL.stats.batch_flushes++; // Path this statistic
+static bool _RGL_EnsureCommandListCapacity(RGLCommandList* list, size_t required_command_count) {
+    if (list->command_count + required_command_count <= list->command_capacity) return true;
 
-    // --- 1. Sort Commands (from your original logic) ---
-    qsort(RGL.commands, RGL.command_count, sizeof(RGLInternalDraw), _RGL_CompareDrawCommands);
+    size_t new_capacity = list->command_capacity ? list->command_capacity : RGL_COMMAND_LIST_DEFAULT_CAPACITY;
+    while (new_capacity < list->command_count + required_command_count) new_capacity *= 2;
 
-    // --- 2. Assemble CPU Vertex Buffer (for the NEW 13-float format) ---
-    const int floats_per_vertex = 13; // 3(pos)+3(norm)+2(uv)+4(color)+1(light)
-    float* vertex_ptr = RGL.cpu_vertex_buffer;
-    size_t vertices_written = 0;
-
-    for (size_t i = 0; i < RGL.command_count; i++) {
-        RGLInternalDraw* cmd = &RGL.commands[i];
+    RGLInternalDraw* new_commands = realloc(list->commands, sizeof(RGLInternalDraw) * new_capacity);
+    if (!new_commands) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to grow command list");
+        return false;
+    }
+    list->commands = new_commands;
+    list->command_capacity = new_capacity;
+    return true;
+}
 
-        size_t verts_in_cmd = cmd->is_triangle ? 3 : 6;
-        if ((vertices_written + verts_in_cmd) * floats_per_vertex > RGL.cpu_vertex_buffer_floats_capacity) {
-            _SituationSetWarning("RGL batch capacity reached. Some draw commands were dropped.");
-            break;
+/**
+ * @brief (INTERNAL) Hands out transient scratch memory from the per-frame linear arena.
+ *
+ * Allocation bumps the arena offset by the size rounded up to RGL_FRAME_ARENA_ALIGNMENT; nothing is
+ * freed on its own. A helper that builds and discards buffers takes a _RGL_FrameArenaMark first and
+ * rewinds to it when done, so many such builds in one frame share the same bytes. A request that does
+ * not fit is served by malloc and still counted towards the frame's peak, and the next RGL_Begin grows
+ * the arena to that peak so later frames of the same shape stay inside the one block.
+ * Outside RGL_Begin/RGL_End (load-time builds), every request is a plain heap block freed by the
+ * rewind, and nothing is counted, so a one-off load never sizes the arena.
+ * The arena belongs to the render thread; worker threads recording command lists must not use it.
+ *
+ * @param size Bytes needed. Zero returns NULL.
+ * @return The scratch pointer, or NULL (with the error set) if the overflow malloc failed too.
+ */
+static void* _RGL_FrameAlloc(size_t size) {
+    if (size == 0) return NULL;
+    bool in_frame = RGL.is_batching;
+
+    // 1. --- Create the arena block on first use ---
+    if (in_frame && !RGL.frame_arena.base) {
+        RGL.frame_arena.base = (uint8_t*)malloc(RGL_FRAME_ARENA_INITIAL_SIZE);
+        RGL.frame_arena.capacity = RGL.frame_arena.base ? RGL_FRAME_ARENA_INITIAL_SIZE : 0;
+        RGL.frame_arena.offset = 0;
+    }
+
+    // 2. --- Bump-allocate when the request fits ---
+    size_t aligned = (size + RGL_FRAME_ARENA_ALIGNMENT - 1) & ~(size_t)(RGL_FRAME_ARENA_ALIGNMENT - 1);
+    void* result = NULL;
+    if (in_frame && aligned <= RGL.frame_arena.capacity - RGL.frame_arena.offset) {
+        result = RGL.frame_arena.base + RGL.frame_arena.offset;
+        RGL.frame_arena.offset += aligned;
+    } else {
+        // 3. --- Otherwise fall back to the heap until the next reset grows the arena ---
+        // (Outside a frame this is the only path: load-time scratch never lives in the arena.)
+        size_t header = (sizeof(RGLFrameArenaBlock) + RGL_FRAME_ARENA_ALIGNMENT - 1) & ~(size_t)(RGL_FRAME_ARENA_ALIGNMENT - 1);
+        RGLFrameArenaBlock* block = (RGLFrameArenaBlock*)malloc(header + aligned);
+        if (!block) {
+            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate frame scratch memory.");
+            return NULL;
         }
+        block->next = RGL.frame_arena.overflow;
+        block->size = aligned;
+        RGL.frame_arena.overflow = block;
+        RGL.frame_arena.overflow_bytes += aligned;
+        result = (uint8_t*)block + header;
+    }
+
+    // 4. --- Track the frame's peak demand, which sizes the arena at the next reset ---
+    if (!in_frame) return result;
+    size_t in_use = RGL.frame_arena.offset + RGL.frame_arena.overflow_bytes;
+    if (in_use > RGL.stats.frame_arena_used) RGL.stats.frame_arena_used = in_use;
+    if (in_use > RGL.stats.frame_arena_high_water) RGL.stats.frame_arena_high_water = in_use;
+    return result;
+}
 
-        if (cmd->is_triangle) {
-            for (int v = 0; v < 3; v++) {
-                memcpy(vertex_ptr, cmd->world_positions[v], sizeof(vec3)); vertex_ptr += 3;
-                memcpy(vertex_ptr, cmd->normals[v],         sizeof(vec3)); vertex_ptr += 3;
-                memcpy(vertex_ptr, cmd->tex_coords[v],       sizeof(vec2)); vertex_ptr += 2;
-                memcpy(vertex_ptr, cmd->colors[v],           sizeof(vec4)); vertex_ptr += 4;
-                *vertex_ptr++ = cmd->light_levels[v];
-            }
-            vertices_written += 3;
-        } else {
-            const int indices[] = { 0, 1, 2, 0, 2, 3 };
-            for (int v = 0; v < 6; v++) {
-                int idx = indices[v];
-                memcpy(vertex_ptr, cmd->world_positions[idx], sizeof(vec3)); vertex_ptr += 3;
-                memcpy(vertex_ptr, cmd->normals[idx],         sizeof(vec3)); vertex_ptr += 3;
-                memcpy(vertex_ptr, cmd->tex_coords[idx],       sizeof(vec2)); vertex_ptr += 2;
-                memcpy(vertex_ptr, cmd->colors[idx],           sizeof(vec4)); vertex_ptr += 4;
-                *vertex_ptr++ = cmd->light_levels[idx];
-            }
-            vertices_written += 6;
-        }
-    }
+static inline RGLFrameArenaMark _RGL_FrameArenaMark(void) {
+    RGLFrameArenaMark mark = { RGL.frame_arena.offset, RGL.frame_arena.overflow, RGL.frame_arena.overflow_bytes };
+    return mark;
+}
 
-    // --- 3. Setup OpenGL State & Common Uniforms ---
-    glUseProgram(RGL.main_shader.gl_program_id);
-    glUniform1i(RGL.loc_texture_sampler, 0);
+/**
+ * @brief (INTERNAL) Hands back every frame arena allocation made since mark.
+ * Marks nest: rewind to the innermost mark first. Overflow blocks taken after the mark are freed.
+ */
+static void _RGL_FrameArenaRewind(RGLFrameArenaMark mark) {
+    while (RGL.frame_arena.overflow && RGL.frame_arena.overflow != mark.overflow) {
+        RGLFrameArenaBlock* next = RGL.frame_arena.overflow->next;
+        free(RGL.frame_arena.overflow);
+        RGL.frame_arena.overflow = next;
+    }
+    RGL.frame_arena.overflow_bytes = mark.overflow_bytes;
+    if (mark.offset < RGL.frame_arena.offset) RGL.frame_arena.offset = mark.offset;
+}
 
-    // --- NEW: Set Lighting Uniforms (from the patch) ---
-    glUniform3fv(RGL.loc_camera_pos, 1, RGL.camera_position);
-    glUniform3fv(RGL.loc_ambient_light_color, 1, RGL.ambient_light_color);
+/**
+ * @brief (INTERNAL) Starts a frame with an empty arena.
+ * Any overflow from the last frame is freed, and the block is resized to the high-water mark of the
+ * last RGL_FRAME_ARENA_WINDOW frames (RGL_FRAME_ARENA_INITIAL_SIZE doubled until it fits). It grows as
+ * soon as a frame needed more than it holds, so steady-state frames never touch the heap, and shrinks
+ * once the window's peaks fit in a quarter of it, so a past spike does not hold memory for good.
+ */
+static void _RGL_ResetFrameArena(void) {
+    RGLFrameArenaMark empty = { 0, NULL, 0 };
+    _RGL_FrameArenaRewind(empty);
+
+    // 1. --- Record the finished frame's peak and take the window's maximum ---
+    RGL.frame_arena.recent_peaks[RGL.frame_arena.recent_index] = RGL.stats.frame_arena_used;
+    RGL.frame_arena.recent_index = (RGL.frame_arena.recent_index + 1) % RGL_FRAME_ARENA_WINDOW;
+    RGL.stats.frame_arena_used = 0;
+    size_t needed = 0;
+    for (int i = 0; i < RGL_FRAME_ARENA_WINDOW; i++) {
+        if (RGL.frame_arena.recent_peaks[i] > needed) needed = RGL.frame_arena.recent_peaks[i];
+    }
+    RGL.stats.frame_arena_high_water = needed;
+
+    // 2. --- Grow to fit it, or shrink with some hysteresis; the first allocation creates the block ---
+    if (!RGL.frame_arena.base) return;
+    size_t new_capacity = RGL_FRAME_ARENA_INITIAL_SIZE;
+    while (new_capacity < needed) new_capacity *= 2;
+    bool grow = new_capacity > RGL.frame_arena.capacity;
+    bool shrink = new_capacity * 4 <= RGL.frame_arena.capacity;
+    if (!grow && !shrink) return;
+
+    // The contents are dead scratch, so this is a fresh block rather than a realloc copy.
+    uint8_t* new_base = (uint8_t*)malloc(new_capacity);
+    if (!new_base) {
+        if (grow) _SituationSetWarning("Failed to grow the frame arena; transient scratch will fall back to the heap.");
+        return;
+    }
+    free(RGL.frame_arena.base);
+    RGL.frame_arena.base = new_base;
+    RGL.frame_arena.capacity = new_capacity;
+    RGL.stats.memory_reallocations++;
+}
 
-    // --- 4. Cull, Sort, and Upload Light Data to UBO (from the patch) ---
-    // This entire block is new and self-contained.
-    {
-        // Define the UBO data structure on the CPU side.
-        struct {
-            vec4 pos_type[MAX_SHADER_LIGHTS];
-            vec4 color_intensity[MAX_SHADER_LIGHTS];
-            vec4 direction[MAX_SHADER_LIGHTS];
-            vec4 params[MAX_SHADER_LIGHTS];
-        } light_block_data;
-        memset(&light_block_data, 0, sizeof(light_block_data));
-
-        // PASS 1: Extract Frustum Planes
-        vec4 frustum_planes[6];
-        mat4 view_proj;
-        glm_mat4_mul(RGL.current_projection_matrix, RGL.current_view_matrix, view_proj);
-        _RGL_ExtractFrustumPlanes(view_proj, frustum_planes);
-
-        // PASS 2: Find all lights inside the frustum and score them
-        typedef struct { int light_index; float score; } RGLRankedLight;
-        RGLRankedLight potential_lights[RGL_MAX_LIGHTS];
-        int potential_count = 0;
-
-        ma_mutex_lock(&RGL.light_mutex);
-        for (int i = 0; i < RGL_MAX_LIGHTS; i++) {
-            if (RGL.lights[i].is_active) {
-                bool is_visible = false;
-                float score = 0.0f;
-
-                if (RGL.lights[i].type == RGL_LIGHT_TYPE_DIRECTIONAL) {
-                    is_visible = true; score = -1.0f; // Always visible, highest priority
-                } else {
-                    float bias_to_use = (RGL.lights[i].culling_bias > 0.0f) ? RGL.lights[i].culling_bias : RGL_LIGHT_CULLING_BIAS;
-                    if (_RGL_FrustumIntersectsSphere(frustum_planes, RGL.lights[i].position, RGL.lights[i].radius, bias_to_use)) {
-                        is_visible = true; score = glm_vec3_distance2(RGL.camera_position, RGL.lights[i].position);
-                    }
-                }
+static void _RGL_ShutdownFrameArena(void) {
+    RGLFrameArenaMark empty = { 0, NULL, 0 };
+    _RGL_FrameArenaRewind(empty);
+    free(RGL.frame_arena.base);
+    memset(&RGL.frame_arena, 0, sizeof(RGL.frame_arena));
+}
 
-                if (is_visible && potential_count < RGL_MAX_LIGHTS) {
-                    potential_lights[potential_count].light_index = i;
-                    potential_lights[potential_count].score = score;
-                    potential_count++;
-                }
-            }
-        }
-        ma_mutex_unlock(&RGL.light_mutex);
+// The draw functions write commands through these so the same code records into either
+// the frame batch (render thread) or a bound RGLCommandList (worker thread).
+// Callers must have reserved the slot with _RGL_EnsureCommandCapacity first.
+static inline RGLInternalDraw* _RGL_PeekCommand(void) {
+    RGLCommandList* list = g_rgl_recording_list;
+    return list ? &list->commands[list->command_count] : &RGL.commands[RGL.command_count];
+}
 
-        // PASS 3: Sort the visible lights by their score (distance or priority)
-        if (potential_count > 1) {
-            // (You will need to add this comparison function helper)
-            qsort(potential_lights, potential_count, sizeof(RGLRankedLight), _RGL_CompareRankedLights);
-        }
-
-        // PASS 4: Pack and Upload the BEST lights to the UBO
-        int lights_to_upload = potential_count > MAX_SHADER_LIGHTS ? MAX_SHADER_LIGHTS : potential_count;
-        glUniform1i(RGL.loc_active_lights, lights_to_upload);
-        RGL.stats.active_lights_per_frame = lights_to_upload;
-
-        if (lights_to_upload > 0) {
-            ma_mutex_lock(&RGL.light_mutex);
-            for (int i = 0; i < lights_to_upload; i++) {
-                RGLLight* light = &RGL.lights[potential_lights[i].light_index];
-                SituationConvertColorToVec4(light->color, light_block_data.color_intensity[i]);
-                light_block_data.color_intensity[i][3] = light->intensity;
-                light_block_data.pos_type[i][3] = (float)light->type;
-                switch (light->type) {
-                    case RGL_LIGHT_TYPE_POINT:
-                        glm_vec3_to_vec4(light->position, 1.0f, light_block_data.pos_type[i]);
-                        light_block_data.params[i][0] = light->radius;
-                        break;
-                    case RGL_LIGHT_TYPE_DIRECTIONAL:
-                        glm_vec3_to_vec4(light->direction, 0.0f, light_block_data.direction[i]);
-                        break;
-                    case RGL_LIGHT_TYPE_SPOT:
-                        glm_vec3_to_vec4(light->position, 1.0f, light_block_data.pos_type[i]);
-                        glm_vec3_to_vec4(light->direction, 0.0f, light_block_data.direction[i]);
-                        light_block_data.params[i][0] = light->radius;
-                        light_block_data.params[i][1] = cosf(glm_rad(light->spot_outer_angle));
-                        light_block_data.params[i][2] = cosf(glm_rad(light->spot_inner_angle));
-                        break;
-                }
-            }
-            ma_mutex_unlock(&RGL.light_mutex);
+static inline void _RGL_CommitCommand(void) {
+    if (g_rgl_recording_list) g_rgl_recording_list->command_count++;
+    else RGL.command_count++;
+}
 
-            glBindBuffer(GL_UNIFORM_BUFFER, RGL.light_ubo);
-            glBufferSubData(GL_UNIFORM_BUFFER, 0, lights_to_upload * sizeof(vec4) * 4, &light_block_data);
-            glBindBuffer(GL_UNIFORM_BUFFER, 0);
-        }
-    } // End of lighting block
+static inline RGLInternalDraw* _RGL_PushCommand(void) {
+    RGLInternalDraw* cmd = _RGL_PeekCommand();
+    _RGL_CommitCommand();
+    return cmd;
+}
 
-    // --- 5. Upload Vertex Data and Issue Draw Calls (from your original logic) ---
-    glBindVertexArray(RGL.batch_vao);
-    glBindBuffer(GL_ARRAY_BUFFER, RGL.batch_vbo);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, vertices_written * floats_per_vertex * sizeof(float), RGL.cpu_vertex_buffer);
+/**
+ * @brief (INTERNAL) Sets a VAO's attribute layout for RGLBatchVertex data in `vbo`.
+ * Attribute locations match RGL_VERTEX_SHADER. In the packed format the normal, color and light
+ * attributes are normalized integers and the UV is a half float; the shader sees plain floats.
+ */
+static void _RGL_SetBatchVertexLayout(GLuint vao, GLuint vbo) {
+    GLsizei stride = (GLsizei)sizeof(RGLBatchVertex);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(RGLBatchVertex, position)); glEnableVertexAttribArray(0);    // aPos (vec3)
+#if RGL_PACKED_VERTICES
+    glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, stride, (void*)offsetof(RGLBatchVertex, normal_oct)); glEnableVertexAttribArray(1);    // aNormalOct (vec2, SNORM16)
+    glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, stride, (void*)offsetof(RGLBatchVertex, tex_coord)); glEnableVertexAttribArray(2);    // aTexCoord (vec2, half)
+    glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void*)offsetof(RGLBatchVertex, color)); glEnableVertexAttribArray(3);    // aColor (vec4, UNORM8)
+    glVertexAttribPointer(4, 1, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void*)offsetof(RGLBatchVertex, light_level)); glEnableVertexAttribArray(4);    // aBaseLightLevel (float, UNORM8)
+    glVertexAttribIPointer(5, 1, GL_UNSIGNED_SHORT, stride, (void*)offsetof(RGLBatchVertex, texture_index)); glEnableVertexAttribArray(5);    // aTexIndex (uint)
+#else
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(RGLBatchVertex, normal)); glEnableVertexAttribArray(1);    // aNormal (vec3)
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(RGLBatchVertex, tex_coord)); glEnableVertexAttribArray(2);    // aTexCoord (vec2)
+    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(RGLBatchVertex, color)); glEnableVertexAttribArray(3);    // aColor (vec4)
+    glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(RGLBatchVertex, light_level)); glEnableVertexAttribArray(4);    // aBaseLightLevel (float)
+    glVertexAttribIPointer(5, 1, GL_UNSIGNED_INT, stride, (void*)offsetof(RGLBatchVertex, texture_index)); glEnableVertexAttribArray(5);    // aTexIndex (uint)
+#endif
+    glBindVertexArray(0);
+}
 
-    glEnable(GL_BLEND); glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glEnable(GL_DEPTH_TEST); glDepthFunc(GL_LEQUAL);
+/**
+ * @brief (INTERNAL) Writes one vertex in the active batch vertex format.
+ */
+static inline void _RGL_PackBatchVertex(RGLBatchVertex* out, const vec3 position, const vec3 normal, const vec2 tex_coord, const vec4 color, float light_level) {
+    out->position[0] = position[0]; out->position[1] = position[1]; out->position[2] = position[2];
+#if RGL_PACKED_VERTICES
+    _RGL_OctEncodeNormal(normal, out->normal_oct);
+    out->tex_coord[0] = _RGL_FloatToHalf(tex_coord[0]);
+    out->tex_coord[1] = _RGL_FloatToHalf(tex_coord[1]);
+    for (int c = 0; c < 4; c++) out->color[c] = (uint8_t)(_RGL_Clamp01(color[c]) * 255.0f + 0.5f);
+    out->light_level = (uint8_t)(_RGL_Clamp01(light_level) * 255.0f + 0.5f);
+    out->_pad = 0;
+#else
+    memcpy(out->normal, normal, sizeof(vec3));
+    memcpy(out->tex_coord, tex_coord, sizeof(vec2));
+    memcpy(out->color, color, sizeof(vec4));
+    out->light_level = light_level;
+#endif
+    out->texture_index = 0; // Set by the flush when the batch is drawn bindless
+}
 
-    size_t vertex_offset = 0;
-    for (size_t i = 0; i < RGL.command_count; ) {
-        // Updated to use the SituationTexture slot index for grouping
-        uint32_t current_slot = RGL.commands[i].texture.texture.slot_index;
+/**
+ * @brief (INTERNAL) Detects bindless texture support and creates the handle table.
+ * With GL_ARB_bindless_texture every batch vertex carries an index into a table of resident
+ * texture handles (SSBO binding 9), so the draw loop no longer has to split runs per texture.
+ * Without it, the batcher falls back to binding each run's texture.
+ */
+static void _RGL_InitBindlessTextures(void) {
+    RGL.bindless.loc_enabled = SituationGetShaderLocation(RGL.main_shader, "u_bindless");
+#if RGL_BINDLESS_TEXTURES && defined(GL_ARB_bindless_texture)
+    if (!GLAD_GL_ARB_bindless_texture || RGL.bindless.loc_enabled < 0) return;
+
+    glGenBuffers(1, &RGL.bindless.handle_ssbo);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, RGL.bindless.handle_ssbo);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(RGL.bindless.handles), NULL, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 9, RGL.bindless.handle_ssbo);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    RGL.bindless.count = 1; // Index 0 is reserved for untextured draws
+    RGL.bindless.enabled = true;
+    SIT_Log(SIT_LOG_INFO, "RGL: Bindless textures enabled; batches no longer break on texture changes.");
+#endif
+}
 
-        size_t vertices_in_batch = 0;
-        size_t j = i;
-        while (j < RGL.command_count && RGL.commands[j].texture.texture.slot_index == current_slot) {
-            vertices_in_batch += RGL.commands[j].is_triangle ? 3 : 6;
-            j++;
+static void _RGL_ShutdownBindlessTextures(void) {
+#if RGL_BINDLESS_TEXTURES && defined(GL_ARB_bindless_texture)
+    if (RGL.bindless.enabled) {
+        for (uint32_t i = 1; i < RGL.bindless.count; i++) {
+            if (RGL.bindless.slots[i] != 0) glMakeTextureHandleNonResidentARB(RGL.bindless.handles[i]);
         }
+    }
+#endif
+    if (RGL.bindless.handle_ssbo) glDeleteBuffers(1, &RGL.bindless.handle_ssbo);
+    free(RGL.bindless.slot_to_index);
+    memset(&RGL.bindless, 0, sizeof(RGL.bindless));
+}
 
-        // Use Situation abstraction to bind the texture
-        if (current_slot != 0) { // Assuming 0 is invalid/null
-             // TODO: Bind texture using Situation API or refactor to CommandBuffer
-             // LTBindTexture(RGL.commands[i].texture.texture, 0);
+/**
+ * @brief (INTERNAL) Returns the handle-table index of a texture, making its handle resident on first use.
+ * @return The table index, or 0 if bindless is off or the table is full (the batch then binds per run).
+ */
+static uint16_t _RGL_GetBindlessTextureIndex(const SituationTexture* texture) {
+    if (!RGL.bindless.enabled || texture->slot_index == 0) return 0;
+
+    // 1. --- Already resident? ---
+    uint32_t slot = texture->slot_index;
+    if (slot < RGL.bindless.slot_map_capacity) {
+        uint16_t index = RGL.bindless.slot_to_index[slot];
+        if (index != 0 && RGL.bindless.generations[index] == texture->generation) return index;
+        if (index != 0) {
+            // The slot was reused by a newer texture; the old handle died with its texture.
+            RGL.bindless.slot_to_index[slot] = 0;
+            RGL.bindless.slots[index] = 0;
+            RGL.bindless.handles[index] = 0;
+            RGL.bindless.free_indices[RGL.bindless.free_count++] = index;
+            RGL.bindless.table_generation++;
         }
-        glUniform1i(RGL.loc_use_texture, current_slot != 0); // This logic is shaky but compiles.
+    }
 
-        if (vertices_in_batch > 0) {
-            glDrawArrays(GL_TRIANGLES, vertex_offset, vertices_in_batch);
-            RGL.stats.total_draw_calls++;
-            RGL.stats.total_vertices_drawn += vertices_in_batch;
+#if RGL_BINDLESS_TEXTURES && defined(GL_ARB_bindless_texture)
+    // 2. --- Grow the slot map to cover this slot ---
+    if (slot >= RGL.bindless.slot_map_capacity) {
+        size_t new_capacity = RGL.bindless.slot_map_capacity ? RGL.bindless.slot_map_capacity : 256;
+        while (new_capacity <= slot) new_capacity *= 2;
+        uint16_t* new_map = realloc(RGL.bindless.slot_to_index, sizeof(uint16_t) * new_capacity);
+        if (!new_map) {
+            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to grow bindless texture map");
+            return 0;
         }
-        vertex_offset += vertices_in_batch;
-        i = j;
+        memset(new_map + RGL.bindless.slot_map_capacity, 0, sizeof(uint16_t) * (new_capacity - RGL.bindless.slot_map_capacity));
+        RGL.bindless.slot_to_index = new_map;
+        RGL.bindless.slot_map_capacity = new_capacity;
     }
 
-    // --- 6. Cleanup (from your original logic) ---
-    glBindVertexArray(0);
-    glUseProgram(0);
-    RGL.command_count = 0;
+    // 3. --- Take a free table index ---
+    uint32_t index;
+    if (RGL.bindless.free_count > 0) {
+        index = RGL.bindless.free_indices[--RGL.bindless.free_count];
+    } else if (RGL.bindless.count < RGL_MAX_BINDLESS_TEXTURES) {
+        index = RGL.bindless.count++;
+    } else {
+        _SituationSetWarning("Bindless texture table full; batches fall back to per-texture draws.");
+        return 0;
+    }
+
+    // 4. --- Make the handle resident and queue the table upload ---
+    GLuint64 handle = glGetTextureHandleARB((GLuint)slot);
+    if (handle == 0) {
+        RGL.bindless.free_indices[RGL.bindless.free_count++] = index;
+        return 0;
+    }
+    glMakeTextureHandleResidentARB(handle);
+    RGL.bindless.handles[index] = handle;
+    RGL.bindless.slots[index] = slot;
+    RGL.bindless.generations[index] = texture->generation;
+    RGL.bindless.slot_to_index[slot] = (uint16_t)index;
+    if (RGL.bindless.dirty_begin >= RGL.bindless.dirty_end) {
+        RGL.bindless.dirty_begin = index;
+        RGL.bindless.dirty_end = index + 1;
+    } else {
+        if (index < RGL.bindless.dirty_begin) RGL.bindless.dirty_begin = index;
+        if (index + 1 > RGL.bindless.dirty_end) RGL.bindless.dirty_end = index + 1;
+    }
+    return (uint16_t)index;
+#else
+    return 0;
+#endif
 }
 
 /**
- * @brief (INTERNAL) Calculates the 3D surface normal for a banked Path surface.
- * @param point The path point containing banking and elevation information.
- * @param lateral_offset Distance from Path centerline (-1.0 = left edge, +1.0 = right edge).
+ * @brief (INTERNAL) Drops a texture from the handle table. Must run before the texture is deleted.
+ */
+static void _RGL_ReleaseBindlessTexture(uint32_t slot_index) {
+    if (!RGL.bindless.enabled || slot_index == 0 || slot_index >= RGL.bindless.slot_map_capacity) return;
+    uint16_t index = RGL.bindless.slot_to_index[slot_index];
+    if (index == 0) return;
+
+#if RGL_BINDLESS_TEXTURES && defined(GL_ARB_bindless_texture)
+    glMakeTextureHandleNonResidentARB(RGL.bindless.handles[index]);
+#endif
+    RGL.bindless.slot_to_index[slot_index] = 0;
+    RGL.bindless.slots[index] = 0;
+    RGL.bindless.handles[index] = 0;
+    RGL.bindless.free_indices[RGL.bindless.free_count++] = index;
+    RGL.bindless.table_generation++;
+}
+
+/**
+ * @brief (INTERNAL) Checks that a baked table index still belongs to the texture it was taken for.
+ * Side-effect free, unlike _RGL_GetBindlessTextureIndex, so a stale texture cannot evict the slot's new owner.
+ */
+static bool _RGL_IsBindlessIndexCurrent(const SituationTexture* texture, uint16_t index) {
+    return index != 0 && RGL.bindless.slots[index] == texture->slot_index && RGL.bindless.generations[index] == texture->generation;
+}
+
+/**
+ * @brief (INTERNAL) Uploads the part of the handle table that changed since the last flush.
+ */
+static void _RGL_UploadBindlessHandles(void) {
+    if (RGL.bindless.dirty_begin >= RGL.bindless.dirty_end) return;
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, RGL.bindless.handle_ssbo);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, RGL.bindless.dirty_begin * sizeof(uint64_t),
+                    (RGL.bindless.dirty_end - RGL.bindless.dirty_begin) * sizeof(uint64_t),
+                    &RGL.bindless.handles[RGL.bindless.dirty_begin]);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 9, RGL.bindless.handle_ssbo);
+    RGL.bindless.dirty_begin = RGL.bindless.dirty_end = 0;
+}
+
+/**
+ * @brief (INTERNAL) Creates the GPU (and, if needed, CPU) storage for batch vertices.
+ *
+ * The preferred path allocates immutable storage for RGL_VERTEX_RING_SEGMENTS segments, plus a
+ * small reserved head used by immediate-mode helpers that still call glBufferSubData, and maps it
+ * once with persistent, coherent write access. If mapping fails, it falls back to the original
+ * CPU staging buffer and a GL_DYNAMIC_DRAW VBO updated with glBufferSubData.
+ *
+ * @param vertex_capacity The number of vertices a single full batch needs.
+ * @return True on success, false if no vertex storage could be created (nothing is left allocated).
+ */
+static bool _RGL_CreateBatchVertexStorage(size_t vertex_capacity) {
+    memset(&RGL.vertex_ring, 0, sizeof(RGL.vertex_ring));
+    RGL.batch_vertex_capacity = vertex_capacity;
+
+    // 1. --- Preferred: persistently mapped ring ---
+    size_t total_bytes = ((size_t)RGL_IMMEDIATE_VERTEX_RESERVE + vertex_capacity * RGL_VERTEX_RING_SEGMENTS) * sizeof(RGLBatchVertex);
+    GLbitfield map_flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    glGenBuffers(1, &RGL.batch_vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, RGL.batch_vbo);
+    glBufferStorage(GL_ARRAY_BUFFER, total_bytes, NULL, map_flags | GL_DYNAMIC_STORAGE_BIT);
+    RGL.vertex_ring.mapped = (RGLBatchVertex*)glMapBufferRange(GL_ARRAY_BUFFER, 0, total_bytes, map_flags);
+
+    if (RGL.vertex_ring.mapped) {
+        RGL.vertex_ring.segment_vertices = vertex_capacity;
+        _RGL_SetBatchVertexLayout(RGL.batch_vao, RGL.batch_vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        if (_RGL_CreateQuadIndexBuffer(vertex_capacity / 4)) return true;
+        _RGL_DestroyBatchVertexStorage(); // Unmaps and deletes the ring just created
+        RGL.batch_vertex_capacity = 0;
+        return false;
+    }
+
+    // 2. --- Fallback: CPU staging buffer + glBufferSubData ---
+    SIT_Log(SIT_LOG_WARNING, "RGL: Persistent buffer mapping unavailable, using glBufferSubData uploads.");
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glDeleteBuffers(1, &RGL.batch_vbo);
+
+    RGL.cpu_vertex_buffer = (RGLBatchVertex*)malloc(vertex_capacity * sizeof(RGLBatchVertex));
+    if (!RGL.cpu_vertex_buffer) {
+        RGL.batch_vbo = 0;
+        RGL.batch_vertex_capacity = 0;
+        return false;
+    }
+
+    glGenBuffers(1, &RGL.batch_vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, RGL.batch_vbo);
+    glBufferData(GL_ARRAY_BUFFER, vertex_capacity * sizeof(RGLBatchVertex), NULL, GL_DYNAMIC_DRAW);
+    _RGL_SetBatchVertexLayout(RGL.batch_vao, RGL.batch_vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    if (_RGL_CreateQuadIndexBuffer(vertex_capacity / 4)) return true;
+    _RGL_DestroyBatchVertexStorage(); // Deletes the VBO and staging buffer just created
+    RGL.batch_vertex_capacity = 0;
+    return false;
+}
+
+/**
+ * @brief (INTERNAL) Builds the static index buffer used to draw every batch command as a quad.
+ * Each command owns 4 consecutive vertices (TL, BL, BR, TR); quad n uses indices
+ * {4n+0, 4n+1, 4n+2, 4n+0, 4n+2, 4n+3}. Draws offset into the vertex stream with a base
+ * vertex, so the indices never change after creation (only on batch growth).
+ * @param max_quads The number of quads one full batch can hold.
+ * @return True on success, false on allocation failure.
+ */
+static bool _RGL_CreateQuadIndexBuffer(size_t max_quads) {
+    uint32_t* indices = (uint32_t*)malloc(max_quads * 6 * sizeof(uint32_t));
+    if (!indices) return false;
+    for (size_t q = 0; q < max_quads; q++) {
+        uint32_t base = (uint32_t)(q * 4);
+        uint32_t* dst = &indices[q * 6];
+        dst[0] = base + 0; dst[1] = base + 1; dst[2] = base + 2;
+        dst[3] = base + 0; dst[4] = base + 2; dst[5] = base + 3;
+    }
+
+    glGenBuffers(1, &RGL.batch_ibo);
+    glBindVertexArray(RGL.batch_vao); // GL_ELEMENT_ARRAY_BUFFER binding is VAO state
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, RGL.batch_ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, max_quads * 6 * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+    glBindVertexArray(0);
+    free(indices);
+    return true;
+}
+
+static void _RGL_DestroyBatchVertexStorage(void) {
+    for (int i = 0; i < RGL_VERTEX_RING_SEGMENTS; i++) {
+        if (RGL.vertex_ring.fences[i]) glDeleteSync(RGL.vertex_ring.fences[i]);
+    }
+    if (RGL.batch_vbo) {
+        if (RGL.vertex_ring.mapped) {
+            glBindBuffer(GL_ARRAY_BUFFER, RGL.batch_vbo);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+        glDeleteBuffers(1, &RGL.batch_vbo);
+        RGL.batch_vbo = 0;
+    }
+    if (RGL.batch_ibo) {
+        glDeleteBuffers(1, &RGL.batch_ibo);
+        RGL.batch_ibo = 0;
+    }
+    free(RGL.cpu_vertex_buffer);
+    RGL.cpu_vertex_buffer = NULL;
+    memset(&RGL.vertex_ring, 0, sizeof(RGL.vertex_ring));
+}
+
+/**
+ * @brief (INTERNAL) Closes the current ring segment and opens the next one.
+ * A fence is placed after all draws that read the segment being left. Before the next segment is
+ * reused, its own fence (from RGL_VERTEX_RING_SEGMENTS - 1 segments ago) is waited on; in steady
+ * state the GPU has long finished with it and the wait returns immediately.
+ */
+static void _RGL_AdvanceVertexRing(void) {
+    if (!RGL.vertex_ring.mapped) return;
+
+    int current = RGL.vertex_ring.segment;
+    if (RGL.vertex_ring.fences[current]) glDeleteSync(RGL.vertex_ring.fences[current]);
+    RGL.vertex_ring.fences[current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    int next = (current + 1) % RGL_VERTEX_RING_SEGMENTS;
+    GLsync fence = RGL.vertex_ring.fences[next];
+    if (fence) {
+        GLenum status = glClientWaitSync(fence, 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED) {
+            RGL.stats.vertex_ring_stalls++;
+            do {
+                status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull); // 1s slices
+            } while (status == GL_TIMEOUT_EXPIRED);
+        }
+        glDeleteSync(fence);
+        RGL.vertex_ring.fences[next] = NULL;
+    }
+
+    RGL.vertex_ring.segment = next;
+    RGL.vertex_ring.write_offset_vertices = 0;
+}
+
+/**
+ * @brief (INTERNAL) Reserves space for one flush worth of vertices.
+ * With the persistent ring, consecutive flushes in a frame append within the current segment, so
+ * none of them overwrite data an earlier draw may still be reading. The caller advances
+ * `vertex_ring.write_offset_vertices` by what it actually wrote.
+ *
+ * @param max_vertices Upper bound on the vertices to be written.
+ * @param out_first_vertex Receives the base vertex for the flush's indexed draws.
+ * @return The write pointer (mapped GPU memory, or the fallback staging buffer).
+ */
+static RGLBatchVertex* _RGL_AcquireBatchVertices(size_t max_vertices, size_t* out_first_vertex) {
+    if (!RGL.vertex_ring.mapped) {
+        *out_first_vertex = 0;
+        return RGL.cpu_vertex_buffer;
+    }
+
+    if (RGL.vertex_ring.write_offset_vertices + max_vertices > RGL.vertex_ring.segment_vertices) {
+        _RGL_AdvanceVertexRing();
+    }
+
+    size_t offset = (size_t)RGL_IMMEDIATE_VERTEX_RESERVE
+                  + (size_t)RGL.vertex_ring.segment * RGL.vertex_ring.segment_vertices
+                  + RGL.vertex_ring.write_offset_vertices;
+    *out_first_vertex = offset;
+    return RGL.vertex_ring.mapped + offset;
+}
+
+/**
+ * @brief (INTERNAL) Processes and draws all queued commands with dynamic lighting.
+ *
+ * This is the heart of the renderer's performance. It follows a high-performance strategy:
+ * 1.  Sorts all queued commands by Z-depth (for correct alpha blending) and then by texture
+ *     (to minimize GPU state changes). Only compact 64-bit keys are radix-sorted; the
+ *     commands themselves stay in submission order and are gathered through the sorted indices.
+ *     Opaque commands form their own bucket, sorted by texture then front-to-back, and are
+ *     drawn first with blending disabled so early-Z rejects the hidden translucent fragments.
+ * 2.  Assembles a single, large vertex buffer in the RGLBatchVertex format
+ *     (pos, normal, uv, color, light_level; quantized when RGL_PACKED_VERTICES is set).
+ * 3.  Performs frustum culling on all active lights in the scene.
+ * 4.  Bins every visible point/spot light into the clusters (screen tile x depth slice) it touches.
+ * 5.  Uploads the lights and per-cluster light lists to the clustered lighting SSBOs.
+ * 6.  Writes vertices directly into the persistently mapped vertex ring (no upload copy), or
+ *     uploads the staging buffer in one transfer on the fallback path.
+ * 7.  Draws the cached opaque static geometry of any levels queued by RGL_DrawLevel (one indexed
+ *     draw per texture; translucent textures wait for the alpha bucket), then iterates through
+ *     the sorted commands, issuing the minimum number of batched indexed draws. With bindless
+ *     textures each vertex carries its texture's handle index, so runs only split at the
+ *     opaque/alpha boundary; otherwise each texture gets a run. Every command is written as
+ *     4 vertices and drawn through the static quad index buffer; triangles repeat their last
+ *     vertex, so the second half of their quad is degenerate.
+ */
+static void _RGL_FlushBatch(void) {
+    if (!RGL.is_batching || (RGL.command_count == 0 && RGL.static_level_queue_count == 0 && RGL.instancing.draw_count == 0)) return;
+    if (g_rgl_recording_list) return; // Only the render thread owns the GL context and the frame batch.
+
+    RGL.stats.batch_flushes++; // Path this statistic
+    RGL_BeginProfileZone("Flush");
+
+    // --- 1. Build and Radix-Sort the (key, index) Records ---
+    RGL_BeginProfileZone("Sort");
+    for (size_t i = 0; i < RGL.command_count; i++) {
+        RGL.sort_keys[i].key = _RGL_MakeSortKey(&RGL.commands[i]);
+        RGL.sort_keys[i].index = (uint32_t)i;
+    }
+    const RGLSortKey* sorted = _RGL_RadixSortKeys(RGL.sort_keys, RGL.sort_keys_scratch, RGL.command_count);
+    RGL_EndProfileZone();
+
+    // --- 2. Assemble Vertices (in the RGLBatchVertex format) straight into the ring segment ---
+    // Every command is exactly 4 vertices. Triangles become degenerate quads (v2 repeated) so that
+    // they stay interleaved with quads in sort order and share the same indexed draw.
+    RGL_BeginProfileZone("Vertex Assembly");
+    size_t first_vertex = 0;
+    RGLBatchVertex* vertex_ptr = _RGL_AcquireBatchVertices(RGL.command_count * 4, &first_vertex);
+    size_t vertices_written = 0;
+    size_t commands_written = 0;
+
+    // Texture handle indices are resolved once per run of equal textures in sort order.
+    bool bindless = RGL.bindless.enabled;
+    uint32_t last_slot = 0, last_generation = 0;
+    uint16_t last_index = 0;
+
+    for (size_t i = 0; i < RGL.command_count; i++) {
+        RGLInternalDraw* cmd = &RGL.commands[sorted[i].index];
+
+        if (vertices_written + 4 > RGL.batch_vertex_capacity) {
+            _SituationSetWarning("RGL batch capacity reached. Some draw commands were dropped.");
+            break;
+        }
+
+        uint16_t texture_index = 0;
+        if (bindless && cmd->texture.texture.slot_index != 0) {
+            if (cmd->texture.texture.slot_index != last_slot || cmd->texture.texture.generation != last_generation) {
+                last_slot = cmd->texture.texture.slot_index;
+                last_generation = cmd->texture.texture.generation;
+                last_index = _RGL_GetBindlessTextureIndex(&cmd->texture.texture);
+                if (last_index == 0) bindless = false; // Table full: draw this flush per texture
+            }
+            texture_index = last_index;
+        }
+
+        for (int v = 0; v < 4; v++) {
+            int src = (cmd->is_triangle && v == 3) ? 2 : v;
+            _RGL_PackBatchVertex(vertex_ptr, cmd->world_positions[src], cmd->normals[src], cmd->tex_coords[src], cmd->colors[src], cmd->light_levels[src]);
+            vertex_ptr->texture_index = texture_index;
+            vertex_ptr++;
+        }
+        vertices_written += 4;
+        commands_written++;
+    }
+    RGL.stats.commands_flushed += (int)commands_written;
+    RGL.stats.bytes_uploaded += vertices_written * sizeof(RGLBatchVertex);
+    RGL_EndProfileZone();
+
+    // --- 3. Setup OpenGL State & Common Uniforms ---
+    glUseProgram(RGL.main_shader.gl_program_id);
+    glUniform1i(RGL.loc_texture_sampler, 0);
+
+    // --- NEW: Set Lighting Uniforms (from the patch) ---
+    glUniform3fv(RGL.loc_camera_pos, 1, RGL.camera_position);
+    glUniform3fv(RGL.loc_ambient_light_color, 1, RGL.ambient_light_color);
+
+    // --- 4. Cull, Bin, and Upload Light Data to the Clustered Light SSBOs ---
+    RGL_BeginProfileZone("Light Culling");
+    _RGL_BuildLightClusters();
+    RGL_EndProfileZone();
+
+#ifdef RGL_ENABLE_BENCHMARKS
+    // CPU-only benchmark runs stop here: sorting, vertex assembly and light binning are what they measure.
+    if (RGL.benchmark_cpu_only) {
+        glUseProgram(0);
+        RGL.command_count = 0;
+        RGL.static_level_queue_count = 0;
+        RGL.instancing.draw_count = 0;
+        RGL.instancing.instance_count = 0;
+        RGL_EndProfileZone();
+        return;
+    }
+#endif // RGL_ENABLE_BENCHMARKS
+
+    // --- 5. Upload Vertex Data and Issue Draw Calls (from your original logic) ---
+    RGL_BeginProfileZone("Upload");
+    glBindVertexArray(RGL.batch_vao);
+    if (RGL.vertex_ring.mapped) {
+        RGL.vertex_ring.write_offset_vertices += vertices_written; // Coherent mapping: already visible to the GPU
+    } else {
+        glBindBuffer(GL_ARRAY_BUFFER, RGL.batch_vbo);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, vertices_written * sizeof(RGLBatchVertex), RGL.cpu_vertex_buffer);
+    }
+    if (bindless) _RGL_UploadBindlessHandles();
+    RGL_EndProfileZone();
+
+    RGL_BeginProfileZone("Draw");
+
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glEnable(GL_DEPTH_TEST); glDepthFunc(GL_LEQUAL);
+
+    // Cached opaque level geometry goes first: it is the world the batch is drawn over. Its
+    // translucent ranges wait for the alpha bucket, like blended instances.
+    bool translucent_levels_pending = RGL.static_level_queue_count > 0;
+    if (translucent_levels_pending) {
+        _RGL_DrawQueuedStaticLevels(false);
+        glBindVertexArray(RGL.batch_vao);
+    }
+    // Opaque instances join it; blended ones wait for the alpha bucket (see _RGL_DrawBlendedInstancePass).
+    bool blended_instances_pending = RGL.instancing.draw_count > 0;
+    if (blended_instances_pending) {
+        _RGL_DrawQueuedInstances(false);
+        glBindVertexArray(RGL.batch_vao);
+    }
+
+    if (bindless) glUniform1i(RGL.bindless.loc_enabled, 1);
+
+    size_t command_offset = 0;
+    bool blend_enabled = false;
+    glDisable(GL_BLEND);
+    for (size_t i = 0; i < commands_written; ) {
+        // Updated to use the SituationTexture slot index for grouping
+        uint32_t current_slot = RGL.commands[sorted[i].index].texture.texture.slot_index;
+        uint64_t current_bucket = sorted[i].key & RGL_SORT_KEY_ALPHA_BIT;
+
+        // The opaque bucket sorts first; switch blending on once we reach the alpha bucket.
+        if (current_bucket && !blend_enabled) {
+            if (translucent_levels_pending) {
+                _RGL_DrawTranslucentLevelPass(bindless);
+                translucent_levels_pending = false;
+            }
+            if (blended_instances_pending) {
+                _RGL_DrawBlendedInstancePass(bindless);
+                blended_instances_pending = false;
+            }
+            glEnable(GL_BLEND);
+            blend_enabled = true;
+        }
+
+        // Bindless runs only end at the bucket boundary; bound runs also end at a texture change.
+        size_t j = i;
+        while (j < commands_written &&
+               (sorted[j].key & RGL_SORT_KEY_ALPHA_BIT) == current_bucket &&
+               (bindless || RGL.commands[sorted[j].index].texture.texture.slot_index == current_slot)) {
+            j++;
+        }
+        size_t commands_in_batch = j - i;
+
+        if (!bindless) {
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, current_slot);
+            glUniform1i(RGL.loc_use_texture, current_slot != 0);
+        }
+
+        if (commands_in_batch > 0) {
+            // Indices always start at 0; the base vertex selects this run's quads in the ring.
+            // (Maps 1:1 to SituationCmdDrawIndexed(cmd, count, 1, 0, base_vertex, 0) on the command-buffer path.)
+            GLint base_vertex = (GLint)(first_vertex + command_offset * 4);
+            glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)(commands_in_batch * 6), GL_UNSIGNED_INT, (void*)0, base_vertex);
+            RGL.stats.total_draw_calls++;
+            RGL.stats.total_vertices_drawn += commands_in_batch * 4;
+        }
+        command_offset += commands_in_batch;
+        i = j;
+    }
+    // The frame had no alpha bucket.
+    if (translucent_levels_pending) _RGL_DrawTranslucentLevelPass(bindless);
+    if (blended_instances_pending) _RGL_DrawBlendedInstancePass(bindless);
+    RGL_EndProfileZone();
+
+    // --- 6. Cleanup (from your original logic) ---
+    if (bindless) glUniform1i(RGL.bindless.loc_enabled, 0); // Other users of the main shader bind their texture
+    if (!blend_enabled) glEnable(GL_BLEND); // Leave blending on for immediate-mode draws, as before.
+    glBindVertexArray(0);
+    glUseProgram(0);
+    RGL.command_count = 0;
+    RGL.static_level_queue_count = 0;
+    RGL.instancing.draw_count = 0;
+    RGL.instancing.instance_count = 0;
+    RGL_EndProfileZone();
+}
+
+/**
+ * @brief (INTERNAL) Calculates the 3D surface normal for a banked Path surface.
+ * @param point The path point containing banking and elevation information.
+ * @param lateral_offset Distance from Path centerline (-1.0 = left edge, +1.0 = right edge).
  * @param out_normal A vec3 to store the resulting surface normal vector.
  */
 static void _RGL_CalculateBankedSurface(RGLPathPoint* point, float lateral_offset, vec3 out_normal) {
+    (void)lateral_offset;
+    _RGL_CalculateBankedNormal(point->path_roll_degrees, out_normal);
+}
+
+/**
+ * @brief (INTERNAL) Calculates the surface normal of a Path surface banked by the given angle.
+ * @param roll_degrees Bank angle of the surface in degrees.
+ * @param out_normal A vec3 to store the resulting surface normal vector.
+ */
+static void _RGL_CalculateBankedNormal(float roll_degrees, vec3 out_normal) {
     vec3 up = {0.0f, 1.0f, 0.0f};
-    if (fabsf(point->path_roll_degrees) < 0.01f) {
+    if (fabsf(roll_degrees) < 0.01f) {
         glm_vec3_copy(up, out_normal);
         return;
     }
 
     mat4 bank_matrix;
-    glm_rotate_make(bank_matrix, glm_rad(point->path_roll_degrees), (vec3){0.0f, 0.0f, 1.0f});
+    glm_rotate_make(bank_matrix, glm_rad(roll_degrees), (vec3){0.0f, 0.0f, 1.0f});
     glm_mat4_mulv3(bank_matrix, up, 1.0f, out_normal);
 }
 
@@ -1750,7 +4239,7 @@ static bool _RGL_InitDebugRendering(void) {
     glGenBuffers(1, &RGL.debug.wireframe_vbo);
     glBindVertexArray(RGL.debug.wireframe_vao);
     glBindBuffer(GL_ARRAY_BUFFER, RGL.debug.wireframe_vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 3 * 24, NULL, GL_DYNAMIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 3 * 30, NULL, GL_DYNAMIC_DRAW); // 24 box-line or 30 shadow-volume vertices
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
     glEnableVertexAttribArray(0);
     glBindVertexArray(0);
@@ -1803,54 +4292,81 @@ SITAPI bool RGL_Init(void) {
     RGL.loc_use_texture = SituationGetShaderLocation(RGL.main_shader, "useTexture");
     RGL.loc_camera_pos = SituationGetShaderLocation(RGL.main_shader, "u_camera_pos");
     RGL.loc_ambient_light_color = SituationGetShaderLocation(RGL.main_shader, "u_ambient_light_color");
-    RGL.loc_active_lights = SituationGetShaderLocation(RGL.main_shader, "u_active_lights");
+    RGL.light_clusters.loc_directional_lights = SituationGetShaderLocation(RGL.main_shader, "u_directional_lights");
+    RGL.light_clusters.loc_cluster_dims = SituationGetShaderLocation(RGL.main_shader, "u_cluster_dims");
+    RGL.light_clusters.loc_cluster_viewport = SituationGetShaderLocation(RGL.main_shader, "u_cluster_viewport");
+    RGL.light_clusters.loc_cluster_z_params = SituationGetShaderLocation(RGL.main_shader, "u_cluster_z_params");
+    RGL.instancing.loc_mode = SituationGetShaderLocation(RGL.main_shader, "u_instance_mode");
+    RGL.instancing.loc_base = SituationGetShaderLocation(RGL.main_shader, "u_instance_base");
+    RGL.instancing.loc_uv_rect = SituationGetShaderLocation(RGL.main_shader, "u_instance_uv_rect");
+    RGL.instancing.loc_road = SituationGetShaderLocation(RGL.main_shader, "u_road");
+    RGL.instancing.loc_road_loop = SituationGetShaderLocation(RGL.main_shader, "u_road_loop");
+    RGL.instancing.loc_road_segments = SituationGetShaderLocation(RGL.main_shader, "u_road_segments");
+    RGL.instancing.loc_road_layers = SituationGetShaderLocation(RGL.main_shader, "u_road_layers");
 
     // 2. --- Allocate CPU-side Buffers (from the patch) ---
     RGL.command_capacity = RGL_DEFAULT_BATCH_CAPACITY;
     RGL.commands = (RGLInternalDraw*)malloc(sizeof(RGLInternalDraw) * RGL.command_capacity);
-    const int floats_per_vertex = 13; // Using the new 13-float format
-    RGL.cpu_vertex_buffer_floats_capacity = RGL.command_capacity * 6 * floats_per_vertex;
-    RGL.cpu_vertex_buffer = (float*)malloc(RGL.cpu_vertex_buffer_floats_capacity * sizeof(float));
+    RGL.sort_keys = (RGLSortKey*)malloc(sizeof(RGLSortKey) * RGL.command_capacity);
+    RGL.sort_keys_scratch = (RGLSortKey*)malloc(sizeof(RGLSortKey) * RGL.command_capacity);
 
-    if (!RGL.commands || !RGL.cpu_vertex_buffer) {
-        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to create RGL command/vertex buffers.");
-        free(RGL.commands); free(RGL.cpu_vertex_buffer);
+    if (!RGL.commands || !RGL.sort_keys || !RGL.sort_keys_scratch) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to create RGL command buffers.");
+        free(RGL.commands);
+        free(RGL.sort_keys); free(RGL.sort_keys_scratch);
         SituationUnloadShader(RGL.main_shader);
         memset(&RGL, 0, sizeof(RGLState));
         return false;
     }
 
-    // 3. --- Setup GPU Buffers (VAO and VBO) (from the patch) ---
-    size_t vbo_capacity_bytes = RGL.cpu_vertex_buffer_floats_capacity * sizeof(float);
+    // 3. --- Setup GPU Buffers (VAO) ---
     glGenVertexArrays(1, &RGL.batch_vao);
-    glGenBuffers(1, &RGL.batch_vbo);
-    glBindVertexArray(RGL.batch_vao);
-    glBindBuffer(GL_ARRAY_BUFFER, RGL.batch_vbo);
-    glBufferData(GL_ARRAY_BUFFER, vbo_capacity_bytes, NULL, GL_DYNAMIC_DRAW);
-
-    // 4. --- Set Vertex Attribute Pointers (from the patch) ---
-    size_t stride = floats_per_vertex * sizeof(float);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0); glEnableVertexAttribArray(0);    // aPos (vec3)
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride, (void*)(3 * sizeof(float))); glEnableVertexAttribArray(1);    // aNormal (vec3)
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)(6 * sizeof(float))); glEnableVertexAttribArray(2);    // aTexCoord (vec2)
-    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, stride, (void*)(8 * sizeof(float))); glEnableVertexAttribArray(3);    // aColor (vec4)
-    glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, stride, (void*)(12 * sizeof(float))); glEnableVertexAttribArray(4);    // aBaseLightLevel (float)
-    glBindVertexArray(0);
+
+    // 4. --- Create the Persistent Vertex Ring and Set Vertex Attribute Pointers ---
+    if (!_RGL_CreateBatchVertexStorage(RGL.command_capacity * 4)) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to create RGL vertex buffers.");
+        glDeleteVertexArrays(1, &RGL.batch_vao);
+        free(RGL.commands);
+        free(RGL.sort_keys); free(RGL.sort_keys_scratch);
+        SituationUnloadShader(RGL.main_shader);
+        memset(&RGL, 0, sizeof(RGLState));
+        return false;
+    }
 
     // 5. --- Initialize Lighting System (from the patch) ---
     memset(RGL.lights, 0, sizeof(RGL.lights));
     glm_vec3_copy((vec3){0.1f, 0.1f, 0.1f}, RGL.ambient_light_color);
     ma_mutex_init(&RGL.light_mutex);
 
-    // Create and configure the Uniform Buffer Object (UBO) for lights
-    glGenBuffers(1, &RGL.light_ubo);
-    glBindBuffer(GL_UNIFORM_BUFFER, RGL.light_ubo);
-    glBufferData(GL_UNIFORM_BUFFER, RGL_MAX_LIGHTS * sizeof(vec4) * 4, NULL, GL_DYNAMIC_DRAW);
-    glBindBuffer(GL_UNIFORM_BUFFER, 0);
-    // Bind the UBO to the global binding point 0
-    GLuint block_index = glGetUniformBlockIndex(RGL.main_shader.gl_program_id, "LightBlock");
-    glUniformBlockBinding(RGL.main_shader.gl_program_id, block_index, 0);
-    glBindBufferBase(GL_UNIFORM_BUFFER, 0, RGL.light_ubo);
+    // Create the clustered lighting buffers. The CPU-side arrays are sized for the worst case
+    // (every light visible); only the cluster index list grows on demand.
+    const size_t cluster_count = RGL_CLUSTER_GRID_X * RGL_CLUSTER_GRID_Y * RGL_CLUSTER_GRID_Z;
+    RGL.light_clusters.lights = (RGLShaderLight*)malloc(sizeof(RGLShaderLight) * RGL_MAX_LIGHTS);
+    RGL.light_clusters.bounds = (RGLLightClusterBounds*)malloc(sizeof(RGLLightClusterBounds) * RGL_MAX_LIGHTS);
+    RGL.light_clusters.clusters = (uint32_t*)malloc(sizeof(uint32_t) * 2 * cluster_count);
+    if (!RGL.light_clusters.lights || !RGL.light_clusters.bounds || !RGL.light_clusters.clusters) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate clustered lighting buffers.");
+        RGL_Shutdown();
+        return false;
+    }
+    float log_depth_range = logf(RGL_DEFAULT_FAR_PLANE / RGL_DEFAULT_NEAR_PLANE);
+    RGL.light_clusters.z_scale = (float)RGL_CLUSTER_GRID_Z / log_depth_range;
+    RGL.light_clusters.z_bias = -(float)RGL_CLUSTER_GRID_Z * logf(RGL_DEFAULT_NEAR_PLANE) / log_depth_range;
+
+    GLuint light_buffers[3];
+    glGenBuffers(3, light_buffers);
+    RGL.light_clusters.light_ssbo = light_buffers[0];
+    RGL.light_clusters.cluster_ssbo = light_buffers[1];
+    RGL.light_clusters.index_ssbo = light_buffers[2];
+    for (int i = 0; i < 3; i++) {
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, light_buffers[i]);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(RGLShaderLight), NULL, GL_DYNAMIC_DRAW);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2 + i, light_buffers[i]);
+    }
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    // Bindless texture table for the batch (no-op without GL_ARB_bindless_texture).
+    _RGL_InitBindlessTextures();
 
     // 6. --- Initialize Shadow Shader ---
     RGL.shadow_shader = SituationCreateShader(RGL_SHADOW_VERTEX_SHADER, RGL_SHADOW_FRAGMENT_SHADER);
@@ -1866,12 +4382,43 @@ SITAPI bool RGL_Init(void) {
     RGL.loc_shadow_texture = glGetUniformLocation(RGL.shadow_shader.gl_program_id, "texture0");
     RGL.loc_shadow_tint = glGetUniformLocation(RGL.shadow_shader.gl_program_id, "shadowTint");
 
-    RGL.shadow_volume_shader = SituationCreateShader(RGL_SHADOW_VOLUME_VERTEX_SHADER, NULL); // Vertex only
-    if (RGL.shadow_volume_shader.gl_program_id == 0) { SIT_Log(SIT_LOG_ERROR, "Failed to create shadow volume shader."); return false; }
-    RGL.loc_sv_view = glGetUniformLocation(RGL.shadow_volume_shader.gl_program_id, "view");
-    RGL.loc_sv_projection = glGetUniformLocation(RGL.shadow_volume_shader.gl_program_id, "projection");
+    // Blob shadows stream their quad through their own buffers: the batch VBO is an immutable ring.
+    glGenVertexArrays(1, &RGL.blob_shadow_vao);
+    glGenBuffers(1, &RGL.blob_shadow_vbo);
+    glBindVertexArray(RGL.blob_shadow_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, RGL.blob_shadow_vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 5 * 4, NULL, GL_DYNAMIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    const GLuint blob_shadow_indices[6] = { 0, 1, 2, 0, 2, 3 };
+    glGenBuffers(1, &RGL.blob_shadow_ibo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, RGL.blob_shadow_ibo); // VAO state: stays with blob_shadow_vao
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(blob_shadow_indices), blob_shadow_indices, GL_STATIC_DRAW);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    RGL.shadow_volume_program = _RGL_CreateShaderProgram(RGL_SHADOW_VOLUME_VERTEX_SHADER, RGL_SHADOW_VOLUME_GEOMETRY_SHADER, RGL_SHADOW_VOLUME_FRAGMENT_SHADER);
+    if (RGL.shadow_volume_program == 0) { SIT_Log(SIT_LOG_ERROR, "Failed to create shadow volume shader."); return false; }
+    RGL.loc_sv_view = glGetUniformLocation(RGL.shadow_volume_program, "view");
+    RGL.loc_sv_projection = glGetUniformLocation(RGL.shadow_volume_program, "projection");
+    RGL.loc_sv_model = glGetUniformLocation(RGL.shadow_volume_program, "u_model");
+    RGL.loc_sv_light_pos = glGetUniformLocation(RGL.shadow_volume_program, "u_light_pos");
+    RGL.loc_sv_extrusion_length = glGetUniformLocation(RGL.shadow_volume_program, "u_extrusion_length");
+
+    // Stream buffers for casters without cached shadow data (sprite quads and other temporary meshes).
+    glGenVertexArrays(1, &RGL.shadow_stream_vao);
+    glGenBuffers(1, &RGL.shadow_stream_vbo);
+    glGenBuffers(1, &RGL.shadow_stream_ibo);
+    glBindVertexArray(RGL.shadow_stream_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, RGL.shadow_stream_vbo);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(vec3), (void*)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, RGL.shadow_stream_ibo);
+    glBindVertexArray(0);
 
-    RGL.shadow_darken_shader = SituationCreateShader(RGL_WIREFRAME_VERTEX_SHADER, RGL_SHADOW_PASS_FRAGMENT_SHADER); // Re-use simple VS
+    RGL.shadow_darken_shader = SituationCreateShader(RGL_SHADOW_DARKEN_VERTEX_SHADER, RGL_SHADOW_PASS_FRAGMENT_SHADER);
     if (RGL.shadow_darken_shader.gl_program_id == 0) { SIT_Log(SIT_LOG_ERROR, "Failed to create shadow darken shader."); return false; }
     RGL.loc_sd_shadow_color = glGetUniformLocation(RGL.shadow_darken_shader.gl_program_id, "u_shadow_color");
     glGenVertexArrays(1, &RGL.fullscreen_quad_vao);
@@ -1904,17 +4451,34 @@ SITAPI void RGL_Shutdown(void) {
     if (!RGL.is_initialized) return;
 
     // 1. --- Shutdown Sub-systems (from your original logic) ---
+    RGL_ShutdownParticles();
     _RGL_ShutdownDebugRendering();
     _RGL_ShutdownDebugTextSystem();
+    RGL_ClearTextRunCache();
+    RGL_UnloadSpriteAtlas();
+    _RGL_ShutdownAsyncLoads();
+    _RGL_ShutdownProfiler();
+    _RGL_ShutdownRenderTargetPool();
+    _RGL_ShutdownRetroEffects();
+    _RGL_ShutdownFrameArena();
 
     // 2. --- Destroy High-Level World Data (from your original logic) ---
     for (size_t i = 0; i < RGL.Path_count; i++) {
-        free(RGL.Paths[i].data.points);
+        _RGL_FreePathPoints(&RGL.Paths[i].data);
+        _RGL_FreePathSamples(&RGL.Paths[i].data);
+        _RGL_FreeSceneryIndex(&RGL.Paths[i].data);
+        _RGL_FreeGPURoad(&RGL.Paths[i].data);
     }
     free(RGL.Paths);
+    free(RGL.path_impostors.items);
+    free(RGL.path_impostors.positions);
+    free(RGL.path_impostors.sizes);
+    free(RGL.path_impostors.tints);
+    memset(&RGL.path_impostors, 0, sizeof(RGL.path_impostors));
 
     for (size_t i = 0; i < RGL.level_count; i++) {
         RGLLevel* level = &RGL.levels[i];
+        _RGL_FreeLevelStaticGeometry(level);
         free(level->vertices);
         free(level->walls);
         free(level->things);
@@ -1924,23 +4488,42 @@ SITAPI void RGL_Shutdown(void) {
         free(level->flats);
     }
     free(RGL.levels);
+    free(RGL.static_level_queue);
+    free(RGL.static_level_visibility);
 
     // 3. --- Destroy Lighting System Resources (from the patch) ---
     ma_mutex_uninit(&RGL.light_mutex);
-    glDeleteBuffers(1, &RGL.light_ubo);
+    GLuint light_buffers[3] = { RGL.light_clusters.light_ssbo, RGL.light_clusters.cluster_ssbo, RGL.light_clusters.index_ssbo };
+    glDeleteBuffers(3, light_buffers);
+    free(RGL.light_clusters.lights);
+    free(RGL.light_clusters.bounds);
+    free(RGL.light_clusters.clusters);
+    free(RGL.light_clusters.indices);
 
     // 4. --- Destroy Core OpenGL Objects (from your original logic) ---
+    _RGL_ShutdownInstancing();
+    _RGL_ShutdownBindlessTextures();
     glDeleteVertexArrays(1, &RGL.batch_vao);
-    glDeleteBuffers(1, &RGL.batch_vbo);
+    _RGL_DestroyBatchVertexStorage();
     SituationUnloadShader(RGL.main_shader);
     SituationUnloadShader(RGL.shadow_shader);
-    SituationDestroyShader(RGL.shadow_volume_shader);
+    glDeleteVertexArrays(1, &RGL.blob_shadow_vao);
+    glDeleteBuffers(1, &RGL.blob_shadow_vbo);
+    glDeleteBuffers(1, &RGL.blob_shadow_ibo);
+    if (RGL.shadow_volume_program) glDeleteProgram(RGL.shadow_volume_program);
+    glDeleteVertexArrays(1, &RGL.shadow_stream_vao);
+    glDeleteBuffers(1, &RGL.shadow_stream_vbo);
+    glDeleteBuffers(1, &RGL.shadow_stream_ibo);
+    free(RGL.shadow_scratch_adjacency);
     SituationDestroyShader(RGL.shadow_darken_shader);
     glDeleteVertexArrays(1, &RGL.fullscreen_quad_vao);
 
     // 5. --- Free Core CPU-side Memory (from your original logic) ---
+    for (int i = 0; i < RGL.parallel_list_count; i++) RGL_DestroyCommandList(RGL.parallel_lists[i]);
+    free(RGL.parallel_lists);
     free(RGL.commands);
-    free(RGL.cpu_vertex_buffer);
+    free(RGL.sort_keys);
+    free(RGL.sort_keys_scratch);
 
     // 7. --- Zero out the global state (from your original logic) ---
     memset(&RGL, 0, sizeof(RGLState));
@@ -1949,14 +4532,51 @@ SITAPI void RGL_Shutdown(void) {
 SITAPI void RGL_Begin(int virtual_display_id) {
     if (!RGL.is_initialized) { _SituationSetErrorFromCode(SITUATION_ERROR_NOT_INITIALIZED, "RGL not initialized"); return; }
     if (RGL.is_batching) _RGL_FlushBatch();
+    _RGL_ProfileBeginFrame();
+
+    // Start the frame in a fresh ring segment; the previous frame's segment gets its fence here.
+    if (RGL.vertex_ring.write_offset_vertices > 0) {
+        RGL_BeginProfileZone("Vertex Ring Wait");
+        _RGL_AdvanceVertexRing();
+        RGL_EndProfileZone();
+    }
 
     // Reset per-frame stats
     RGL.stats.total_draw_calls = 0;
     RGL.stats.total_vertices_drawn = 0;
     RGL.stats.batch_flushes = 0;
+    RGL.stats.light_ubo_upload_time_ms = 0.0f;
+    RGL.stats.light_cluster_rebuilds = 0;
+    RGL.stats.stencil_volumes_drawn = 0;
+    RGL.stats.text_runs_built = 0;
+    RGL.stats.async_bytes_uploaded = 0;
+    RGL.stats.commands_flushed = 0;
+    RGL.stats.bytes_uploaded = 0;
+
+    // Last frame's transient scratch is dead; the arena restarts, sized to the busiest recent frame.
+    _RGL_ResetFrameArena();
+
+    // Upload whatever the async loader finished decoding since last frame.
+    RGL_BeginProfileZone("Async Uploads");
+    _RGL_PumpAsyncLoads();
+    RGL_EndProfileZone();
+
+    // Pooled render targets nobody has acquired for a while go back to the driver.
+    RGL_TrimRenderTexturePool(RGL_RENDER_TARGET_IDLE_SECONDS);
+
+    // Paths edited since last frame rebuild their sample caches here, so queries made from other
+    // threads during the frame only ever read them.
+    for (size_t i = 0; i < RGL.Path_count; i++) {
+        _RGL_BuildPathSamples(&RGL.Paths[i].data);
+    }
 
     RGL.is_batching = true;
+    RGL.dynamic_resolution.work_begin_time = SituationTimerGetTime();
+    _RGL_DynamicResolutionBeginPass();
     RGL.command_count = 0;
+    RGL.static_level_queue_count = 0;
+    RGL.instancing.draw_count = 0;
+    RGL.instancing.instance_count = 0;
     RGL.active_virtual_display_id = virtual_display_id;
 
     // Get the viewport size ONCE at the beginning of the render pass.
@@ -1976,88 +4596,575 @@ SITAPI void RGL_Begin(int virtual_display_id) {
 SITAPI void RGL_End(void) {
     if (!RGL.is_initialized) { _SituationSetErrorFromCode(SITUATION_ERROR_NOT_INITIALIZED, "RGL not initialized"); return; }
     if (!RGL.is_batching) return;
+    if (RGL.stencil_pass.active) {
+        _SituationSetWarning("RGL_End called inside a stencil shadow pass; closing it.");
+        RGL_EndStencilShadows();
+    }
+    if (RGL.recording_draw_list) {
+        _SituationSetWarning("RGL_End called while recording a draw list; ending the recording.");
+        RGL_EndDrawList();
+    }
     _RGL_FlushBatch();
+    _RGL_ProfileEndFrame();
     if (RGL.active_virtual_display_id >= 0) SituationSetVirtualDisplayDirty(RGL.active_virtual_display_id, true);
     RGL.is_batching = false;
+    if (RGL.dynamic_resolution.enabled) {
+        RGL.dynamic_resolution.work_ms += (float)((SituationTimerGetTime() - RGL.dynamic_resolution.work_begin_time) * 1000.0);
+        _RGL_DynamicResolutionEndPass();
+    }
 }
 
 /**
- * @brief Pushes the current view and projection matrices onto the camera stack.
- * This saves the current camera state, allowing it to be restored later with RGL_PopMatrix().
- * Useful for functions that need to temporarily switch to a 2D UI camera.
+ * @brief Creates an empty command list for recording batched draws off the render thread.
+ * @param initial_capacity Number of commands to preallocate (0 for RGL_COMMAND_LIST_DEFAULT_CAPACITY).
+ *        The list grows on demand, so this is only a hint.
+ * @return The new list, or NULL on allocation failure. Free it with RGL_DestroyCommandList().
  */
-SITAPI void RGL_PushMatrix(void) {
-    if (RGL.matrix_stack_ptr >= RGL_MATRIX_STACK_DEPTH - 1) {
-        _SituationSetErrorFromCode(SITUATION_ERROR_STACK_OVERFLOW, "RGL matrix stack overflow. Too many nested Pushes.");
-        return;
+SITAPI RGLCommandList* RGL_CreateCommandList(size_t initial_capacity) {
+    RGLCommandList* list = (RGLCommandList*)calloc(1, sizeof(RGLCommandList));
+    if (!list) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate command list");
+        return NULL;
+    }
+    if (!_RGL_EnsureCommandListCapacity(list, initial_capacity ? initial_capacity : RGL_COMMAND_LIST_DEFAULT_CAPACITY)) {
+        free(list);
+        return NULL;
     }
+    return list;
+}
 
-    // Save the current camera state to the stack
-    glm_mat4_copy(RGL.current_view_matrix, RGL.matrix_stack[RGL.matrix_stack_ptr].view);
-    glm_mat4_copy(RGL.current_projection_matrix, RGL.matrix_stack[RGL.matrix_stack_ptr].projection);
+/**
+ * @brief Frees a command list. Any commands still recorded in it are discarded.
+ * The list must not be bound to a thread (call RGL_EndCommandList() first).
+ */
+SITAPI void RGL_DestroyCommandList(RGLCommandList* list) {
+    if (!list) return;
+    free(list->commands);
+    free(list);
+}
 
-    RGL.matrix_stack_ptr++;
+/**
+ * @brief Binds a command list to the calling thread.
+ * Until RGL_EndCommandList(), the batched draw functions called on this thread (sprites, billboards,
+ * quads, triangles, lines, polygons, text) append to `list` instead of the frame batch. They read the
+ * current camera and RGL_SetTransform() state, so that state must not change while recording is in flight.
+ * Functions that issue GL calls directly (shadows, wireframes, immediate-mode helpers) are render-thread only.
+ * Recording between RGL_Begin() and RGL_End() is required, exactly as for direct drawing.
+ * @param list The list to record into. New commands are appended after any already recorded.
+ */
+SITAPI void RGL_BeginCommandList(RGLCommandList* list) {
+    if (!list) return;
+    if (g_rgl_recording_list) {
+        _SituationSetWarning("RGL_BeginCommandList: a command list is already bound to this thread; replacing it.");
+    }
+    g_rgl_recording_list = list;
 }
 
 /**
- * @brief Pops the last saved view and projection matrices from the camera stack.
- * This restores the camera state that was saved by the last call to RGL_PushMatrix().
+ * @brief Unbinds the calling thread's command list. Subsequent draws on this thread go to the frame batch.
  */
-SITAPI void RGL_PopMatrix(void) {
-    if (RGL.matrix_stack_ptr <= 0) {
-        _SituationSetErrorFromCode(SITUATION_ERROR_STACK_UNDERFLOW, "RGL matrix stack underflow. Pop without a Push.");
+SITAPI void RGL_EndCommandList(void) {
+    g_rgl_recording_list = NULL;
+}
+
+/**
+ * @brief (Render thread) Appends a recorded command list to the current frame batch.
+ * The commands join the batch exactly as if they had been drawn directly at this point, so they are
+ * sorted and drawn together with everything else at the next flush. The list is emptied (its memory
+ * is kept) so it can be recorded into again next frame. Lists larger than the batch limit are split
+ * across flushes.
+ * @param list The list to submit. It must not be bound to a thread that is still recording.
+ */
+SITAPI void RGL_SubmitCommandList(RGLCommandList* list) {
+    if (!list || list->command_count == 0) return;
+    if (!RGL.is_batching || g_rgl_recording_list) {
+        _SituationSetWarning("RGL_SubmitCommandList must be called on the render thread between RGL_Begin and RGL_End.");
         return;
     }
 
-    RGL.matrix_stack_ptr--;
-
-    // Restore the camera state from the stack
-    glm_mat4_copy(RGL.matrix_stack[RGL.matrix_stack_ptr].view, RGL.current_view_matrix);
-    glm_mat4_copy(RGL.matrix_stack[RGL.matrix_stack_ptr].projection, RGL.current_projection_matrix);
+    size_t submitted = 0;
+    while (submitted < list->command_count) {
+        size_t chunk = list->command_count - submitted;
+        if (chunk > RGL_MAX_BATCH_CAPACITY) chunk = RGL_MAX_BATCH_CAPACITY;
+        if (!_RGL_EnsureCommandCapacity(chunk)) break;
+        memcpy(&RGL.commands[RGL.command_count], &list->commands[submitted], chunk * sizeof(RGLInternalDraw));
+        RGL.command_count += chunk;
+        submitted += chunk;
+    }
+    list->command_count = 0;
 }
 
-SITAPI void RGL_SetAmbientLight(Color color) {
-    if (!RGL.is_initialized) return;
-    vec4 norm_color;
-    SituationConvertColorToVec4(color, norm_color);
-    glm_vec3_copy(norm_color, RGL.ambient_light_color);
+/**
+ * @brief Returns the number of commands currently recorded in a list (0 after submission).
+ */
+SITAPI size_t RGL_GetCommandListSize(const RGLCommandList* list) {
+    return list ? list->command_count : 0;
 }
 
-static int _RGL_CompareRankedLights(const void* a, const void* b) {
-    const RGLRankedLight* light_a = (const RGLRankedLight*)a;
-    const RGLRankedLight* light_b = (const RGLRankedLight*)b;
-    if (light_a->score < light_b->score) return -1;
-    if (light_a->score > light_b->score) return 1;
-    return 0;
-}
+// --- Retained Draw Lists ---
 
-static int _RGL_FindFreeLightSlot(void) {
-    for (int i = 0; i < RGL_MAX_LIGHTS; i++) {
-        if (RGL.lights[i].id == 0) return i;
+/**
+ * @brief Creates an empty retained draw list.
+ * A draw list holds a layer that rarely changes (HUD panels, text, test patterns, RGL_DrawPathAsMap
+ * minimaps, static decoration) already sorted and assembled in a GPU buffer, so replaying it costs
+ * one or two draw calls and no CPU-side vertex work. Destroy lists before RGL_Shutdown().
+ * @return The new list, or NULL on allocation failure. Free it with RGL_DestroyDrawList().
+ */
+SITAPI RGLDrawList* RGL_CreateDrawList(void) {
+    RGLDrawList* list = (RGLDrawList*)calloc(1, sizeof(RGLDrawList));
+    if (!list) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate draw list");
+        return NULL;
     }
-    _SituationSetErrorFromCode(SITUATION_ERROR_GENERAL, "Maximum number of RGL lights reached.");
-    return -1;
+    return list;
 }
 
-SITAPI int RGL_CreatePointLight(Vector3 position, Color color, float radius, float intensity) {
-    ma_mutex_lock(&RGL.light_mutex);
-    int index = _RGL_FindFreeLightSlot();
-    if (index != -1) {
-        RGLLight* light = &RGL.lights[index];
-        memset(light, 0, sizeof(RGLLight));
-        light->id = index + 1;
-        light->is_active = true;
-        light->type = RGL_LIGHT_TYPE_POINT;
-        glm_vec3_copy(position.raw, light->position);
-        light->color = color;
-        light->radius = fmaxf(0.01f, radius);
-        light->intensity = fmaxf(0.0f, intensity);
+/**
+ * @brief Frees a draw list, its recording and its GPU buffers. A replay still queued this frame is drawn first.
+ */
+SITAPI void RGL_DestroyDrawList(RGLDrawList* list) {
+    if (!list) return;
+    if (RGL.recording_draw_list == list) {
+        if (g_rgl_recording_list == &list->recording) g_rgl_recording_list = NULL;
+        RGL.recording_draw_list = NULL;
     }
-    ma_mutex_unlock(&RGL.light_mutex);
-    return (index != -1) ? (index + 1) : -1;
+    _RGL_ReleaseDrawListGeometry(list);
+    free(list->recording.commands);
+    free(list->ranges);
+    free(list);
 }
 
-SITAPI int RGL_CreateDirectionalLight(Vector3 direction, Color color, float intensity) {
+/**
+ * @brief (Render thread) Starts re-recording a draw list, discarding its previous contents.
+ * Until RGL_EndDrawList(), the batched draw functions (sprites, billboards, quads, triangles, lines,
+ * polygons, text) append to the list instead of the frame, exactly as with RGL_BeginCommandList().
+ * They are recorded in world space under the current RGL_SetTransform(); the camera is not baked in,
+ * so replays follow whatever camera is current when the list is drawn. Direct GL features (level
+ * geometry, instancing, shadows, wireframes) are not captured.
+ * Must be called between RGL_Begin() and RGL_End(), outside any other recording.
+ */
+SITAPI void RGL_BeginDrawList(RGLDrawList* list) {
+    if (!list) return;
+    if (!RGL.is_batching || g_rgl_recording_list) {
+        _SituationSetWarning("RGL_BeginDrawList must be called on the render thread between RGL_Begin and RGL_End, outside other recordings.");
+        return;
+    }
+    list->recording.command_count = 0;
+    list->valid = false;
+    RGL.recording_draw_list = list;
+    g_rgl_recording_list = &list->recording;
+}
+
+/**
+ * @brief Ends the recording started by RGL_BeginDrawList() and bakes it.
+ * The commands are sorted and turned into vertices exactly as a flush would, once, and uploaded as
+ * static buffers. The CPU-side recording is kept, so the next recording reuses its memory.
+ * @return True if the list is now valid (an empty recording is valid and draws nothing).
+ */
+SITAPI bool RGL_EndDrawList(void) {
+    RGLDrawList* list = RGL.recording_draw_list;
+    if (!list) {
+        _SituationSetWarning("RGL_EndDrawList called without a matching RGL_BeginDrawList.");
+        return false;
+    }
+    if (g_rgl_recording_list == &list->recording) g_rgl_recording_list = NULL;
+    RGL.recording_draw_list = NULL;
+    list->valid = _RGL_BuildDrawList(list);
+    return list->valid;
+}
+
+/**
+ * @brief Replays a recorded draw list at this point in the frame.
+ * Everything drawn before the call is flushed first, so the list lands in painter's order: over what
+ * came before, under what comes after. Inside the list, opaque commands draw first and translucent
+ * ones back-to-front, as sorted at recording time; the translucent ones join the flush's blended pass,
+ * after its opaque batch and without writing depth. Lighting, the camera and RGL_SetTransform() are
+ * those current at the replay; the same list may be drawn several times per frame.
+ * @note Textures are referenced, not copied. In a bindless list, commands whose texture was unloaded
+ * since recording draw untextured until the list is recorded again. Without bindless textures the list
+ * binds the recorded texture names, which are not revalidated: unload a texture only after re-recording
+ * (or destroying) every list that uses it.
+ * @param transform Model matrix applied to the recorded positions, or NULL for identity.
+ */
+SITAPI void RGL_DrawDrawList(const RGLDrawList* list, mat4 transform) {
+    if (!RGL.is_batching || !list || !list->valid || list->range_count == 0) return;
+    if (g_rgl_recording_list) {
+        _SituationSetWarning("RGL_DrawDrawList is render-thread only; it cannot be recorded into a command list.");
+        return;
+    }
+
+    // 1. --- Draw what the frame submitted so far, so the list keeps its place in the frame ---
+    _RGL_FlushBatch();
+
+    // 2. --- Queue the replay as one mesh instance carrying the transform ---
+    const vec4 full_uv = {0.0f, 0.0f, 1.0f, 1.0f};
+    RGLTexture no_texture = {0};
+    RGLInstanceData* slot = _RGL_QueueInstancedDraw(1, -1, no_texture, full_uv, 1, false);
+    if (!slot) return;
+    RGL.instancing.draws[RGL.instancing.draw_count - 1].draw_list = list;
+
+    mat4 model;
+    if (transform) glm_mat4_copy(transform, model);
+    else glm_mat4_identity(model);
+    if (RGL.use_transform) glm_mat4_mul(RGL.transform, model, slot->model);
+    else glm_mat4_copy(model, slot->model);
+    glm_vec4_one(slot->tint);
+}
+
+/**
+ * @brief Marks a draw list as stale. It draws nothing until it is recorded again; its buffers are kept until then.
+ */
+SITAPI void RGL_InvalidateDrawList(RGLDrawList* list) {
+    if (list) list->valid = false;
+}
+
+/**
+ * @brief Returns true if the list holds a finished recording that has not been invalidated.
+ * The usual pattern is to re-record only when this returns false.
+ */
+SITAPI bool RGL_IsDrawListValid(const RGLDrawList* list) {
+    return list && list->valid;
+}
+
+/**
+ * @brief (INTERNAL) Bakes a draw list: radix-sorts its commands, assembles 4 vertices per command in
+ * sort order and splits the result into ranges per (opacity bucket, texture).
+ */
+static bool _RGL_BuildDrawList(RGLDrawList* list) {
+    _RGL_ReleaseDrawListGeometry(list);
+    list->range_count = 0;
+    list->bindless = RGL.bindless.enabled;
+    size_t count = list->recording.command_count;
+    if (count == 0) return true;
+
+    // 1. --- Sort, with the same keys as the frame batch ---
+    RGLFrameArenaMark scratch_mark = _RGL_FrameArenaMark();
+    RGLSortKey* keys = (RGLSortKey*)_RGL_FrameAlloc(sizeof(RGLSortKey) * count * 2);
+    RGLBatchVertex* vertices = (RGLBatchVertex*)_RGL_FrameAlloc(sizeof(RGLBatchVertex) * count * 4);
+    uint32_t* indices = (uint32_t*)_RGL_FrameAlloc(sizeof(uint32_t) * count * 6);
+    if (!keys || !vertices || !indices) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate draw list vertices");
+        _RGL_FrameArenaRewind(scratch_mark);
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        keys[i].key = _RGL_MakeSortKey(&list->recording.commands[i]);
+        keys[i].index = (uint32_t)i;
+    }
+    const RGLSortKey* sorted = _RGL_RadixSortKeys(keys, keys + count, count);
+
+    // 2. --- Assemble vertices and ranges in sort order ---
+    bool ok = true;
+    uint32_t last_slot = 0, last_generation = 0;
+    uint16_t last_index = 0;
+    for (size_t i = 0; i < count && ok; i++) {
+        const RGLInternalDraw* cmd = &list->recording.commands[sorted[i].index];
+        bool blend = (sorted[i].key & RGL_SORT_KEY_ALPHA_BIT) != 0;
+
+        uint16_t texture_index = 0;
+        if (list->bindless && cmd->texture.texture.slot_index != 0) {
+            if (cmd->texture.texture.slot_index != last_slot || cmd->texture.texture.generation != last_generation) {
+                last_slot = cmd->texture.texture.slot_index;
+                last_generation = cmd->texture.texture.generation;
+                last_index = _RGL_GetBindlessTextureIndex(&cmd->texture.texture);
+                if (last_index == 0) list->bindless = false; // Table full: this list binds per range
+            }
+            texture_index = last_index;
+        }
+
+        RGLDrawListRange* range = list->range_count > 0 ? &list->ranges[list->range_count - 1] : NULL;
+        if (!range || range->blend != blend || range->texture.texture.slot_index != cmd->texture.texture.slot_index ||
+            range->texture.texture.generation != cmd->texture.texture.generation) {
+            if (list->range_count >= list->range_capacity) {
+                size_t new_capacity = list->range_capacity == 0 ? 16 : list->range_capacity * 2;
+                RGLDrawListRange* new_ranges = realloc(list->ranges, sizeof(RGLDrawListRange) * new_capacity);
+                if (!new_ranges) {
+                    _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to grow draw list ranges");
+                    ok = false;
+                    break;
+                }
+                list->ranges = new_ranges;
+                list->range_capacity = new_capacity;
+            }
+            range = &list->ranges[list->range_count++];
+            range->first_index = (uint32_t)(i * 6);
+            range->index_count = 0;
+            range->texture = cmd->texture;
+            range->texture_index = texture_index;
+            range->blend = blend;
+        }
+        range->index_count += 6;
+
+        // Triangles become degenerate quads (v2 repeated), as in the frame batch.
+        for (int v = 0; v < 4; v++) {
+            int src = (cmd->is_triangle && v == 3) ? 2 : v;
+            _RGL_PackBatchVertex(&vertices[i * 4 + v], cmd->world_positions[src], cmd->normals[src], cmd->tex_coords[src], cmd->colors[src], cmd->light_levels[src]);
+            vertices[i * 4 + v].texture_index = texture_index;
+        }
+        uint32_t base = (uint32_t)(i * 4);
+        uint32_t* dst = &indices[i * 6];
+        dst[0] = base + 0; dst[1] = base + 1; dst[2] = base + 2;
+        dst[3] = base + 0; dst[4] = base + 2; dst[5] = base + 3;
+    }
+
+    // 3. --- Upload once ---
+    if (ok) {
+        ok = _RGL_UploadInstanceGeometry(&list->geometry, vertices, (int)(count * 4), indices, (int)(count * 6));
+        if (!ok) _SituationSetErrorFromCode(SITUATION_ERROR_GENERAL, "Failed to create draw list buffers");
+        else RGL.stats.bytes_uploaded += count * 4 * sizeof(RGLBatchVertex);
+    }
+    if (!ok) list->range_count = 0;
+    list->bindless_generation = RGL.bindless.table_generation;
+    _RGL_FrameArenaRewind(scratch_mark);
+    return ok;
+}
+
+/**
+ * @brief (INTERNAL) Deletes a draw list's GPU buffers. A replay still queued this frame refers to
+ * them, so the batch is flushed first and the replay keeps its place in the frame.
+ */
+static void _RGL_ReleaseDrawListGeometry(RGLDrawList* list) {
+    if (!list->geometry.vao) return;
+    for (size_t d = 0; d < RGL.instancing.draw_count; d++) {
+        if (RGL.instancing.draws[d].draw_list == list) {
+            _RGL_FlushBatch();
+            break;
+        }
+    }
+    for (size_t d = 0; d < RGL.instancing.draw_count; d++) {
+        if (RGL.instancing.draws[d].draw_list == list) RGL.instancing.draws[d].instance_count = 0; // Only if the flush could not run
+    }
+    glDeleteVertexArrays(1, &list->geometry.vao);
+    glDeleteBuffers(1, &list->geometry.vbo);
+    glDeleteBuffers(1, &list->geometry.ibo);
+    memset(&list->geometry, 0, sizeof(RGLInstanceGeometry));
+}
+
+/**
+ * @brief (INTERNAL) Draws a list's ranges in the instanced mesh mode, with its transform stored at `instance`.
+ * Called from _RGL_DrawQueuedInstances. When every texture of the list is bindless, ranges only split at
+ * the opaque/alpha boundary, so a typical list is one or two draws
+ * (each maps to SituationCmdDrawIndexed(cmd, count, 1, first_index, 0, instance) on the command-buffer path).
+ */
+static void _RGL_ReplayDrawList(const RGLDrawList* list, uint32_t instance, bool blended) {
+    if (!list->geometry.vao) return;
+    bool bindless = list->bindless && RGL.bindless.enabled;
+    bool recheck = list->bindless && list->bindless_generation != RGL.bindless.table_generation;
+    if (recheck) {
+        // A texture was released since the bake, so an index may now name another texture.
+        // Any stale range sends the whole replay down the per-range bind path.
+        for (size_t r = 0; r < list->range_count && bindless; r++) {
+            const RGLDrawListRange* range = &list->ranges[r];
+            if (range->texture_index != 0 && !_RGL_IsBindlessIndexCurrent(&range->texture.texture, range->texture_index)) bindless = false;
+        }
+    }
+    const vec4 full_uv = {0.0f, 0.0f, 1.0f, 1.0f};
+    glUniform1i(RGL.instancing.loc_mode, 1);
+    glUniform1ui(RGL.instancing.loc_base, instance);
+    glUniform4fv(RGL.instancing.loc_uv_rect, 1, full_uv);
+    if (bindless) {
+        _RGL_UploadBindlessHandles(); // Handles made resident while baking
+        glUniform1i(RGL.bindless.loc_enabled, 1);
+    }
+
+    glBindVertexArray(list->geometry.vao);
+    size_t r = 0;
+    while (r < list->range_count) {
+        const RGLDrawListRange* range = &list->ranges[r];
+        if (range->blend != blended) { r++; continue; }
+        uint32_t index_count = range->index_count;
+        size_t next = r + 1;
+        while (bindless && next < list->range_count && list->ranges[next].blend == range->blend) {
+            index_count += list->ranges[next++].index_count;
+        }
+
+        if (range->blend) glEnable(GL_BLEND); else glDisable(GL_BLEND);
+        if (!bindless) {
+            uint32_t slot = range->texture.texture.slot_index;
+            if (recheck && range->texture_index != 0 && !_RGL_IsBindlessIndexCurrent(&range->texture.texture, range->texture_index)) {
+                slot = 0; // Its texture was unloaded; the GL name may already belong to another one
+            }
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, slot);
+            glUniform1i(RGL.loc_use_texture, slot != 0);
+        }
+        glDrawElementsInstanced(GL_TRIANGLES, (GLsizei)index_count, GL_UNSIGNED_INT, (void*)(uintptr_t)(range->first_index * sizeof(uint32_t)), 1);
+        RGL.stats.total_draw_calls++;
+        RGL.stats.total_vertices_drawn += index_count / 6 * 4;
+        r = next;
+    }
+    if (bindless) glUniform1i(RGL.bindless.loc_enabled, 0);
+}
+
+/**
+ * @brief (INTERNAL) Draws one queued GPU road run with no vertex attributes: the road mode of the main
+ * vertex shader expands RGL_GPU_ROAD_QUADS_PER_SEGMENT quads per segment from gl_VertexID and the
+ * path's sample and point buffers. Called from _RGL_DrawQueuedInstances.
+ */
+static void _RGL_DrawQueuedGPURoad(const RGLInstancedDraw* draw) {
+    const RGLGPURoadDraw* road = &draw->road;
+    if (!road->sample_ssbo || road->segment_count == 0) return;
+    if (!RGL.instancing.road_vao) glGenVertexArrays(1, &RGL.instancing.road_vao);
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 11, road->sample_ssbo);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 12, road->point_ssbo);
+    glUniform1i(RGL.instancing.loc_mode, 3);
+    glUniform4fv(RGL.instancing.loc_road, 1, road->params);
+    glUniform2fv(RGL.instancing.loc_road_loop, 1, road->loop);
+    glUniform1ui(RGL.instancing.loc_road_segments, road->window_segments);
+    glUniform1ui(RGL.instancing.loc_road_layers, road->layers);
+    glDisable(GL_BLEND);
+    if (road->bindless) {
+        _RGL_UploadBindlessHandles(); // Handles made resident while uploading the path
+        glUniform1i(RGL.bindless.loc_enabled, 1);
+    } else {
+        uint32_t slot = draw->texture.texture.slot_index;
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, slot);
+        glUniform1i(RGL.loc_use_texture, slot != 0);
+    }
+
+    const GLsizei vertices_per_segment = RGL_GPU_ROAD_QUADS_PER_SEGMENT * 6;
+    glBindVertexArray(RGL.instancing.road_vao);
+    glDrawArrays(GL_TRIANGLES, (GLint)(road->first_segment * vertices_per_segment), (GLsizei)(road->segment_count * vertices_per_segment));
+    RGL.stats.total_draw_calls++;
+    RGL.stats.total_vertices_drawn += (uint64_t)road->segment_count * vertices_per_segment;
+    if (road->bindless) glUniform1i(RGL.bindless.loc_enabled, 0);
+}
+
+#ifdef SITUATION_ENABLE_THREADING
+typedef struct {
+    void (*record_func)(int job_index, void* user_data);
+    void* user_data;
+} RGLParallelRecordContext;
+
+static void _RGL_RecordParallelJob(int job_index, void* user_data) {
+    RGLParallelRecordContext* ctx = (RGLParallelRecordContext*)user_data;
+    RGL_BeginCommandList(RGL.parallel_lists[job_index]);
+    ctx->record_func(job_index, ctx->user_data);
+    RGL_EndCommandList();
+}
+
+/**
+ * @brief (Render thread) Records draws in parallel and merges them into the frame batch.
+ * Each job records into its own internal command list on a pool worker (fork-join via
+ * SituationDispatchParallel), so workers never contend on shared state. After all jobs finish the lists
+ * are submitted in job-index order; batch sorting makes the final draw order independent of which
+ * worker ran first. Typical use is one job per slice of the scene (path segments, scenery ranges, ...).
+ * @param pool The worker pool to run on.
+ * @param job_count Number of jobs (lists). A good default is SituationGetCPUThreadCount().
+ * @param record_func Called once per job with its index; it should only call batched draw functions.
+ * @param user_data Passed through to record_func.
+ */
+SITAPI void RGL_RecordParallel(SituationThreadPool* pool, int job_count, void (*record_func)(int job_index, void* user_data), void* user_data) {
+    if (!RGL.is_batching || !pool || !record_func || job_count <= 0) return;
+
+    // 1. --- Make sure every job has a list (they persist across frames) ---
+    if (job_count > RGL.parallel_list_count) {
+        RGLCommandList** new_lists = realloc(RGL.parallel_lists, sizeof(RGLCommandList*) * job_count);
+        if (!new_lists) {
+            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to grow parallel command lists");
+            return;
+        }
+        RGL.parallel_lists = new_lists;
+        for (int i = RGL.parallel_list_count; i < job_count; i++) {
+            RGL.parallel_lists[i] = RGL_CreateCommandList(0);
+            if (!RGL.parallel_lists[i]) {
+                RGL.parallel_list_count = i;
+                return;
+            }
+        }
+        RGL.parallel_list_count = job_count;
+    }
+
+    // 2. --- Record on the pool ---
+    RGLParallelRecordContext ctx = { record_func, user_data };
+    SituationDispatchParallel(pool, job_count, 1, _RGL_RecordParallelJob, &ctx);
+
+    // 3. --- Merge in a deterministic order ---
+    for (int i = 0; i < job_count; i++) RGL_SubmitCommandList(RGL.parallel_lists[i]);
+}
+#endif
+
+/**
+ * @brief Pushes the current view and projection matrices onto the camera stack.
+ * This saves the current camera state, allowing it to be restored later with RGL_PopMatrix().
+ * Useful for functions that need to temporarily switch to a 2D UI camera.
+ */
+SITAPI void RGL_PushMatrix(void) {
+    if (RGL.matrix_stack_ptr >= RGL_MATRIX_STACK_DEPTH - 1) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_STACK_OVERFLOW, "RGL matrix stack overflow. Too many nested Pushes.");
+        return;
+    }
+
+    // Save the current camera state to the stack
+    glm_mat4_copy(RGL.current_view_matrix, RGL.matrix_stack[RGL.matrix_stack_ptr].view);
+    glm_mat4_copy(RGL.current_projection_matrix, RGL.matrix_stack[RGL.matrix_stack_ptr].projection);
+
+    RGL.matrix_stack_ptr++;
+}
+
+/**
+ * @brief Pops the last saved view and projection matrices from the camera stack.
+ * This restores the camera state that was saved by the last call to RGL_PushMatrix().
+ */
+SITAPI void RGL_PopMatrix(void) {
+    if (RGL.matrix_stack_ptr <= 0) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_STACK_UNDERFLOW, "RGL matrix stack underflow. Pop without a Push.");
+        return;
+    }
+
+    RGL.matrix_stack_ptr--;
+
+    // Restore the camera state from the stack
+    glm_mat4_copy(RGL.matrix_stack[RGL.matrix_stack_ptr].view, RGL.current_view_matrix);
+    glm_mat4_copy(RGL.matrix_stack[RGL.matrix_stack_ptr].projection, RGL.current_projection_matrix);
+}
+
+SITAPI void RGL_SetAmbientLight(Color color) {
+    if (!RGL.is_initialized) return;
+    vec4 norm_color;
+    SituationConvertColorToVec4(color, norm_color);
+    glm_vec3_copy(norm_color, RGL.ambient_light_color);
+}
+
+/**
+ * @brief (INTERNAL) Records that a light slot was just filled. Call with light_mutex held.
+ * @param index The slot index that now holds a light.
+ */
+static void _RGL_OnLightSlotUsed(int index) {
+    if (index + 1 > RGL.light_slot_count) RGL.light_slot_count = index + 1;
+    RGL.light_version++;
+}
+
+static int _RGL_FindFreeLightSlot(void) {
+    for (int i = 0; i < RGL_MAX_LIGHTS; i++) {
+        if (RGL.lights[i].id == 0) return i;
+    }
+    _SituationSetErrorFromCode(SITUATION_ERROR_GENERAL, "Maximum number of RGL lights reached.");
+    return -1;
+}
+
+SITAPI int RGL_CreatePointLight(Vector3 position, Color color, float radius, float intensity) {
+    ma_mutex_lock(&RGL.light_mutex);
+    int index = _RGL_FindFreeLightSlot();
+    if (index != -1) {
+        RGLLight* light = &RGL.lights[index];
+        memset(light, 0, sizeof(RGLLight));
+        light->id = index + 1;
+        light->is_active = true;
+        light->type = RGL_LIGHT_TYPE_POINT;
+        glm_vec3_copy(position.raw, light->position);
+        light->color = color;
+        light->radius = fmaxf(0.01f, radius);
+        light->intensity = fmaxf(0.0f, intensity);
+        _RGL_OnLightSlotUsed(index);
+    }
+    ma_mutex_unlock(&RGL.light_mutex);
+    return (index != -1) ? (index + 1) : -1;
+}
+
+SITAPI int RGL_CreateDirectionalLight(Vector3 direction, Color color, float intensity) {
     ma_mutex_lock(&RGL.light_mutex);
     int index = _RGL_FindFreeLightSlot();
     if (index != -1) {
@@ -2069,6 +5176,7 @@ SITAPI int RGL_CreateDirectionalLight(Vector3 direction, Color color, float inte
         glm_vec3_normalize_to(direction.raw, light->direction);
         light->color = color;
         light->intensity = fmaxf(0.0f, intensity);
+        _RGL_OnLightSlotUsed(index);
     }
     ma_mutex_unlock(&RGL.light_mutex);
     return (index != -1) ? (index + 1) : -1;
@@ -2090,6 +5198,7 @@ SITAPI int RGL_CreateSpotLight(Vector3 position, Vector3 direction, Color color,
         light->intensity = fmaxf(0.0f, intensity);
         light->spot_outer_angle = fmaxf(0.0f, outer_angle_deg);
         light->spot_inner_angle = fmaxf(0.0f, fminf(inner_angle_deg, outer_angle_deg));
+        _RGL_OnLightSlotUsed(index);
     }
     ma_mutex_unlock(&RGL.light_mutex);
     return (index != -1) ? (index + 1) : -1;
@@ -2119,6 +5228,10 @@ SITAPI void RGL_DestroyLight(int light_id) {
     ma_mutex_lock(&RGL.light_mutex);
     if (RGL.lights[light_id - 1].id == light_id) {
         memset(&RGL.lights[light_id - 1], 0, sizeof(RGLLight));
+        while (RGL.light_slot_count > 0 && RGL.lights[RGL.light_slot_count - 1].id == 0) {
+            RGL.light_slot_count--;
+        }
+        RGL.light_version++;
     }
     ma_mutex_unlock(&RGL.light_mutex);
 }
@@ -2132,6 +5245,7 @@ SITAPI void RGL_AnimateLight(int light_id, float time, float frequency, float am
     int index = light_id - 1;
     float new_intensity = RGL.lights[index].intensity * (1.0f + amplitude * sinf(time * frequency));
     RGL.lights[index].intensity = fmaxf(0.0f, new_intensity);
+    RGL.light_version++;
     ma_mutex_unlock(&RGL.light_mutex);
 }
 
@@ -2144,8 +5258,9 @@ SITAPI void RGL_SetLightActive(int light_id, bool active) {
         return;
     }
     ma_mutex_lock(&RGL.light_mutex);
-    if (RGL.lights[light_id - 1].id == light_id) {
-        RGL.lights[light_id - 1].is_active = active;
+    if (RGL.lights[light_id - 1].id == light_id && RGL.lights[light_id - 1].is_active != active) {
+        RGL.lights[light_id - 1].is_active = active; // Only a real change invalidates the light grid
+        RGL.light_version++;
     }
     ma_mutex_unlock(&RGL.light_mutex); // CORRECTED
 }
@@ -2155,6 +5270,7 @@ SITAPI void RGL_SetLightColor(int light_id, Color color) {
     ma_mutex_lock(&RGL.light_mutex);
     if (RGL.lights[light_id - 1].id == light_id) {
         RGL.lights[light_id - 1].color = color;
+        RGL.light_version++;
     }
     ma_mutex_unlock(&RGL.light_mutex);
 }
@@ -2164,6 +5280,7 @@ SITAPI void RGL_SetLightIntensity(int light_id, float intensity) {
     ma_mutex_lock(&RGL.light_mutex);
     if (RGL.lights[light_id - 1].id == light_id) {
         RGL.lights[light_id - 1].intensity = fmaxf(0.0f, intensity);
+        RGL.light_version++;
     }
     ma_mutex_unlock(&RGL.light_mutex);
 }
@@ -2173,6 +5290,7 @@ SITAPI void RGL_SetLightPosition(int light_id, Vector3 position) {
     ma_mutex_lock(&RGL.light_mutex);
     if (RGL.lights[light_id - 1].id == light_id) {
         glm_vec3_copy(position.raw, RGL.lights[light_id - 1].position);
+        RGL.light_version++;
     }
     ma_mutex_unlock(&RGL.light_mutex);
 }
@@ -2182,6 +5300,7 @@ SITAPI void RGL_SetLightDirection(int light_id, Vector3 direction) {
     ma_mutex_lock(&RGL.light_mutex);
     if (RGL.lights[light_id - 1].id == light_id) {
         glm_vec3_normalize_to(direction.raw, RGL.lights[light_id - 1].direction);
+        RGL.light_version++;
     }
     ma_mutex_unlock(&RGL.light_mutex);
 }
@@ -2374,109 +5493,456 @@ SITAPI Vector3 RGL_ScreenToWorld(Vector2 screen_pos, float z_depth_normalized) {
 /**
  * @brief Creates a new texture that can be used as a rendering target.
  *
- * This function generates an OpenGL Framebuffer Object (FBO) and attaches a new,
- * empty texture to it. You can then use RGL_SetRenderTarget() to draw into this texture.
+ * Render textures are virtual displays taken from the render-target pool (see RGL_AcquireRenderTexture),
+ * so a target destroyed and re-created at the same size, such as a per-frame post-effect buffer or a
+ * minimap, reuses the same display instead of building a new framebuffer every time.
+ *
+ * @warning Unlike a freshly created framebuffer, a reused target keeps the color and depth its previous
+ *          owner left in it. Draw over all of it, or clear color and depth after RGL_Begin on its
+ *          virtual display (as RGL_DrawPathAsMap does) before relying on its contents.
  *
  * @param width The width of the render texture in pixels.
  * @param height The height of the render texture in pixels.
- * @return An RGLTexture configured as a render target. On failure, id and fbo_id will be 0.
+ * @return An RGLTexture configured as a render target. On failure, virtual_display_id is -1.
  */
 SITAPI RGLTexture RGL_CreateRenderTexture(int width, int height) {
-    RGLTexture result = {0};
-    result.virtual_display_id = -1;
-    int display_id = -1;
-    // Phase 3: Create virtual display. For now, assume parameters.
-    // Scaling and blending defaults can be adjusted.
-    if (SituationCreateVirtualDisplay((vec2){(float)width, (float)height}, 1.0, 0, SITUATION_SCALING_FIT, SITUATION_BLEND_ALPHA, &display_id) == SITUATION_SUCCESS) {
-        result.virtual_display_id = display_id;
-        // Retrieve the texture associated with the virtual display?
-        // SituationGetVirtualDisplay returns a struct pointer which contains the texture ID in implementation blocks
-        // But RGLTexture wrapping SituationTexture is opaque.
-        // We might not be able to populate .texture yet without further API from Situation.
-        // But for RGL usage, the virtual_display_id is key for RGL_Begin.
-    }
-    return result;
+    return RGL_AcquireRenderTexture(width, height);
 }
 
 /**
  * @brief Destroys a render texture and its associated OpenGL objects.
+ * A pooled render target is released to the pool instead, and destroyed once it has been idle for
+ * RGL_RENDER_TARGET_IDLE_SECONDS (or by RGL_TrimRenderTexturePool).
  * @param texture The render texture to destroy.
  */
 SITAPI void RGL_DestroyRenderTexture(RGLTexture texture) {
     if (texture.virtual_display_id >= 0) {
-        SituationDestroyVirtualDisplay(texture.virtual_display_id);
+        RGL_ReleaseRenderTexture(texture);
     } else if (texture.texture.slot_index != 0) {
+        _RGL_ReleaseBindlessTexture(texture.texture.slot_index);
         SituationDestroyTexture(&texture.texture);
     }
 }
 
 /**
- * @brief Sets the current rendering target to a specified render texture.
- * All subsequent drawing operations will be directed to this texture instead of the screen.
- *
- * @param texture The render texture to set as the target.
+ * @brief Gets a render texture of the given size, reusing a released pooled target when one matches.
+ * A reused target comes back configured like a new one (visible, opacity 1, z-order 0, fit scaling) but
+ * keeps its previous contents, so draw over all of it or clear it first.
+ * @return The render texture, or one with virtual_display_id -1 on failure. Give it back with
+ *         RGL_ReleaseRenderTexture (or RGL_DestroyRenderTexture).
  */
-SITAPI void RGL_SetRenderTarget(RGLTexture texture) {
-    _RGL_FlushBatch(); // RGL is responsible for flushing its own batch!
-    if (texture.virtual_display_id >= 0) {
-        // Switch context to this virtual display.
-        // In Situation, this usually means RGL_Begin(id)
-        // But RGL_SetRenderTarget suggests switching mid-frame?
-        // Situation's Virtual Displays are composited later.
-        // If we want to draw TO it, we need to be in a render pass for it.
-        // This likely maps to ending current pass and beginning new one.
-        RGL.active_virtual_display_id = texture.virtual_display_id;
-        // Situation doesn't have a "SetRenderTarget" because it uses CommandBuffers.
-        // For compatibility, we update RGL state so next flush/draw goes to it?
-        // But without CommandBuffers, we can't change target easily in GL 3.3 style loop.
-        // We will update the state variable used by RGL_Begin logic.
+SITAPI RGLTexture RGL_AcquireRenderTexture(int width, int height) {
+    RGLTexture result = {0};
+    result.virtual_display_id = -1;
+    if (width <= 0 || height <= 0) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_INVALID_PARAM, "RGL_AcquireRenderTexture: size must be positive.");
+        return result;
+    }
+
+    // 1. --- Reuse a released target of the same size ---
+    int free_slot = -1, oldest_released = -1;
+    for (int i = 0; i < RGL_RENDER_TARGET_POOL_SIZE; i++) {
+        RGLRenderTargetSlot* slot = &RGL.render_targets[i];
+        if (!slot->occupied) {
+            if (free_slot < 0) free_slot = i;
+            continue;
+        }
+        if (slot->in_use) continue;
+        if (slot->width == width && slot->height == height) {
+            slot->in_use = true;
+            _RGL_ConfigurePooledTarget(slot->display_id, true);
+            result.virtual_display_id = slot->display_id;
+            return result;
+        }
+        if (oldest_released < 0 || slot->released_time < RGL.render_targets[oldest_released].released_time) oldest_released = i;
+    }
+
+    // 2. --- Make room: a full pool gives up its longest-idle target ---
+    if (free_slot < 0 && oldest_released >= 0) {
+        SituationDestroyVirtualDisplay(RGL.render_targets[oldest_released].display_id);
+        RGL.render_targets[oldest_released].occupied = false;
+        free_slot = oldest_released;
+    }
+
+    // 3. --- Create a new display; it is pooled if a slot is left, otherwise owned by the caller alone ---
+    int display_id = -1;
+    Vector2 resolution = { .x = (float)width, .y = (float)height };
+    if (SituationCreateVirtualDisplay(resolution, 1.0, 0, SITUATION_SCALING_FIT, SITUATION_BLEND_ALPHA, &display_id) != SITUATION_SUCCESS) {
+        return result;
+    }
+    result.virtual_display_id = display_id;
+    if (free_slot >= 0) {
+        RGLRenderTargetSlot* slot = &RGL.render_targets[free_slot];
+        slot->occupied = true;
+        slot->display_id = display_id;
+        slot->width = width;
+        slot->height = height;
+        slot->in_use = true;
+        slot->released_time = 0.0;
     }
+    return result;
 }
 
 /**
- * @brief Resets the rendering target back to the main screen/window.
+ * @brief Returns a render texture to the pool. The display is hidden from compositing and kept for the
+ * next RGL_AcquireRenderTexture of the same size. Targets the pool does not own are destroyed.
  */
-SITAPI void RGL_ResetRenderTarget(void) {
-    _RGL_FlushBatch(); // RGL's responsibility.
-    RGL.active_virtual_display_id = -1;
+SITAPI void RGL_ReleaseRenderTexture(RGLTexture texture) {
+    if (texture.virtual_display_id < 0) return;
+    if (RGL.active_virtual_display_id == texture.virtual_display_id) RGL_ResetRenderTarget();
+
+    int index = _RGL_FindRenderTargetSlot(texture.virtual_display_id);
+    if (index < 0) {
+        SituationDestroyVirtualDisplay(texture.virtual_display_id);
+        return;
+    }
+    RGLRenderTargetSlot* slot = &RGL.render_targets[index];
+    if (!slot->in_use) return;
+    slot->in_use = false;
+    slot->released_time = SituationTimerGetTime();
+    _RGL_ConfigurePooledTarget(slot->display_id, false);
 }
 
 /**
- * @brief (INTERNAL HELPER) Generates and queues a 3D quad for Path segments.
- * This is now simplified to take a start and end offset from a centerline.
- *
- * @param center The 3D world-space center of the quad's near edge.
- * @param right_vec The normalized vector pointing to the "right" of the Path surface.
- * @param x_offset1 Offset from center for the first vertical edge.
- * @param x_offset2 Offset from center for the second vertical edge.
- * @param z_near World Z of the near edge.
- * @param z_far World Z of the far edge.
- * @param sprite The sprite to texture the quad with (id=0 for solid color).
- * @param color The solid color to use if not textured.
+ * @brief Destroys the released pooled targets that have been idle for longer than max_idle_seconds.
+ * RGL_Begin does this with RGL_RENDER_TARGET_IDLE_SECONDS; call it with 0 after a resolution change
+ * or level load to free every released target at once. Targets in use are never touched.
  */
-static void _RGL_Draw3DQuad(vec3 center, vec3 right_vec, float x_offset1, float x_offset2, float z_near, float z_far, RGLSprite sprite, Color color) {
-    if (RGL.command_count >= RGL.command_capacity) _RGL_FlushBatch();
-    RGLInternalDraw* cmd = &RGL.commands[RGL.command_count];
-
-    // Calculate the four 3D corner vertices
-    vec3 p_near1, p_near2, p_far1, p_far2;
-    glm_vec3_scale(right_vec, x_offset1, p_near1);
-    glm_vec3_add(center, p_near1, p_near1);
+SITAPI void RGL_TrimRenderTexturePool(double max_idle_seconds) {
+    double now = SituationTimerGetTime();
+    for (int i = 0; i < RGL_RENDER_TARGET_POOL_SIZE; i++) {
+        RGLRenderTargetSlot* slot = &RGL.render_targets[i];
+        if (!slot->occupied || slot->in_use) continue;
+        if (max_idle_seconds > 0.0 && now - slot->released_time <= max_idle_seconds) continue;
+        SituationDestroyVirtualDisplay(slot->display_id);
+        slot->occupied = false;
+    }
+}
 
-    glm_vec3_scale(right_vec, x_offset2, p_near2);
-    glm_vec3_add(center, p_near2, p_near2);
+/**
+ * @brief Enables dynamic resolution: RGL_UpdateDynamicResolution then hands out a world display sized
+ * to a scale of the main display that follows the frame time. Render the 3D world into it and the HUD
+ * into the main display as usual; Situation upscales the world display when it composites the virtual
+ * displays. Each scale step is a pooled target, so moving between scales re-creates nothing.
+ * @param settings The settings (copied), or NULL to go back to rendering the world at full size.
+ * @return True on success, false if the settings are out of range.
+ */
+SITAPI bool RGL_SetDynamicResolution(const RGLDynamicResolution* settings) {
+    if (!settings) {
+        if (RGL.dynamic_resolution.has_target) RGL_ReleaseRenderTexture(RGL.dynamic_resolution.target);
+        _RGL_DestroyDynamicResolutionQueries();
+        memset(&RGL.dynamic_resolution, 0, sizeof(RGL.dynamic_resolution));
+        return true;
+    }
+    if (settings->target_frame_ms <= 0.0f || settings->min_scale <= 0.0f || settings->max_scale > 1.0f ||
+        settings->min_scale > settings->max_scale || settings->scale_step < 0.0f || settings->headroom < 0.0f ||
+        settings->margin < 0.0f) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_INVALID_PARAM, "RGL_SetDynamicResolution: settings out of range.");
+        return false;
+    }
 
-    glm_vec3_copy(p_near1, p_far1); p_far1[2] = z_far;
-    glm_vec3_copy(p_near2, p_far2); p_far2[2] = z_far;
+    bool was_enabled = RGL.dynamic_resolution.enabled;
+    RGL.dynamic_resolution.settings = *settings;
+    if (RGL.dynamic_resolution.settings.adjust_interval_frames < 1) RGL.dynamic_resolution.settings.adjust_interval_frames = 1;
+    if (!was_enabled) {
+        RGL.dynamic_resolution.scale = settings->max_scale;
+        RGL.dynamic_resolution.average_frame_ms = 0.0f;
+        RGL.dynamic_resolution.frames_since_change = 0;
+        RGL.dynamic_resolution.work_ms = 0.0f;
+        RGL.dynamic_resolution.gpu_ms = 0.0f;
+        RGL.dynamic_resolution.gpu_ms_frame = 0;
+    }
+    if (!RGL.dynamic_resolution.gpu_queries_created) {
+        glGenQueries(RGL_PROFILE_GPU_LATENCY * RGL_DYNAMIC_RES_MAX_PASSES * 2, &RGL.dynamic_resolution.gpu_queries[0][0][0]);
+        RGL.dynamic_resolution.gpu_queries_created = true;
+    }
+    RGL.dynamic_resolution.scale = _RGL_QuantizeDynamicScale(RGL.dynamic_resolution.scale);
+    RGL.dynamic_resolution.enabled = true;
+    return true;
+}
 
-    cmd->texture = sprite.texture;
-    cmd->z_depth = z_near;
-    cmd->is_triangle = false;
+/**
+ * @brief Returns dynamic-resolution settings for 60 fps: scales from 1 down to 0.5 in steps of 0.05,
+ * adjusted at most every 30 frames, bilinear upscaling.
+ */
+SITAPI RGLDynamicResolution RGL_GetDefaultDynamicResolution(void) {
+    RGLDynamicResolution settings = {0};
+    settings.target_frame_ms = 1000.0f / 60.0f;
+    settings.min_scale = 0.5f;
+    settings.max_scale = 1.0f;
+    settings.scale_step = 0.05f;
+    settings.headroom = 0.15f;
+    settings.margin = 0.05f;
+    settings.adjust_interval_frames = 30;
+    settings.scaling_mode = SITUATION_SCALING_STRETCH;
+    return settings;
+}
 
-    // Top-Left, Bottom-Left, Bottom-Right, Top-Right (for RGL_DrawSpritePro compatibility)
-    glm_vec3_copy(p_near1, cmd->world_positions[0]);
-    glm_vec3_copy(p_far1,  cmd->world_positions[1]);
-    glm_vec3_copy(p_far2,  cmd->world_positions[2]);
+/**
+ * @brief Advances the dynamic-resolution controller by one frame. Call it once per frame, before the
+ * world's RGL_Begin, and pass the result to it.
+ *
+ * Rendered pixels go with the square of the scale, so the controller aims for
+ * scale * sqrt(target / average frame time). It lowers the scale only past the margin over target,
+ * raises it only past the headroom under it, and changes it at most every adjust_interval_frames.
+ *
+ * Do not feed it the vsync-bound frame time (SituationGetFrameTime() under vsync never drops below the
+ * refresh interval, so the scale could only ever go down). By default it uses the larger of the CPU time
+ * spent between RGL_Begin and RGL_End since the last call and the GPU time of those passes. The GPU time
+ * comes from the controller's own timestamp queries (the profiler need not be on) and is read back
+ * RGL_PROFILE_GPU_LATENCY frames late, so a GPU-bound frame still lowers the scale without a stall.
+ *
+ * @param frame_time_ms The last frame's work time, or 0 for the default input above.
+ * @return The virtual display to render the world into, or -1 (the main display) when dynamic
+ *         resolution is disabled or its target could not be created.
+ */
+SITAPI int RGL_UpdateDynamicResolution(float frame_time_ms) {
+    if (!RGL.dynamic_resolution.enabled) return -1;
+    const RGLDynamicResolution* settings = &RGL.dynamic_resolution.settings;
+    float work_ms = _RGL_GetDynamicResolutionWorkTime();
+    if (frame_time_ms <= 0.0f) frame_time_ms = work_ms;
+
+    // 1. --- Smooth the frame time (nothing to add before the first RGL_End) ---
+    if (frame_time_ms > 0.0f) {
+        if (RGL.dynamic_resolution.average_frame_ms <= 0.0f) RGL.dynamic_resolution.average_frame_ms = frame_time_ms;
+        else RGL.dynamic_resolution.average_frame_ms += (frame_time_ms - RGL.dynamic_resolution.average_frame_ms) * 0.1f;
+        RGL.dynamic_resolution.frames_since_change++;
+    }
+
+    // 2. --- Pick the scale ---
+    float scale = RGL.dynamic_resolution.scale;
+    float average = RGL.dynamic_resolution.average_frame_ms;
+    if (RGL.dynamic_resolution.frames_since_change >= settings->adjust_interval_frames && average > 0.0f) {
+        float next = _RGL_NextDynamicScale(settings, scale, average);
+        if (next != scale) {
+            scale = next;
+            RGL.dynamic_resolution.frames_since_change = 0;
+        }
+    }
+
+    // 3. --- Swap to the pooled target of that size (the main display may also have been resized) ---
+    int screen_w, screen_h;
+    SituationGetVirtualDisplaySize(-1, &screen_w, &screen_h);
+    int width = (int)((float)screen_w * scale + 0.5f);
+    int height = (int)((float)screen_h * scale + 0.5f);
+    if (width < 1) width = 1;
+    if (height < 1) height = 1;
+    RGL.dynamic_resolution.scale = scale;
+
+    if (RGL.dynamic_resolution.has_target) {
+        int current_w, current_h;
+        SituationGetVirtualDisplaySize(RGL.dynamic_resolution.target.virtual_display_id, &current_w, &current_h);
+        if (current_w == width && current_h == height) return RGL.dynamic_resolution.target.virtual_display_id;
+        RGL_ReleaseRenderTexture(RGL.dynamic_resolution.target);
+        RGL.dynamic_resolution.has_target = false;
+    }
+    RGLTexture target = RGL_AcquireRenderTexture(width, height);
+    if (target.virtual_display_id < 0) return -1;
+    SituationSetVirtualDisplayScalingMode(target.virtual_display_id, settings->scaling_mode);
+    RGL.dynamic_resolution.target = target;
+    RGL.dynamic_resolution.has_target = true;
+    return target.virtual_display_id;
+}
+
+/** @brief Returns the scale the world display is rendered at (1 when dynamic resolution is disabled). */
+SITAPI float RGL_GetDynamicResolutionScale(void) {
+    return RGL.dynamic_resolution.enabled ? RGL.dynamic_resolution.scale : 1.0f;
+}
+
+static int _RGL_FindRenderTargetSlot(int display_id) {
+    for (int i = 0; i < RGL_RENDER_TARGET_POOL_SIZE; i++) {
+        if (RGL.render_targets[i].occupied && RGL.render_targets[i].display_id == display_id) return i;
+    }
+    return -1;
+}
+
+static void _RGL_ConfigurePooledTarget(int display_id, bool visible) {
+    Vector2 origin = {0};
+    SituationConfigureVirtualDisplay(display_id, origin, 1.0f, 0, visible, 1.0, SITUATION_BLEND_ALPHA);
+    SituationSetVirtualDisplayScalingMode(display_id, SITUATION_SCALING_FIT);
+}
+
+static void _RGL_ShutdownRenderTargetPool(void) {
+    _RGL_DestroyDynamicResolutionQueries();
+    memset(&RGL.dynamic_resolution, 0, sizeof(RGL.dynamic_resolution));
+    for (int i = 0; i < RGL_RENDER_TARGET_POOL_SIZE; i++) {
+        if (RGL.render_targets[i].occupied) SituationDestroyVirtualDisplay(RGL.render_targets[i].display_id);
+    }
+    memset(RGL.render_targets, 0, sizeof(RGL.render_targets));
+}
+
+static float _RGL_QuantizeDynamicScale(float scale) {
+    const RGLDynamicResolution* settings = &RGL.dynamic_resolution.settings;
+    if (settings->scale_step > 0.0f) scale = roundf(scale / settings->scale_step) * settings->scale_step;
+    return glm_clamp(scale, settings->min_scale, settings->max_scale);
+}
+
+/**
+ * @brief (INTERNAL) One step of the dynamic-resolution controller.
+ * Between target * (1 - headroom) and target * (1 + margin) the scale holds, so frames that sit on
+ * target with a little jitter never ratchet it down.
+ */
+static float _RGL_NextDynamicScale(const RGLDynamicResolution* settings, float scale, float average_ms) {
+    bool over = average_ms > settings->target_frame_ms * (1.0f + settings->margin);
+    bool under = average_ms < settings->target_frame_ms * (1.0f - settings->headroom);
+    if (!over && !under) return scale;
+
+    float next = _RGL_QuantizeDynamicScale(scale * sqrtf(settings->target_frame_ms / average_ms));
+    // Rounding must not stall the controller one step short of where it is heading.
+    if (next == scale && settings->scale_step > 0.0f) next = _RGL_QuantizeDynamicScale(scale + (over ? -settings->scale_step : settings->scale_step));
+    return next;
+}
+
+/**
+ * @brief (INTERNAL) Returns and resets the work time summed by RGL_End since the last update, raised to
+ * the GPU time of the newest frame whose timestamps have come back. Neither includes the wait for vsync.
+ * Also closes the frame's query set and opens the next one.
+ */
+static float _RGL_GetDynamicResolutionWorkTime(void) {
+    float work_ms = RGL.dynamic_resolution.work_ms;
+    RGL.dynamic_resolution.work_ms = 0.0f;
+    if (!RGL.dynamic_resolution.gpu_queries_created) return work_ms;
+
+    // 1. --- Close the frame's set (a pass left open by a missing RGL_End is dropped) ---
+    int set = (int)(RGL.dynamic_resolution.frame_counter % RGL_PROFILE_GPU_LATENCY);
+    RGL.dynamic_resolution.gpu_pass_open = false;
+    if (RGL.dynamic_resolution.gpu_pass_count[set] > 0) RGL.dynamic_resolution.gpu_query_frame[set] = RGL.dynamic_resolution.frame_counter + 1;
+    RGL.dynamic_resolution.frame_counter++;
+
+    // 2. --- Pick up finished sets; the one the next frame reuses is given up on if still pending ---
+    int next = (int)(RGL.dynamic_resolution.frame_counter % RGL_PROFILE_GPU_LATENCY);
+    for (int i = 0; i < RGL_PROFILE_GPU_LATENCY; i++) _RGL_ResolveDynamicResolutionQueries(i, i == next);
+    RGL.dynamic_resolution.gpu_pass_count[next] = 0;
+    RGL.dynamic_resolution.gpu_query_frame[next] = 0;
+
+    // A GPU time older than the query window says nothing about the current load.
+    if (RGL.dynamic_resolution.gpu_ms_frame + RGL_PROFILE_GPU_LATENCY + 1 < RGL.dynamic_resolution.frame_counter) return work_ms;
+    return RGL.dynamic_resolution.gpu_ms > work_ms ? RGL.dynamic_resolution.gpu_ms : work_ms;
+}
+
+static void _RGL_DynamicResolutionBeginPass(void) {
+    if (!RGL.dynamic_resolution.enabled || !RGL.dynamic_resolution.gpu_queries_created) return;
+    int set = (int)(RGL.dynamic_resolution.frame_counter % RGL_PROFILE_GPU_LATENCY);
+    // Past the last pair, later passes re-issue its end timestamp instead (the gap between them is counted).
+    if (RGL.dynamic_resolution.gpu_pass_count[set] >= RGL_DYNAMIC_RES_MAX_PASSES) {
+        RGL.dynamic_resolution.gpu_pass_count[set]--;
+    } else {
+        glQueryCounter(RGL.dynamic_resolution.gpu_queries[set][RGL.dynamic_resolution.gpu_pass_count[set]][0], GL_TIMESTAMP);
+    }
+    RGL.dynamic_resolution.gpu_pass_open = true;
+}
+
+static void _RGL_DynamicResolutionEndPass(void) {
+    if (!RGL.dynamic_resolution.gpu_pass_open) return;
+    int set = (int)(RGL.dynamic_resolution.frame_counter % RGL_PROFILE_GPU_LATENCY);
+    glQueryCounter(RGL.dynamic_resolution.gpu_queries[set][RGL.dynamic_resolution.gpu_pass_count[set]][1], GL_TIMESTAMP);
+    RGL.dynamic_resolution.gpu_pass_count[set]++;
+    RGL.dynamic_resolution.gpu_pass_open = false;
+}
+
+/**
+ * @brief (INTERNAL) Sums a closed set's pass times into gpu_ms when it is newer than the one held.
+ * Timestamps complete in submission order, so once the last pass's end is available every pair is.
+ * @param discard_pending If the results are not ready yet, give up on them (the set is about to be reused).
+ */
+static void _RGL_ResolveDynamicResolutionQueries(int set, bool discard_pending) {
+    uint64_t tagged_frame = RGL.dynamic_resolution.gpu_query_frame[set];
+    if (tagged_frame == 0) return;
+    int pass_count = RGL.dynamic_resolution.gpu_pass_count[set];
+
+    GLint available = 0;
+    glGetQueryObjectiv(RGL.dynamic_resolution.gpu_queries[set][pass_count - 1][1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        if (discard_pending) RGL.dynamic_resolution.gpu_query_frame[set] = 0;
+        return;
+    }
+    RGL.dynamic_resolution.gpu_query_frame[set] = 0;
+    if (tagged_frame <= RGL.dynamic_resolution.gpu_ms_frame) return;
+
+    double total_ns = 0.0;
+    for (int i = 0; i < pass_count; i++) {
+        GLuint64 begin = 0, end = 0;
+        glGetQueryObjectui64v(RGL.dynamic_resolution.gpu_queries[set][i][0], GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(RGL.dynamic_resolution.gpu_queries[set][i][1], GL_QUERY_RESULT, &end);
+        if (end > begin) total_ns += (double)(end - begin);
+    }
+    RGL.dynamic_resolution.gpu_ms = (float)(total_ns * 1e-6);
+    RGL.dynamic_resolution.gpu_ms_frame = tagged_frame;
+}
+
+static void _RGL_DestroyDynamicResolutionQueries(void) {
+    if (!RGL.dynamic_resolution.gpu_queries_created) return;
+    glDeleteQueries(RGL_PROFILE_GPU_LATENCY * RGL_DYNAMIC_RES_MAX_PASSES * 2, &RGL.dynamic_resolution.gpu_queries[0][0][0]);
+    RGL.dynamic_resolution.gpu_queries_created = false;
+}
+
+/**
+ * @brief Sets the current rendering target to a specified render texture.
+ * All subsequent drawing operations will be directed to this texture instead of the screen.
+ *
+ * @param texture The render texture to set as the target.
+ */
+SITAPI void RGL_SetRenderTarget(RGLTexture texture) {
+    _RGL_FlushBatch(); // RGL is responsible for flushing its own batch!
+    if (texture.virtual_display_id >= 0) {
+        // Switch context to this virtual display.
+        // In Situation, this usually means RGL_Begin(id)
+        // But RGL_SetRenderTarget suggests switching mid-frame?
+        // Situation's Virtual Displays are composited later.
+        // If we want to draw TO it, we need to be in a render pass for it.
+        // This likely maps to ending current pass and beginning new one.
+        RGL.active_virtual_display_id = texture.virtual_display_id;
+        // Situation doesn't have a "SetRenderTarget" because it uses CommandBuffers.
+        // For compatibility, we update RGL state so next flush/draw goes to it?
+        // But without CommandBuffers, we can't change target easily in GL 3.3 style loop.
+        // We will update the state variable used by RGL_Begin logic.
+    }
+}
+
+/**
+ * @brief Resets the rendering target back to the main screen/window.
+ */
+SITAPI void RGL_ResetRenderTarget(void) {
+    _RGL_FlushBatch(); // RGL's responsibility.
+    RGL.active_virtual_display_id = -1;
+}
+
+/**
+ * @brief (INTERNAL HELPER) Generates and queues a 3D quad for Path segments.
+ * This is now simplified to take a start and end offset from a centerline.
+ *
+ * @param center The 3D world-space center of the quad's near edge.
+ * @param right_vec The normalized vector pointing to the "right" of the Path surface.
+ * @param x_offset1 Offset from center for the first vertical edge.
+ * @param x_offset2 Offset from center for the second vertical edge.
+ * @param z_near World Z of the near edge.
+ * @param z_far World Z of the far edge.
+ * @param sprite The sprite to texture the quad with (id=0 for solid color).
+ * @param color The solid color to use if not textured.
+ */
+static void _RGL_Draw3DQuad(vec3 center, vec3 right_vec, float x_offset1, float x_offset2, float z_near, float z_far, RGLSprite sprite, Color color) {
+    if (!_RGL_EnsureCommandCapacity(1)) return;
+    RGLInternalDraw* cmd = _RGL_PeekCommand();
+
+    // Calculate the four 3D corner vertices
+    vec3 p_near1, p_near2, p_far1, p_far2;
+    glm_vec3_scale(right_vec, x_offset1, p_near1);
+    glm_vec3_add(center, p_near1, p_near1);
+
+    glm_vec3_scale(right_vec, x_offset2, p_near2);
+    glm_vec3_add(center, p_near2, p_near2);
+
+    glm_vec3_copy(p_near1, p_far1); p_far1[2] = z_far;
+    glm_vec3_copy(p_near2, p_far2); p_far2[2] = z_far;
+
+    cmd->texture = sprite.texture;
+    cmd->z_depth = z_near;
+    cmd->is_triangle = false;
+
+    // Top-Left, Bottom-Left, Bottom-Right, Top-Right (for RGL_DrawSpritePro compatibility)
+    glm_vec3_copy(p_near1, cmd->world_positions[0]);
+    glm_vec3_copy(p_far1,  cmd->world_positions[1]);
+    glm_vec3_copy(p_far2,  cmd->world_positions[2]);
     glm_vec3_copy(p_near2, cmd->world_positions[3]);
 
     // Assign texture coordinates
@@ -2492,7 +5958,7 @@ static void _RGL_Draw3DQuad(vec3 center, vec3 right_vec, float x_offset1, float
         cmd->light_levels[v] = 1.0f; // Default full light for Path
     }
 
-    RGL.command_count++;
+    _RGL_CommitCommand();
 }
 
 SITAPI void RGL_DrawQuadPro(RGLTexture texture, SitRectangle source_rect, vec3 position, vec2 size, vec2 origin_pct, vec3 rotation_eul_deg, vec2 skew, Color colors[4], float light_levels[4]) {
@@ -2530,7 +5996,7 @@ SITAPI void RGL_DrawSpritePro(RGLSprite sprite, vec3 position, vec2 size, vec2 o
 
     // Get a pointer to the next available command slot in our batch queue.
     // NOTE: We do NOT increment the count here. We only increment it at the very end on success.
-    RGLInternalDraw* cmd = &RGL.commands[RGL.command_count];
+    RGLInternalDraw* cmd = _RGL_PeekCommand();
 
     // 2. --- Calculate Model and Rotation-Only Matrices (from your original code) ---
     mat4 model_matrix;
@@ -2608,7 +6074,7 @@ SITAPI void RGL_DrawSpritePro(RGLSprite sprite, vec3 position, vec2 size, vec2 o
 
     // 6. --- COMMIT THE COMMAND (THE MISSING PIECE) ---
     // Now that the command is fully populated, officially add it to the batch by incrementing the counter.
-    RGL.command_count++;
+    _RGL_CommitCommand();
 }
 
 /**
@@ -2736,7 +6202,7 @@ SITAPI void RGL_DrawLineEx(Vector2 start_pos, Vector2 end_pos, float thick, Colo
 
     // 3. --- Queue the Command Directly ---
     // Use the safe "populate-then-commit" pattern.
-    RGLInternalDraw* cmd = &RGL.commands[RGL.command_count];
+    RGLInternalDraw* cmd = _RGL_PeekCommand();
 
     cmd->texture.texture.slot_index = 0; // Untextured
     cmd->is_triangle = false;
@@ -2761,7 +6227,7 @@ SITAPI void RGL_DrawLineEx(Vector2 start_pos, Vector2 end_pos, float thick, Colo
     }
 
     // 5. --- Commit the Command ---
-    RGL.command_count++;
+    _RGL_CommitCommand();
 }
 
 /**
@@ -3455,6 +6921,253 @@ SITAPI Color RGL_ColorTVGhost(ColorYPQA color, float ghost_offset, float ghost_s
     return (Color){final_r, final_g, final_b, original_rgb.a};
 }
 
+/**
+ * @brief Applies the retro YPQ effects to everything drawn so far into the current target, on the GPU.
+ *
+ * The full-screen counterpart of RGL_ColorTVGhost, RGL_ColorCRTBloom, RGL_ColorTVNoise and
+ * RGL_ColorScanline, applied in that order, followed by RGL_ColorClosest palette quantization. The batch
+ * is flushed, the viewport is copied to a texture, and one full-screen triangle writes the filtered
+ * picture back. Call it just before RGL_End; anything drawn afterwards (a HUD, say) is left untouched.
+ *
+ * The YPQ conversions are tables baked from SituationColorToYPQ / SituationColorFromYPQ, so the pass
+ * matches the per-color functions to within the tables' filtering. The palette table is rebuilt only
+ * when the palette's contents change; its matching works on RGL_RETRO_PALETTE_LUT_SIZE levels per channel.
+ * @note Render-thread only.
+ */
+SITAPI void RGL_ApplyRetroEffects(const RGLRetroEffects* effects) {
+    if (!RGL.is_batching || !effects) return;
+    if (g_rgl_recording_list) {
+        _SituationSetWarning("RGL_ApplyRetroEffects is render-thread only; it cannot be recorded into a command list.");
+        return;
+    }
+    if (!RGL.retro.initialized && !_RGL_InitRetroEffects()) return;
+    bool use_palette = effects->palette && effects->palette_size > 0 && _RGL_UpdateRetroPalette(effects->palette, effects->palette_size);
+
+    // 1. --- Finish the picture and copy it ---
+    _RGL_FlushBatch();
+    RGL_BeginProfileZone("Retro Effects");
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    if (viewport[2] <= 0 || viewport[3] <= 0) { RGL_EndProfileZone(); return; }
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, RGL.retro.frame_texture);
+    if (RGL.retro.frame_width != viewport[2] || RGL.retro.frame_height != viewport[3]) {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, viewport[2], viewport[3], 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        RGL.retro.frame_width = viewport[2];
+        RGL.retro.frame_height = viewport[3];
+    }
+    glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, viewport[0], viewport[1], viewport[2], viewport[3]);
+
+    // 2. --- Parameters, normalized the way the CPU functions use them ---
+    float ghost_offset = fmodf(effects->ghost_offset, 1.0f);
+    if (ghost_offset < 0.0f) ghost_offset += 1.0f;
+    float ghost_strength = fmaxf(0.0f, fminf(1.0f, effects->ghost_strength));
+    float signal = 1.0f - fmaxf(0.0f, fminf(1.0f, effects->signal_loss));
+    vec4 channel_color = {0.0f, 0.0f, 0.0f, 0.0f};
+    if (signal < 1.0f) {
+        SituationConvertColorToVec4(SituationColorFromYPQ(RGL_YPQFromTVChannel(effects->tv_channel, signal)), channel_color);
+        channel_color[3] = 1.0f - signal;
+    }
+    float scanline_height = effects->scanline_height > 0.0f ? effects->scanline_height : 1.0f;
+
+    glUseProgram(RGL.retro.program);
+    glUniform1i(RGL.retro.loc_frame, 0);
+    glUniform1i(RGL.retro.loc_encode_lut, 1);
+    glUniform1i(RGL.retro.loc_decode_lut, 2);
+    glUniform1i(RGL.retro.loc_palette_lut, 3);
+    glUniform2f(RGL.retro.loc_lut_sizes, (float)RGL_RETRO_LUT_SIZE, (float)RGL_RETRO_PALETTE_LUT_SIZE);
+    glUniform4f(RGL.retro.loc_scanline, effects->scanline_intensity, scanline_height, effects->noise_strength, effects->bloom_strength);
+    glUniform4f(RGL.retro.loc_ghost, ghost_offset, ghost_strength, floorf(effects->ghost_shift), 0.0f);
+    glUniform4fv(RGL.retro.loc_signal, 1, channel_color);
+    glUniform1i(RGL.retro.loc_use_palette, use_palette ? 1 : 0);
+    glUniform2f(RGL.retro.loc_origin, (float)viewport[0], (float)viewport[1]);
+
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_3D, RGL.retro.encode_lut);
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_3D, RGL.retro.decode_lut);
+    glActiveTexture(GL_TEXTURE3);
+    glBindTexture(GL_TEXTURE_3D, RGL.retro.palette_lut);
+
+    // 3. --- One full-screen triangle over the viewport ---
+    GLboolean depth_test = glIsEnabled(GL_DEPTH_TEST);
+    GLboolean blend = glIsEnabled(GL_BLEND);
+    GLboolean cull = glIsEnabled(GL_CULL_FACE);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    glDisable(GL_CULL_FACE);
+    glBindVertexArray(RGL.fullscreen_quad_vao);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    RGL.stats.total_draw_calls++;
+
+    // 4. --- Restore what the batch expects ---
+    if (depth_test) glEnable(GL_DEPTH_TEST);
+    if (blend) glEnable(GL_BLEND);
+    if (cull) glEnable(GL_CULL_FACE);
+    for (int unit = 3; unit >= 1; unit--) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_3D, 0);
+    }
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindVertexArray(0);
+    glUseProgram(RGL.main_shader.gl_program_id);
+    RGL_EndProfileZone();
+}
+
+/**
+ * @brief Returns retro settings for a mild CRT look: light scanlines and phosphor bloom, a clean signal,
+ * and no noise, ghost or palette.
+ */
+SITAPI RGLRetroEffects RGL_GetDefaultRetroEffects(void) {
+    RGLRetroEffects effects = {0};
+    effects.scanline_intensity = 0.25f;
+    effects.scanline_height = 1.0f;
+    effects.bloom_strength = 0.1f;
+    return effects;
+}
+
+static GLuint _RGL_CreateLUT3D(int size, const uint8_t* texels, GLint filter, GLint wrap_s) {
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_3D, texture);
+    glTexImage3D(GL_TEXTURE_3D, 0, GL_RGBA8, size, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, texels);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, wrap_s);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_3D, 0);
+    return texture;
+}
+
+static bool _RGL_InitRetroEffects(void) {
+    // 1. --- Program ---
+    GLuint program = _RGL_CreateShaderProgram(RGL_SHADOW_DARKEN_VERTEX_SHADER, NULL, RGL_RETRO_FRAGMENT_SHADER);
+    if (!program) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_SHADER_COMPILATION_FAILED, "Failed to build the retro post-process shader.");
+        return false;
+    }
+    const int n = RGL_RETRO_LUT_SIZE;
+    uint8_t* texels = (uint8_t*)malloc((size_t)n * n * n * 4);
+    if (!texels) {
+        glDeleteProgram(program);
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate the retro lookup tables.");
+        return false;
+    }
+
+    // 2. --- RGB -> YPQ, with chroma stored as (cos, sin) * Q around 0.5 ---
+    for (int b = 0; b < n; b++) {
+        for (int g = 0; g < n; g++) {
+            for (int r = 0; r < n; r++) {
+                Color rgb = { (unsigned char)(r * 255 / (n - 1)), (unsigned char)(g * 255 / (n - 1)), (unsigned char)(b * 255 / (n - 1)), 255 };
+                ColorYPQA ypq = SituationColorToYPQ(rgb);
+                float angle = (float)ypq.p / 255.0f * 2.0f * (float)M_PI;
+                float chroma = (float)ypq.q / 255.0f;
+                uint8_t* texel = &texels[(((size_t)b * n + g) * n + r) * 4];
+                texel[0] = ypq.y;
+                texel[1] = (uint8_t)(127.5f + 127.5f * chroma * cosf(angle) + 0.5f);
+                texel[2] = (uint8_t)(127.5f + 127.5f * chroma * sinf(angle) + 0.5f);
+                texel[3] = 255;
+            }
+        }
+    }
+    RGL.retro.encode_lut = _RGL_CreateLUT3D(n, texels, GL_LINEAR, GL_CLAMP_TO_EDGE);
+
+    // 3. --- YPQ -> RGB, indexed (P, Y, Q); texel i of P is phase i / n so the axis tiles ---
+    for (int q = 0; q < n; q++) {
+        for (int y = 0; y < n; y++) {
+            for (int p = 0; p < n; p++) {
+                ColorYPQA ypq = { (unsigned char)(y * 255 / (n - 1)), (unsigned char)(p * 255 / n), (unsigned char)(q * 255 / (n - 1)), 255 };
+                Color rgb = SituationColorFromYPQ(ypq);
+                uint8_t* texel = &texels[(((size_t)q * n + y) * n + p) * 4];
+                texel[0] = rgb.r;
+                texel[1] = rgb.g;
+                texel[2] = rgb.b;
+                texel[3] = 255;
+            }
+        }
+    }
+    RGL.retro.decode_lut = _RGL_CreateLUT3D(n, texels, GL_LINEAR, GL_REPEAT);
+    free(texels);
+
+    // 4. --- Frame copy target and an empty palette table until a palette is given ---
+    const uint8_t black[4] = { 0, 0, 0, 255 };
+    RGL.retro.palette_lut = _RGL_CreateLUT3D(1, black, GL_NEAREST, GL_CLAMP_TO_EDGE);
+    glGenTextures(1, &RGL.retro.frame_texture);
+    glBindTexture(GL_TEXTURE_2D, RGL.retro.frame_texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    RGL.retro.program = program;
+    RGL.retro.loc_frame = glGetUniformLocation(program, "u_frame");
+    RGL.retro.loc_encode_lut = glGetUniformLocation(program, "u_encode_lut");
+    RGL.retro.loc_decode_lut = glGetUniformLocation(program, "u_decode_lut");
+    RGL.retro.loc_palette_lut = glGetUniformLocation(program, "u_palette_lut");
+    RGL.retro.loc_lut_sizes = glGetUniformLocation(program, "u_lut_sizes");
+    RGL.retro.loc_scanline = glGetUniformLocation(program, "u_scanline");
+    RGL.retro.loc_ghost = glGetUniformLocation(program, "u_ghost");
+    RGL.retro.loc_signal = glGetUniformLocation(program, "u_signal");
+    RGL.retro.loc_use_palette = glGetUniformLocation(program, "u_use_palette");
+    RGL.retro.loc_origin = glGetUniformLocation(program, "u_origin");
+    RGL.retro.frame_width = RGL.retro.frame_height = 0;
+    RGL.retro.palette_hash = 0;
+    RGL.retro.palette_size = 0;
+    RGL.retro.initialized = true;
+    return true;
+}
+
+static bool _RGL_UpdateRetroPalette(const Color* palette, int palette_size) {
+    // FNV-1a over the palette, so editing a palette in place is picked up too.
+    uint32_t hash = 2166136261u;
+    const uint8_t* bytes = (const uint8_t*)palette;
+    for (size_t i = 0; i < (size_t)palette_size * sizeof(Color); i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    if (RGL.retro.palette_size == palette_size && RGL.retro.palette_hash == hash) return true;
+
+    const int n = RGL_RETRO_PALETTE_LUT_SIZE;
+    uint8_t* texels = (uint8_t*)malloc((size_t)n * n * n * 4);
+    if (!texels) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate the retro palette table.");
+        return false;
+    }
+    for (int b = 0; b < n; b++) {
+        for (int g = 0; g < n; g++) {
+            for (int r = 0; r < n; r++) {
+                Color target = { (unsigned char)(r * 255 / (n - 1)), (unsigned char)(g * 255 / (n - 1)), (unsigned char)(b * 255 / (n - 1)), 255 };
+                Color match = RGL_ColorClosest(target, palette, palette_size);
+                uint8_t* texel = &texels[(((size_t)b * n + g) * n + r) * 4];
+                texel[0] = match.r;
+                texel[1] = match.g;
+                texel[2] = match.b;
+                texel[3] = 255;
+            }
+        }
+    }
+    glDeleteTextures(1, &RGL.retro.palette_lut);
+    RGL.retro.palette_lut = _RGL_CreateLUT3D(n, texels, GL_NEAREST, GL_CLAMP_TO_EDGE);
+    free(texels);
+    RGL.retro.palette_hash = hash;
+    RGL.retro.palette_size = palette_size;
+    return true;
+}
+
+static void _RGL_ShutdownRetroEffects(void) {
+    if (!RGL.retro.initialized) return;
+    glDeleteProgram(RGL.retro.program);
+    glDeleteTextures(1, &RGL.retro.frame_texture);
+    glDeleteTextures(1, &RGL.retro.encode_lut);
+    glDeleteTextures(1, &RGL.retro.decode_lut);
+    glDeleteTextures(1, &RGL.retro.palette_lut);
+    memset(&RGL.retro, 0, sizeof(RGL.retro));
+}
+
 /**
  * @brief Checks if two YPQ colors are equal within a given tolerance
  * @param color1 First YPQ color
@@ -3558,7 +7271,7 @@ SITAPI void RGL_DrawPolygon(vec2* points, int point_count, float z_depth, Color
     // Use a triangle fan approach to create individual triangles.
     for (int i = 0; i < triangles_to_create; i++) {
         // Use the safe "populate-then-commit" pattern.
-        RGLInternalDraw* cmd = &RGL.commands[RGL.command_count];
+        RGLInternalDraw* cmd = _RGL_PeekCommand();
 
         // --- Populate the Command ---
         cmd->is_triangle = true;
@@ -3582,7 +7295,7 @@ SITAPI void RGL_DrawPolygon(vec2* points, int point_count, float z_depth, Color
         }
 
         // --- Commit the Command ---
-        RGL.command_count++;
+        _RGL_CommitCommand();
     }
 }
 
@@ -3619,7 +7332,7 @@ SITAPI void RGL_DrawBillboard(RGLSprite sprite, vec3 world_pos, vec2 size, Color
     if (!RGL.is_batching) return;
     if (!_RGL_EnsureCommandCapacity(1)) return;
 
-    RGLInternalDraw* cmd = &RGL.commands[RGL.command_count++];
+    RGLInternalDraw* cmd = _RGL_PushCommand();
     cmd->texture = sprite.texture;
     cmd->z_depth = world_pos[2];
     cmd->is_triangle = false;
@@ -3680,9 +7393,9 @@ SITAPI void RGL_DrawBillboard(RGLSprite sprite, vec3 world_pos, vec2 size, Color
  */
 SITAPI void RGL_DrawBillboardCylindricalY(RGLSprite sprite, vec3 world_pos, vec2 size, Color tint) {
     if (!RGL.is_initialized || !RGL.is_batching) return;
-    if (RGL.command_count >= RGL.command_capacity) _RGL_FlushBatch();
+    if (!_RGL_EnsureCommandCapacity(1)) return;
 
-    RGLInternalDraw* cmd = &RGL.commands[RGL.command_count];
+    RGLInternalDraw* cmd = _RGL_PeekCommand();
     cmd->texture = sprite.texture;
     cmd->z_depth = world_pos[2];
     cmd->is_triangle = false;
@@ -3731,146 +7444,810 @@ SITAPI void RGL_DrawBillboardCylindricalY(RGLSprite sprite, vec3 world_pos, vec2
     SituationConvertColorToVec4(tint, tint_v4);
     for(int i=0; i<4; i++) {
         glm_vec4_copy(tint_v4, cmd->colors[i]);
+        glm_vec3_copy(direction_to_cam, cmd->normals[i]); // Lit facing the camera, like RGL_DrawBillboardCylindricalYInstanced
         cmd->light_levels[i] = 1.0f;
     }
 
-    RGL.command_count++;
+    _RGL_CommitCommand();
 }
 
-SITAPI void RGL_CastStencilShadowFromMesh(RGLMesh mesh, mat4 transform, const RGLShadowConfig* config) {
-    // 1. --- SANITY CHECKS ---
-    if (!RGL.is_batching || !config || mesh.id == 0 || !mesh.cpu_vertices || !mesh.cpu_indices) {
-        return;
-    }
+// --- Hardware Instancing ---
 
-    // 2. --- FIND THE LIGHT SOURCE ---
-    int light_id = config->light_id;
-    if (light_id <= 0 || light_id > RGL_MAX_LIGHTS || !RGL.lights[light_id - 1].is_active || RGL.lights[light_id - 1].type == RGL_LIGHT_TYPE_DIRECTIONAL) {
-        return;
+/**
+ * @brief (INTERNAL) Creates the VAO/VBO/IBO of an instancing copy in the batch vertex format.
+ */
+static bool _RGL_UploadInstanceGeometry(RGLInstanceGeometry* geometry, const RGLBatchVertex* vertices, int vertex_count, const uint32_t* indices, int index_count) {
+    glGenVertexArrays(1, &geometry->vao);
+    glGenBuffers(1, &geometry->vbo);
+    glGenBuffers(1, &geometry->ibo);
+    if (!geometry->vao || !geometry->vbo || !geometry->ibo) {
+        glDeleteVertexArrays(1, &geometry->vao);
+        glDeleteBuffers(1, &geometry->vbo);
+        glDeleteBuffers(1, &geometry->ibo);
+        geometry->vao = geometry->vbo = geometry->ibo = 0;
+        return false;
     }
-    RGLLight* light = &RGL.lights[light_id - 1];
-
-    _RGL_FlushBatch();
+    glBindBuffer(GL_ARRAY_BUFFER, geometry->vbo);
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)vertex_count * sizeof(RGLBatchVertex), vertices, GL_STATIC_DRAW);
+    _RGL_SetBatchVertexLayout(geometry->vao, geometry->vbo);
+    glBindVertexArray(geometry->vao);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry->ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)index_count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    geometry->vertex_count = vertex_count;
+    geometry->index_count = (GLsizei)index_count;
+    return true;
+}
 
-    // 3. --- SET UP STENCIL STATE ---
-    glEnable(GL_DEPTH_TEST);
-    glEnable(GL_STENCIL_TEST);
-    glDepthMask(GL_FALSE);
-    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
-    glDisable(GL_CULL_FACE);
-    glStencilFunc(GL_ALWAYS, 0, 0xFF);
-    glStencilMask(0xFF);
-    glStencilOpSeparate(GL_FRONT, GL_KEEP, GL_DECR_WRAP, GL_KEEP);
-    glStencilOpSeparate(GL_BACK, GL_KEEP, GL_INCR_WRAP, GL_KEEP);
-    glClear(GL_STENCIL_BUFFER_BIT);
+/**
+ * @brief (INTERNAL) Returns the instancing copy of a mesh, creating it from the mesh's CPU arrays on first use.
+ * situation.h does not expose a mesh's vertex buffer for a per-instance draw, so the main shader instances
+ * its own batch-format copy instead (the same format the cached level geometry uses). Copies are keyed
+ * by cpu_vertices, which every by-value copy of an RGLMesh shares.
+ */
+static int _RGL_GetInstanceGeometry(const RGLMesh* mesh) {
+    for (size_t i = 0; i < RGL.instancing.geometry_count; i++) {
+        const RGLInstanceGeometry* geometry = &RGL.instancing.geometry[i];
+        if (geometry->key == (const void*)mesh->cpu_vertices && geometry->vertex_count == mesh->vertex_count) return (int)i;
+    }
+
+    // 1. --- Make room ---
+    if (RGL.instancing.geometry_count >= RGL.instancing.geometry_capacity) {
+        size_t new_capacity = RGL.instancing.geometry_capacity == 0 ? 16 : RGL.instancing.geometry_capacity * 2;
+        RGLInstanceGeometry* new_geometry = realloc(RGL.instancing.geometry, sizeof(RGLInstanceGeometry) * new_capacity);
+        if (!new_geometry) {
+            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to grow instanced mesh table");
+            return -1;
+        }
+        RGL.instancing.geometry = new_geometry;
+        RGL.instancing.geometry_capacity = new_capacity;
+    }
 
-    // 4. --- GENERATE SHADOW GEOMETRY (The Brute-Force Method) ---
-    vec3* transformed_verts = (vec3*)malloc(mesh.vertex_count * sizeof(vec3));
-    if (!transformed_verts) { SIT_Log(SIT_LOG_ERROR, "Failed to allocate memory for transformed shadow verts."); return; }
+    // 2. --- Convert the CPU arrays to the batch vertex format (first use is mid-frame, so in frame scratch) ---
+    RGLFrameArenaMark scratch_mark = _RGL_FrameArenaMark();
+    RGLBatchVertex* vertices = (RGLBatchVertex*)_RGL_FrameAlloc(sizeof(RGLBatchVertex) * mesh->vertex_count);
+    if (!vertices) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate instanced mesh vertices");
+        return -1;
+    }
+    const vec3 up = {0.0f, 1.0f, 0.0f};
+    const vec2 no_uv = {0.0f, 0.0f};
+    const vec4 white = {1.0f, 1.0f, 1.0f, 1.0f};
+    for (int i = 0; i < mesh->vertex_count; i++) {
+        _RGL_PackBatchVertex(&vertices[i], mesh->cpu_vertices[i],
+                             mesh->cpu_normals ? mesh->cpu_normals[i] : up,
+                             mesh->cpu_texcoords ? mesh->cpu_texcoords[i] : no_uv, white, 1.0f);
+    }
+
+    // 3. --- Upload ---
+    RGLInstanceGeometry* geometry = &RGL.instancing.geometry[RGL.instancing.geometry_count];
+    memset(geometry, 0, sizeof(RGLInstanceGeometry));
+    geometry->key = (const void*)mesh->cpu_vertices;
+    bool ok = _RGL_UploadInstanceGeometry(geometry, vertices, mesh->vertex_count, mesh->cpu_indices, mesh->index_count);
+    _RGL_FrameArenaRewind(scratch_mark);
+    if (!ok) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_GENERAL, "Failed to create instanced mesh buffers");
+        return -1;
+    }
+    return (int)RGL.instancing.geometry_count++;
+}
+
+static void _RGL_ReleaseInstanceGeometry(const RGLMesh* mesh) {
+    if (!mesh->cpu_vertices) return;
+    for (size_t i = 0; i < RGL.instancing.geometry_count; i++) {
+        RGLInstanceGeometry* geometry = &RGL.instancing.geometry[i];
+        if (geometry->key != (const void*)mesh->cpu_vertices) continue;
+        glDeleteVertexArrays(1, &geometry->vao);
+        glDeleteBuffers(1, &geometry->vbo);
+        glDeleteBuffers(1, &geometry->ibo);
+        // Queued draws refer to geometry by index, so drop any that are still pending this flush.
+        for (size_t d = 0; d < RGL.instancing.draw_count; d++) {
+            if (RGL.instancing.draws[d].geometry == (int)i) RGL.instancing.draws[d].instance_count = 0;
+            else if (RGL.instancing.draws[d].geometry == (int)RGL.instancing.geometry_count - 1) RGL.instancing.draws[d].geometry = (int)i;
+        }
+        RGL.instancing.geometry[i] = RGL.instancing.geometry[--RGL.instancing.geometry_count];
+        return;
+    }
+}
 
-    for (int i = 0; i < mesh.vertex_count; i++) {
-        glm_mat4_mulv3(transform, mesh.cpu_vertices[i], 1.0f, transformed_verts[i]);
+/**
+ * @brief (INTERNAL) Queues an instanced draw for the next flush and reserves its instance slots.
+ * @return The first of instance_count slots to fill in, or NULL on allocation failure.
+ */
+static RGLInstanceData* _RGL_QueueInstancedDraw(int mode, int geometry, RGLTexture texture, const vec4 uv_rect, int instance_count, bool blend) {
+    // 1. --- Grow the per-flush arrays ---
+    if (RGL.instancing.draw_count >= RGL.instancing.draw_capacity) {
+        size_t new_capacity = RGL.instancing.draw_capacity == 0 ? 32 : RGL.instancing.draw_capacity * 2;
+        RGLInstancedDraw* new_draws = realloc(RGL.instancing.draws, sizeof(RGLInstancedDraw) * new_capacity);
+        if (!new_draws) {
+            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to grow instanced draw queue");
+            return NULL;
+        }
+        RGL.instancing.draws = new_draws;
+        RGL.instancing.draw_capacity = new_capacity;
+    }
+    size_t needed = RGL.instancing.instance_count + (size_t)instance_count;
+    if (needed > RGL.instancing.instance_capacity) {
+        size_t new_capacity = RGL.instancing.instance_capacity == 0 ? 1024 : RGL.instancing.instance_capacity;
+        while (new_capacity < needed) new_capacity *= 2;
+        RGLInstanceData* new_instances = realloc(RGL.instancing.instances, sizeof(RGLInstanceData) * new_capacity);
+        if (!new_instances) {
+            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to grow instance buffer");
+            return NULL;
+        }
+        RGL.instancing.instances = new_instances;
+        RGL.instancing.instance_capacity = new_capacity;
     }
 
-    // Allocate enough space for the sides of ALL triangles (worst-case scenario for non-closed meshes)
-    vec3* volume_verts = (vec3*)malloc(mesh.index_count * 2 * sizeof(vec3));
-    if (!volume_verts) { free(transformed_verts); SIT_Log(SIT_LOG_ERROR, "Failed to allocate memory for shadow volume."); return; }
-    int volume_vert_count = 0;
+    // 2. --- Record the draw ---
+    RGLInstancedDraw* draw = &RGL.instancing.draws[RGL.instancing.draw_count++];
+    draw->mode = mode;
+    draw->geometry = geometry;
+    draw->texture = texture;
+    glm_vec4_copy((float*)uv_rect, draw->uv_rect);
+    draw->first_instance = (uint32_t)RGL.instancing.instance_count;
+    draw->instance_count = (uint32_t)instance_count;
+    draw->blend = blend;
+    draw->draw_list = NULL;
+
+    RGLInstanceData* slots = &RGL.instancing.instances[RGL.instancing.instance_count];
+    RGL.instancing.instance_count = needed;
+    return slots;
+}
 
-    // Iterate through all triangles of the mesh
-    for (int i = 0; i < mesh.index_count; i += 3) {
-        vec3 v0; glm_vec3_copy(transformed_verts[mesh.cpu_indices[i]], v0);
-        vec3 v1; glm_vec3_copy(transformed_verts[mesh.cpu_indices[i+1]], v1);
-        vec3 v2; glm_vec3_copy(transformed_verts[mesh.cpu_indices[i+2]], v2);
+/**
+ * @brief (INTERNAL) Draws one pass of the instanced calls queued since the last flush.
+ * Runs inside _RGL_FlushBatch with the main shader's lighting already set up: the opaque pass right
+ * after the cached level geometry, the blended pass between the batch's opaque and alpha buckets.
+ * The opaque pass runs first and uploads all instances to the GPU in one buffer; each queued call is
+ * then one glDrawElementsInstanced (maps to SituationCmdDrawIndexed with instance_count on the
+ * command-buffer path). GPU roads are opaque; draw lists split their ranges between the passes.
+ * @param blended False for the opaque pass, true for the blended one.
+ */
+static void _RGL_DrawQueuedInstances(bool blended) {
+    // 1. --- Upload the frame's instances once ---
+    if (!blended) {
+        if (!RGL.instancing.instance_ssbo) glGenBuffers(1, &RGL.instancing.instance_ssbo);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, RGL.instancing.instance_ssbo);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, (GLsizeiptr)(RGL.instancing.instance_count * sizeof(RGLInstanceData)), RGL.instancing.instances, GL_STREAM_DRAW);
+        RGL.stats.bytes_uploaded += RGL.instancing.instance_count * sizeof(RGLInstanceData);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 10, RGL.instancing.instance_ssbo);
+    }
+
+    // 2. --- One instanced draw per call of this pass ---
+    for (size_t d = 0; d < RGL.instancing.draw_count; d++) {
+        const RGLInstancedDraw* draw = &RGL.instancing.draws[d];
+        if (draw->instance_count == 0) continue;
+        if (draw->draw_list) {
+            _RGL_ReplayDrawList(draw->draw_list, draw->first_instance, blended);
+            continue;
+        }
+        if (draw->mode == 3) {
+            if (!blended) _RGL_DrawQueuedGPURoad(draw);
+            continue;
+        }
+        if (draw->blend != blended) continue;
+        const RGLInstanceGeometry* geometry = draw->geometry < 0 ? &RGL.instancing.quad : &RGL.instancing.geometry[draw->geometry];
 
-        // Check if the triangle is front-facing with respect to the light
-        vec3 edge1, edge2;
-        glm_vec3_sub(v1, v0, edge1);
-        glm_vec3_sub(v2, v0, edge2);
+        uint32_t slot = draw->texture.texture.slot_index;
+        if (draw->blend) glEnable(GL_BLEND); else glDisable(GL_BLEND);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, slot);
+        glUniform1i(RGL.loc_use_texture, slot != 0);
+        glUniform1i(RGL.instancing.loc_mode, draw->mode);
+        glUniform1ui(RGL.instancing.loc_base, draw->first_instance);
+        glUniform4fv(RGL.instancing.loc_uv_rect, 1, draw->uv_rect);
 
-        vec3 normal;
-        glm_vec3_cross(edge1, edge2, normal);
+        glBindVertexArray(geometry->vao);
+        glDrawElementsInstanced(GL_TRIANGLES, geometry->index_count, GL_UNSIGNED_INT, (void*)0, (GLsizei)draw->instance_count);
+        RGL.stats.total_draw_calls++;
+        RGL.stats.total_vertices_drawn += (uint64_t)geometry->vertex_count * draw->instance_count;
+    }
 
-        vec3 light_dir_v0;
-        glm_vec3_sub(v0, light->position, light_dir_v0);
+    // 3. --- Back to plain batch vertices ---
+    glUniform1i(RGL.instancing.loc_mode, 0);
+}
 
-        if (glm_vec3_dot(normal, light_dir_v0) > 0) {
-            // If it is, extrude its three edges to form the side walls of the volume
-            vec3 ev0, ev1, ev2;
-            vec3 dir;
+/**
+ * @brief (INTERNAL) Draws the blended instanced calls between the batch's opaque and alpha buckets.
+ * They are depth-tested against the opaque world but write no depth, so their translucent texels
+ * cannot hide the batch's alpha geometry drawn after them.
+ * @param bindless True if the batch is drawing bindless; its uniform is switched off for the pass.
+ */
+static void _RGL_DrawBlendedInstancePass(bool bindless) {
+    if (bindless) glUniform1i(RGL.bindless.loc_enabled, 0);
+    glDepthMask(GL_FALSE);
+    _RGL_DrawQueuedInstances(true);
+    glDepthMask(GL_TRUE);
+    glBindVertexArray(RGL.batch_vao);
+    if (bindless) glUniform1i(RGL.bindless.loc_enabled, 1);
+}
 
-            // Extrude v0
-            glm_vec3_sub(v0, light->position, dir);
-            glm_vec3_normalize(dir);
-            glm_vec3_scale(dir, config->extrusion_length, dir);
-            glm_vec3_add(v0, dir, ev0);
+static void _RGL_ShutdownInstancing(void) {
+    for (size_t i = 0; i < RGL.instancing.geometry_count; i++) {
+        RGLInstanceGeometry* geometry = &RGL.instancing.geometry[i];
+        glDeleteVertexArrays(1, &geometry->vao);
+        glDeleteBuffers(1, &geometry->vbo);
+        glDeleteBuffers(1, &geometry->ibo);
+    }
+    if (RGL.instancing.quad.vao) {
+        glDeleteVertexArrays(1, &RGL.instancing.quad.vao);
+        glDeleteBuffers(1, &RGL.instancing.quad.vbo);
+        glDeleteBuffers(1, &RGL.instancing.quad.ibo);
+    }
+    if (RGL.instancing.instance_ssbo) glDeleteBuffers(1, &RGL.instancing.instance_ssbo);
+    if (RGL.instancing.road_vao) glDeleteVertexArrays(1, &RGL.instancing.road_vao);
+    free(RGL.instancing.geometry);
+    free(RGL.instancing.instances);
+    free(RGL.instancing.draws);
+    memset(&RGL.instancing, 0, sizeof(RGL.instancing));
+}
 
-            // Extrude v1
-            glm_vec3_sub(v1, light->position, dir);
-            glm_vec3_normalize(dir);
-            glm_vec3_scale(dir, config->extrusion_length, dir);
-            glm_vec3_add(v1, dir, ev1);
+/**
+ * @brief Draws many copies of a mesh with a single instanced draw call.
+ * Each instance has its own model matrix (and optional tint); the current RGL_SetTransform is applied
+ * on top. The mesh is shaded exactly like batched geometry, including clustered lighting. Instances
+ * are queued and drawn at the next flush: opaque ones after cached level geometry and before the
+ * sorted batch, translucent ones (texture or tints) after the batch's opaque bucket without writing
+ * depth. They are not depth-sorted among themselves, so prefer opaque textures and tints.
+ * @note The first instanced draw of a mesh uploads a batch-format copy of it, kept until RGL_DestroyMesh.
+ * @param mesh A mesh with CPU-side data (every loader and generator keeps it).
+ * @param texture Texture for all instances; a zeroed RGLTexture draws untextured.
+ * @param transforms instance_count model matrices.
+ * @param tints instance_count colors multiplied into each instance, or NULL for white.
+ */
+SITAPI void RGL_DrawMeshInstanced(RGLMesh mesh, RGLTexture texture, const mat4* transforms, const Color* tints, int instance_count) {
+    if (!RGL.is_batching || !transforms || instance_count <= 0) return;
+    if (g_rgl_recording_list) {
+        _SituationSetWarning("RGL_DrawMeshInstanced is render-thread only; it cannot be recorded into a command list.");
+        return;
+    }
+    if (!mesh.cpu_vertices || !mesh.cpu_indices || mesh.index_count < 3) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_INVALID_PARAM, "RGL_DrawMeshInstanced: mesh has no CPU-side geometry.");
+        return;
+    }
 
-            // Extrude v2
-            glm_vec3_sub(v2, light->position, dir);
-            glm_vec3_normalize(dir);
-            glm_vec3_scale(dir, config->extrusion_length, dir);
-            glm_vec3_add(v2, dir, ev2);
+    int geometry = _RGL_GetInstanceGeometry(&mesh);
+    if (geometry < 0) return;
 
-            // Add the three side quads (as 6 triangles)
-            glm_vec3_copy(v0, volume_verts[volume_vert_count++]); glm_vec3_copy(v1, volume_verts[volume_vert_count++]); glm_vec3_copy(ev0, volume_verts[volume_vert_count++]);
-            glm_vec3_copy(ev0, volume_verts[volume_vert_count++]); glm_vec3_copy(v1, volume_verts[volume_vert_count++]); glm_vec3_copy(ev1, volume_verts[volume_vert_count++]);
+    bool blend = texture.texture.slot_index != 0 && !texture.is_opaque;
+    for (int i = 0; tints && !blend && i < instance_count; i++) blend = tints[i].a < 255;
 
-            glm_vec3_copy(v1, volume_verts[volume_vert_count++]); glm_vec3_copy(v2, volume_verts[volume_vert_count++]); glm_vec3_copy(ev1, volume_verts[volume_vert_count++]);
-            glm_vec3_copy(ev1, volume_verts[volume_vert_count++]); glm_vec3_copy(v2, volume_verts[volume_vert_count++]); glm_vec3_copy(ev2, volume_verts[volume_vert_count++]);
+    const vec4 full_uv = {0.0f, 0.0f, 1.0f, 1.0f};
+    RGLInstanceData* slots = _RGL_QueueInstancedDraw(1, geometry, texture, full_uv, instance_count, blend);
+    if (!slots) return;
+    for (int i = 0; i < instance_count; i++) {
+        if (RGL.use_transform) glm_mat4_mul(RGL.transform, (vec4*)transforms[i], slots[i].model);
+        else glm_mat4_copy((vec4*)transforms[i], slots[i].model);
+        if (tints) SituationConvertColorToVec4(tints[i], slots[i].tint);
+        else glm_vec4_one(slots[i].tint);
+    }
+}
 
-            glm_vec3_copy(v2, volume_verts[volume_vert_count++]); glm_vec3_copy(v0, volume_verts[volume_vert_count++]); glm_vec3_copy(ev2, volume_verts[volume_vert_count++]);
-            glm_vec3_copy(ev2, volume_verts[volume_vert_count++]); glm_vec3_copy(v0, volume_verts[volume_vert_count++]); glm_vec3_copy(ev0, volume_verts[volume_vert_count++]);
-        }
+/**
+ * @brief (INTERNAL) Queues an instanced billboard draw; mode is 2 (spherical) or 4 (Y-locked).
+ * @param warning Reported when called while recording a command list.
+ */
+static void _RGL_DrawBillboardInstances(int mode, const char* warning, RGLSprite sprite, const vec3* positions, const vec2* sizes, const Color* tints, int instance_count) {
+    if (!RGL.is_batching || !positions || !sizes || instance_count <= 0) return;
+    if (g_rgl_recording_list) {
+        _SituationSetWarning(warning);
+        return;
     }
 
-    free(transformed_verts);
+    // 1. --- Shared unit quad (TL, BL, BR, TR, like every batch quad) ---
+    if (!RGL.instancing.quad.vao) {
+        static const uint32_t quad_indices[6] = { 0, 1, 2, 0, 2, 3 };
+        const vec3 corners[4] = { {-0.5f, 0.5f, 0.0f}, {-0.5f, -0.5f, 0.0f}, {0.5f, -0.5f, 0.0f}, {0.5f, 0.5f, 0.0f} };
+        const vec2 uvs[4] = { {0.0f, 0.0f}, {0.0f, 1.0f}, {1.0f, 1.0f}, {1.0f, 0.0f} };
+        const vec3 normal = {0.0f, 0.0f, 1.0f};
+        const vec4 white = {1.0f, 1.0f, 1.0f, 1.0f};
+        RGLBatchVertex quad[4];
+        for (int v = 0; v < 4; v++) _RGL_PackBatchVertex(&quad[v], corners[v], normal, uvs[v], white, 1.0f);
+        if (!_RGL_UploadInstanceGeometry(&RGL.instancing.quad, quad, 4, quad_indices, 6)) return;
+    }
 
-    // 5. --- RENDER THE VOLUME ---
-    if (volume_vert_count > 0) {
-        glUseProgram(RGL.shadow_volume_shader.gl_program_id);
-        glUniformMatrix4fv(RGL.loc_sv_view, 1, GL_FALSE, &RGL.current_view_matrix[0][0]);
-        glUniformMatrix4fv(RGL.loc_sv_projection, 1, GL_FALSE, &RGL.current_projection_matrix[0][0]);
+    // 2. --- Queue the draw with the sprite's source rectangle as a UV transform ---
+    float texture_width = sprite.texture.texture.width > 0 ? (float)sprite.texture.texture.width : 1.0f;
+    float texture_height = sprite.texture.texture.height > 0 ? (float)sprite.texture.texture.height : 1.0f;
+    vec4 uv_rect = { sprite.source_rect.x / texture_width, sprite.source_rect.y / texture_height,
+                     sprite.source_rect.width / texture_width, sprite.source_rect.height / texture_height };
 
-        glBindVertexArray(RGL.batch_vao);
-        glBindBuffer(GL_ARRAY_BUFFER, RGL.batch_vbo);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(vec3) * volume_vert_count, volume_verts, GL_DYNAMIC_DRAW);
+    bool blend = sprite.texture.texture.slot_index != 0 && !sprite.texture.is_opaque;
+    for (int i = 0; tints && !blend && i < instance_count; i++) blend = tints[i].a < 255;
 
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-        glEnableVertexAttribArray(0);
-        glDisableVertexAttribArray(1);
+    RGLInstanceData* slots = _RGL_QueueInstancedDraw(mode, -1, sprite.texture, uv_rect, instance_count, blend);
+    if (!slots) return;
 
-        glDrawArrays(GL_TRIANGLES, 0, volume_vert_count);
+    // 3. --- One center + size per instance ---
+    for (int i = 0; i < instance_count; i++) {
+        RGLInstanceData* slot = &slots[i];
+        glm_mat4_zero(slot->model);
+        slot->model[0][0] = sizes[i][0];
+        slot->model[0][1] = sizes[i][1];
+        if (RGL.use_transform) glm_mat4_mulv3(RGL.transform, (float*)positions[i], 1.0f, slot->model[3]);
+        else glm_vec3_copy((float*)positions[i], slot->model[3]);
+        slot->model[3][3] = 1.0f;
+        if (tints) SituationConvertColorToVec4(tints[i], slot->tint);
+        else glm_vec4_one(slot->tint);
     }
-    free(volume_verts);
+}
 
-    // 6. --- DARKEN SCENE and CLEANUP (same as before) ---
-    glDepthMask(GL_TRUE);
-    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+/**
+ * @brief Draws many camera-facing copies of a sprite with a single instanced draw call.
+ * The instanced equivalent of RGL_DrawBillboard for roadside trees, posts and crowds: the corners are
+ * expanded from the camera axes in the vertex shader, so the CPU only writes one record per instance.
+ * Instanced billboards are lit with a camera-facing normal (RGL_DrawBillboard samples the ground
+ * normal instead) and are drawn at the next flush without depth sorting, like RGL_DrawMeshInstanced.
+ * @param positions instance_count world-space centers.
+ * @param sizes instance_count width/height pairs.
+ * @param tints instance_count colors, or NULL for white.
+ */
+SITAPI void RGL_DrawBillboardInstanced(RGLSprite sprite, const vec3* positions, const vec2* sizes, const Color* tints, int instance_count) {
+    _RGL_DrawBillboardInstances(2, "RGL_DrawBillboardInstanced is render-thread only; it cannot be recorded into a command list.",
+                                sprite, positions, sizes, tints, instance_count);
+}
+
+/**
+ * @brief Draws many upright copies of a sprite that pivot on the world Y-axis, with a single instanced draw call.
+ * The instanced equivalent of RGL_DrawBillboardCylindricalY, with the same orientation and camera-facing
+ * lighting, so a sprite can move between the two without popping. Instances are queued like
+ * RGL_DrawBillboardInstanced and drawn at the next flush in the order given: opaque ones before the
+ * sorted batch, translucent ones (texture or tints) after its opaque bucket without writing depth.
+ * @param positions instance_count world-space centers.
+ * @param sizes instance_count width/height pairs.
+ * @param tints instance_count colors, or NULL for white.
+ */
+SITAPI void RGL_DrawBillboardCylindricalYInstanced(RGLSprite sprite, const vec3* positions, const vec2* sizes, const Color* tints, int instance_count) {
+    _RGL_DrawBillboardInstances(4, "RGL_DrawBillboardCylindricalYInstanced is render-thread only; it cannot be recorded into a command list.",
+                                sprite, positions, sizes, tints, instance_count);
+}
+
+// --- GPU Particle System ---
+
+static void _RGL_BindParticleBuffers(void) {
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 5, RGL.particles.position_ssbo);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 6, RGL.particles.velocity_ssbo);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 7, RGL.particles.burst_index_ssbo);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 8, RGL.particles.burst_ssbo);
+}
+
+static void _RGL_DrawParticleRange(uint64_t first, uint32_t count) {
+    uint32_t capacity = RGL.particles.capacity;
+    uint32_t start = (uint32_t)(first % capacity);
+    uint32_t head = (start + count > capacity) ? capacity - start : count;
+
+    glUniform1ui(RGL.particles.loc_draw_first, start);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)head);
+    RGL.stats.total_draw_calls++;
+    if (head < count) {
+        glUniform1ui(RGL.particles.loc_draw_first, 0);
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)(count - head));
+        RGL.stats.total_draw_calls++;
+    }
+    RGL.stats.total_vertices_drawn += (uint64_t)count * 4;
+}
+
+/**
+ * @brief Initializes the GPU particle system with a fixed pool of particles.
+ *
+ * All particle state lives in storage buffers and is emitted, integrated and drawn on the GPU,
+ * so the per-frame CPU cost depends only on the number of live bursts, not on particle count.
+ * Emitting more than the pool holds recycles the oldest particles. Calling this again
+ * re-creates the pool at the new size and discards every live particle.
+ * Must be called after RGL_Init().
+ *
+ * @param max_particles The size of the particle pool (1M+ is fine).
+ */
+SITAPI void RGL_InitParticles(size_t max_particles) {
+    if (!RGL.is_initialized) { _SituationSetErrorFromCode(SITUATION_ERROR_NOT_INITIALIZED, "RGL not initialized"); return; }
+    if (max_particles == 0 || max_particles > UINT32_MAX) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_INVALID_PARAM, "RGL_InitParticles: max_particles out of range.");
+        return;
+    }
+    if (RGL.particles.initialized) RGL_ShutdownParticles();
+
+    // 1. --- Compile the emit, simulate and draw programs ---
+    // RGL binds its own SSBOs with glBindBufferBase, so the compute layout only matters to Vulkan.
+    if (SituationCreateComputePipelineFromMemory(RGL_PARTICLE_EMIT_COMPUTE_SHADER, SIT_COMPUTE_LAYOUT_EMPTY, &RGL.particles.emit_pipeline) != SITUATION_SUCCESS ||
+        SituationCreateComputePipelineFromMemory(RGL_PARTICLE_SIMULATE_COMPUTE_SHADER, SIT_COMPUTE_LAYOUT_EMPTY, &RGL.particles.simulate_pipeline) != SITUATION_SUCCESS) {
+        SIT_Log(SIT_LOG_ERROR, "RGL: Failed to create particle compute pipelines.");
+        RGL_ShutdownParticles();
+        return;
+    }
+    RGL.particles.draw_program = _RGL_CreateShaderProgram(RGL_PARTICLE_VERTEX_SHADER, NULL, RGL_PARTICLE_FRAGMENT_SHADER);
+    if (RGL.particles.draw_program == 0) {
+        SIT_Log(SIT_LOG_ERROR, "RGL: Failed to create particle draw shader.");
+        RGL_ShutdownParticles();
+        return;
+    }
+
+    GLuint emit = RGL.particles.emit_pipeline.gl_program_id;
+    GLuint sim = RGL.particles.simulate_pipeline.gl_program_id;
+    GLuint draw = RGL.particles.draw_program;
+    RGL.particles.loc_emit_first = glGetUniformLocation(emit, "u_first");
+    RGL.particles.loc_emit_count = glGetUniformLocation(emit, "u_count");
+    RGL.particles.loc_emit_capacity = glGetUniformLocation(emit, "u_capacity");
+    RGL.particles.loc_emit_burst = glGetUniformLocation(emit, "u_burst");
+    RGL.particles.loc_emit_seed = glGetUniformLocation(emit, "u_seed");
+    RGL.particles.loc_sim_count = glGetUniformLocation(sim, "u_count");
+    RGL.particles.loc_sim_dt = glGetUniformLocation(sim, "u_dt");
+    RGL.particles.loc_draw_view = glGetUniformLocation(draw, "view");
+    RGL.particles.loc_draw_projection = glGetUniformLocation(draw, "projection");
+    RGL.particles.loc_draw_first = glGetUniformLocation(draw, "u_first");
+    RGL.particles.loc_draw_capacity = glGetUniformLocation(draw, "u_capacity");
+    RGL.particles.loc_draw_texture = glGetUniformLocation(draw, "texture0");
+
+    // 2. --- Allocate the SoA pool ---
+    size_t count = max_particles;
+    glGenBuffers(1, &RGL.particles.position_ssbo);
+    glGenBuffers(1, &RGL.particles.velocity_ssbo);
+    glGenBuffers(1, &RGL.particles.burst_index_ssbo);
+    glGenBuffers(1, &RGL.particles.burst_ssbo);
+    glGenVertexArrays(1, &RGL.particles.vao);
+
+    // Every slot starts long dead, so nothing is simulated or drawn before it is emitted into.
+    const float dead[4] = { 0.0f, 0.0f, 0.0f, FLT_MAX };
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, RGL.particles.position_ssbo);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(vec4) * count, NULL, GL_DYNAMIC_COPY);
+    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_RGBA32F, GL_RGBA, GL_FLOAT, dead);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, RGL.particles.velocity_ssbo);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(vec4) * count, NULL, GL_DYNAMIC_COPY);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, RGL.particles.burst_index_ssbo);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(uint32_t) * count, NULL, GL_DYNAMIC_COPY);
+    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, NULL);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, RGL.particles.burst_ssbo);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(RGLShaderParticleBurst) * RGL_MAX_PARTICLE_BURSTS, NULL, GL_DYNAMIC_DRAW);
+    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, NULL);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    RGL.particles.capacity = (uint32_t)count;
+    RGL.particles.emitted_total = 0;
+    RGL.particles.time = 0.0;
+    RGL.particles.seed = 0x2545F491u;
+    RGL.particles.next_burst = 0;
+    memset(RGL.particles.bursts, 0, sizeof(RGL.particles.bursts));
+    RGL.particles.initialized = true;
+}
+
+/**
+ * @brief Frees the particle pool and its GPU programs. Called by RGL_Shutdown().
+ */
+SITAPI void RGL_ShutdownParticles(void) {
+    if (RGL.particles.emit_pipeline.id) SituationDestroyComputePipeline(&RGL.particles.emit_pipeline);
+    if (RGL.particles.simulate_pipeline.id) SituationDestroyComputePipeline(&RGL.particles.simulate_pipeline);
+    if (RGL.particles.draw_program) glDeleteProgram(RGL.particles.draw_program);
+    if (RGL.particles.position_ssbo) glDeleteBuffers(1, &RGL.particles.position_ssbo);
+    if (RGL.particles.velocity_ssbo) glDeleteBuffers(1, &RGL.particles.velocity_ssbo);
+    if (RGL.particles.burst_index_ssbo) glDeleteBuffers(1, &RGL.particles.burst_index_ssbo);
+    if (RGL.particles.burst_ssbo) glDeleteBuffers(1, &RGL.particles.burst_ssbo);
+    if (RGL.particles.vao) glDeleteVertexArrays(1, &RGL.particles.vao);
+    memset(&RGL.particles, 0, sizeof(RGL.particles));
+}
+
+/**
+ * @brief Emits a burst of particles from an emitter descriptor.
+ *
+ * The burst holds `max_active` particles. They are written straight into the pool by one compute
+ * dispatch, with random velocities between the emitter's bounds. A `spawn_rate` above zero
+ * staggers them at that many particles per second; zero releases them all at once.
+ * The descriptor's gravity, lifetime and tint/size curves are fixed for the whole burst.
+ * Live particles look their burst up by slot, so a slot is only reused once its burst has expired;
+ * with all RGL_MAX_PARTICLE_BURSTS slots live the emit is dropped with a warning.
+ */
+SITAPI void RGL_EmitParticles(RGLParticleEmitter emitter) {
+    if (g_rgl_recording_list || !RGL.is_batching) return; // Issues GL work: render thread, inside a frame
+    if (!RGL.particles.initialized || emitter.max_active <= 0 || emitter.particle_lifetime <= 0.0f) return;
+
+    // 1. --- Claim a free (or expired) burst slot and a run of the pool ---
+    uint32_t count = (uint32_t)emitter.max_active;
+    if (count > RGL.particles.capacity) count = RGL.particles.capacity;
+
+    int burst_index = -1;
+    for (int i = 0; i < RGL_MAX_PARTICLE_BURSTS; i++) {
+        int candidate = (RGL.particles.next_burst + i) % RGL_MAX_PARTICLE_BURSTS;
+        const RGLParticleBurst* slot = &RGL.particles.bursts[candidate];
+        if (!slot->active || RGL.particles.time > slot->expire_time) {
+            burst_index = candidate;
+            break;
+        }
+    }
+    if (burst_index < 0) {
+        _SituationSetWarning("RGL_EmitParticles: every burst slot is still live; emit dropped.");
+        return;
+    }
+    RGL.particles.next_burst = (burst_index + 1) % RGL_MAX_PARTICLE_BURSTS;
+
+    RGLParticleBurst* burst = &RGL.particles.bursts[burst_index];
+    burst->active = true;
+    burst->first = RGL.particles.emitted_total;
+    burst->count = count;
+    burst->texture = emitter.base_sprite.texture;
+    float stagger = (emitter.spawn_rate > 0.0f) ? (float)(count - 1) / emitter.spawn_rate : 0.0f;
+    burst->expire_time = RGL.particles.time + stagger + emitter.particle_lifetime;
+    RGL.particles.emitted_total += count;
+
+    // 2. --- Upload the burst descriptor ---
+    RGLShaderParticleBurst gpu = {0};
+    glm_vec4(emitter.position, emitter.particle_lifetime, gpu.origin_lifetime);
+    glm_vec4(emitter.velocity_range_min, emitter.spawn_rate, gpu.velocity_min_rate);
+    glm_vec4(emitter.velocity_range_max, 0.0f, gpu.velocity_max);
+    glm_vec4(emitter.gravity_direction, 0.0f, gpu.gravity);
+    SituationConvertColorToVec4(emitter.tint_start, gpu.tint_start);
+    SituationConvertColorToVec4(emitter.tint_end, gpu.tint_end);
+    gpu.size[0] = emitter.size_start[0]; gpu.size[1] = emitter.size_start[1];
+    gpu.size[2] = emitter.size_end[0];   gpu.size[3] = emitter.size_end[1];
+
+    float tex_w = (float)emitter.base_sprite.texture.texture.width;
+    float tex_h = (float)emitter.base_sprite.texture.texture.height;
+    if (tex_w > 0.0f && tex_h > 0.0f) {
+        SitRectangle src = emitter.base_sprite.source_rect;
+        gpu.uv_rect[0] = src.x / tex_w;     gpu.uv_rect[1] = src.y / tex_h;
+        gpu.uv_rect[2] = src.width / tex_w; gpu.uv_rect[3] = src.height / tex_h;
+    } else {
+        gpu.uv_rect[2] = 1.0f; gpu.uv_rect[3] = 1.0f;
+    }
+
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, RGL.particles.burst_ssbo);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, sizeof(RGLShaderParticleBurst) * burst_index, sizeof(gpu), &gpu);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    // 3. --- Write the particles on the GPU ---
+    SituationCommandBuffer cmd = SituationGetMainCommandBuffer();
+    _RGL_BindParticleBuffers();
+    SituationCmdBindComputePipeline(cmd, RGL.particles.emit_pipeline);
+    glUniform1ui(RGL.particles.loc_emit_first, (GLuint)(burst->first % RGL.particles.capacity));
+    glUniform1ui(RGL.particles.loc_emit_count, count);
+    glUniform1ui(RGL.particles.loc_emit_capacity, RGL.particles.capacity);
+    glUniform1ui(RGL.particles.loc_emit_burst, (GLuint)burst_index);
+    RGL.particles.seed = RGL.particles.seed * 1664525u + 1013904223u;
+    glUniform1ui(RGL.particles.loc_emit_seed, RGL.particles.seed);
+    SituationCmdDispatch(cmd, (count + RGL_PARTICLE_WORKGROUP_SIZE - 1) / RGL_PARTICLE_WORKGROUP_SIZE, 1, 1);
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+    glUseProgram(RGL.main_shader.gl_program_id);
+}
+
+/**
+ * @brief Advances every particle by `delta_time` seconds in a single compute dispatch.
+ *
+ * Velocities integrate the burst's gravity_direction; tint and size over lifetime are evaluated
+ * at draw time from each particle's age. Expired bursts are retired here. When no burst is
+ * live the dispatch is skipped entirely.
+ * Render thread only, between RGL_Begin and RGL_End; otherwise it is ignored with a warning and
+ * the particle clock does not advance.
+ */
+SITAPI void RGL_UpdateParticles(float delta_time) {
+    if (g_rgl_recording_list) {
+        _SituationSetWarning("RGL_UpdateParticles is render-thread only; it cannot be recorded into a command list.");
+        return;
+    }
+    if (!RGL.is_batching) {
+        _SituationSetWarning("RGL_UpdateParticles called outside RGL_Begin/RGL_End; ignored.");
+        return;
+    }
+    if (!RGL.particles.initialized || delta_time <= 0.0f) return;
+    RGL.particles.time += delta_time;
+
+    bool any_active = false;
+    for (int i = 0; i < RGL_MAX_PARTICLE_BURSTS; i++) {
+        RGLParticleBurst* burst = &RGL.particles.bursts[i];
+        if (!burst->active) continue;
+        if (RGL.particles.time > burst->expire_time) { burst->active = false; continue; }
+        any_active = true;
+    }
+    if (!any_active) return;
+
+    SituationCommandBuffer cmd = SituationGetMainCommandBuffer();
+    _RGL_BindParticleBuffers();
+    SituationCmdBindComputePipeline(cmd, RGL.particles.simulate_pipeline);
+    glUniform1ui(RGL.particles.loc_sim_count, RGL.particles.capacity);
+    glUniform1f(RGL.particles.loc_sim_dt, delta_time);
+    SituationCmdDispatch(cmd, (RGL.particles.capacity + RGL_PARTICLE_WORKGROUP_SIZE - 1) / RGL_PARTICLE_WORKGROUP_SIZE, 1, 1);
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+    glUseProgram(RGL.main_shader.gl_program_id);
+}
+
+/**
+ * @brief Draws all live particles as camera-facing billboards, one instanced draw per burst.
+ *
+ * Flushes the batch first so particles keep their place in the draw order. Particles are
+ * alpha blended without depth writes and are not sorted.
+ * Render thread only; it is ignored with a warning while a command list is being recorded.
+ */
+SITAPI void RGL_DrawParticles(void) {
+    if (!RGL.is_batching) return;
+    if (g_rgl_recording_list) {
+        _SituationSetWarning("RGL_DrawParticles is render-thread only; it cannot be recorded into a command list.");
+        return;
+    }
+    if (!RGL.particles.initialized) return;
+
+    _RGL_FlushBatch();
+
+    // 1. --- Set up state for unsorted transparent billboards ---
+    glEnable(GL_DEPTH_TEST);
+    glDepthMask(GL_FALSE);
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glDisable(GL_CULL_FACE);
 
-    glStencilFunc(GL_NOTEQUAL, 0, 0xFF);
-    glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
-    glStencilMask(0x00);
+    glUseProgram(RGL.particles.draw_program);
+    glUniformMatrix4fv(RGL.particles.loc_draw_view, 1, GL_FALSE, &RGL.current_view_matrix[0][0]);
+    glUniformMatrix4fv(RGL.particles.loc_draw_projection, 1, GL_FALSE, &RGL.current_projection_matrix[0][0]);
+    glUniform1ui(RGL.particles.loc_draw_capacity, RGL.particles.capacity);
+    glUniform1i(RGL.particles.loc_draw_texture, 0);
+    _RGL_BindParticleBuffers();
+    glBindVertexArray(RGL.particles.vao);
+    glActiveTexture(GL_TEXTURE0);
 
-    glUseProgram(RGL.shadow_darken_shader.gl_program_id);
-    glUniform4f(RGL.loc_sd_shadow_color, config->color.r/255.f, config->color.g/255.f, config->color.b/255.f, config->color.a/255.f);
+    // 2. --- One draw per live burst ---
+    // Later bursts overwrite the oldest pool slots, so only the part of a burst that is still
+    // inside the last `capacity` emissions belongs to it.
+    uint64_t window_start = (RGL.particles.emitted_total > RGL.particles.capacity) ? RGL.particles.emitted_total - RGL.particles.capacity : 0;
+    for (int i = 0; i < RGL_MAX_PARTICLE_BURSTS; i++) {
+        const RGLParticleBurst* burst = &RGL.particles.bursts[i];
+        if (!burst->active) continue;
+        uint64_t end = burst->first + burst->count;
+        if (end <= window_start) continue;
+        uint64_t first = (burst->first > window_start) ? burst->first : window_start;
 
-    glBindVertexArray(RGL.fullscreen_quad_vao);
-    glDisable(GL_DEPTH_TEST);
-    glDrawArrays(GL_TRIANGLES, 0, 3);
+        glBindTexture(GL_TEXTURE_2D, burst->texture.texture.slot_index);
+        _RGL_DrawParticleRange(first, (uint32_t)(end - first));
+    }
+
+    // 3. --- Restore the batch renderer's state ---
+    glBindVertexArray(0);
+    glDepthMask(GL_TRUE);
+    glEnable(GL_CULL_FACE);
+    glUseProgram(RGL.main_shader.gl_program_id);
+}
+
+
+/**
+ * @brief Opens a stencil shadow pass shared by any number of casters.
+ *
+ * Flushes the batch, clears the stencil once and switches to stencil-only writes. Every
+ * RGL_CastStencilShadowFromMesh call until RGL_EndStencilShadows adds its volume to the same
+ * stencil, and the scene is darkened once at the end instead of once per caster.
+ * Other draws queued inside the pass are batched as usual and flushed after it closes.
+ * The pass is profiled as one "Stencil Shadows" zone, so zones opened inside it must close before it does.
+ *
+ * @param config Supplies the darken color for the whole pass; per-cast configs only pick the light.
+ */
+SITAPI void RGL_BeginStencilShadows(const RGLShadowConfig* config) {
+    if (!RGL.is_batching || !config || RGL.stencil_pass.active) return;
+
+    _RGL_FlushBatch();
+
+    // Depth-pass (z-pass) volume counting: front faces decrement, back faces increment.
     glEnable(GL_DEPTH_TEST);
+    glEnable(GL_STENCIL_TEST);
+    glDepthMask(GL_FALSE);
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    glDisable(GL_CULL_FACE);
+    glStencilFunc(GL_ALWAYS, 0, 0xFF);
+    glStencilMask(0xFF);
+    glStencilOpSeparate(GL_FRONT, GL_KEEP, GL_DECR_WRAP, GL_KEEP);
+    glStencilOpSeparate(GL_BACK, GL_KEEP, GL_INCR_WRAP, GL_KEEP);
+    glClear(GL_STENCIL_BUFFER_BIT);
+
+    RGL.stencil_pass.active = true;
+    RGL.stencil_pass.color = config->color;
+    RGL.stencil_pass.caster_count = 0;
+    RGL_BeginProfileZone("Stencil Shadows");
+}
+
+/**
+ * @brief Closes the stencil shadow pass: one darken pass over every stenciled pixel, then restores state.
+ */
+SITAPI void RGL_EndStencilShadows(void) {
+    if (!RGL.stencil_pass.active) return;
+    RGL.stencil_pass.active = false;
+
+    glDepthMask(GL_TRUE);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+    if (RGL.stencil_pass.caster_count > 0) {
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        glStencilFunc(GL_NOTEQUAL, 0, 0xFF);
+        glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
+        glStencilMask(0x00);
 
+        Color c = RGL.stencil_pass.color;
+        glUseProgram(RGL.shadow_darken_shader.gl_program_id);
+        glUniform4f(RGL.loc_sd_shadow_color, c.r/255.f, c.g/255.f, c.b/255.f, c.a/255.f);
+
+        glBindVertexArray(RGL.fullscreen_quad_vao);
+        glDisable(GL_DEPTH_TEST);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        glEnable(GL_DEPTH_TEST);
+        RGL.stats.total_draw_calls++;
+    }
+
+    glStencilMask(0xFF);
     glDisable(GL_STENCIL_TEST);
     glDisable(GL_BLEND);
     glEnable(GL_CULL_FACE);
+    glBindVertexArray(0);
     glUseProgram(RGL.main_shader.gl_program_id);
+    RGL_EndProfileZone();
+}
+
+/**
+ * @brief Casts a stencil shadow volume from a mesh, extruding its silhouette on the GPU.
+ *
+ * Meshes from the loaders and generators carry cached adjacency and shadow buffers, so a cast is
+ * one indexed draw with no CPU work per triangle. Temporary meshes (such as the quad built by
+ * RGL_DrawSpriteWithShadow) have their adjacency built into a scratch buffer and streamed.
+ * Inside RGL_BeginStencilShadows/RGL_EndStencilShadows only the volume is drawn; outside, the call
+ * opens and closes a one-caster pass itself, darkening with config->color.
+ */
+SITAPI void RGL_CastStencilShadowFromMesh(RGLMesh mesh, mat4 transform, const RGLShadowConfig* config) {
+    // 1. --- SANITY CHECKS ---
+    if (!RGL.is_batching || !config || mesh.id == 0 || !mesh.cpu_vertices || !mesh.cpu_indices || mesh.index_count < 3) {
+        return;
+    }
+    if (RGL.shadow_volume_program == 0) return;
+
+    // 2. --- FIND THE LIGHT SOURCE ---
+    int light_id = config->light_id;
+    if (light_id <= 0 || light_id > RGL_MAX_LIGHTS || !RGL.lights[light_id - 1].is_active || RGL.lights[light_id - 1].type == RGL_LIGHT_TYPE_DIRECTIONAL) {
+        return;
+    }
+    RGLLight* light = &RGL.lights[light_id - 1];
+
+    // 3. --- OPEN A ONE-CASTER PASS IF THE CALLER DID NOT ---
+    bool implicit_pass = !RGL.stencil_pass.active;
+    if (implicit_pass) RGL_BeginStencilShadows(config);
+
+    // 4. --- SELECT THE ADJACENCY SOURCE ---
+    size_t adjacency_count = (size_t)(mesh.index_count / 3) * 6;
+    GLuint vao = mesh.shadow_vao;
+    if (vao == 0) {
+        if (adjacency_count > RGL.shadow_scratch_capacity) {
+            size_t new_capacity = RGL.shadow_scratch_capacity ? RGL.shadow_scratch_capacity : 64;
+            while (new_capacity < adjacency_count) new_capacity *= 2;
+            unsigned int* new_scratch = (unsigned int*)realloc(RGL.shadow_scratch_adjacency, sizeof(unsigned int) * new_capacity);
+            if (!new_scratch) {
+                _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to grow shadow adjacency scratch buffer.");
+                if (implicit_pass) RGL_EndStencilShadows();
+                return;
+            }
+            RGL.shadow_scratch_adjacency = new_scratch;
+            RGL.shadow_scratch_capacity = new_capacity;
+            RGL.stats.memory_reallocations++;
+        }
+        if (!_RGL_BuildMeshAdjacency(mesh.cpu_vertices, mesh.vertex_count, mesh.cpu_indices, mesh.index_count, RGL.shadow_scratch_adjacency)) {
+            if (implicit_pass) RGL_EndStencilShadows();
+            return;
+        }
+        glBindVertexArray(RGL.shadow_stream_vao);
+        glBindBuffer(GL_ARRAY_BUFFER, RGL.shadow_stream_vbo);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vec3) * mesh.vertex_count, mesh.cpu_vertices, GL_STREAM_DRAW);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * adjacency_count, RGL.shadow_scratch_adjacency, GL_STREAM_DRAW);
+        vao = RGL.shadow_stream_vao;
+    }
+
+    // 5. --- EXTRUDE THE SILHOUETTE IN THE GEOMETRY SHADER ---
+    glUseProgram(RGL.shadow_volume_program);
+    glUniformMatrix4fv(RGL.loc_sv_view, 1, GL_FALSE, &RGL.current_view_matrix[0][0]);
+    glUniformMatrix4fv(RGL.loc_sv_projection, 1, GL_FALSE, &RGL.current_projection_matrix[0][0]);
+    glUniformMatrix4fv(RGL.loc_sv_model, 1, GL_FALSE, &transform[0][0]);
+    glUniform3fv(RGL.loc_sv_light_pos, 1, light->position);
+    glUniform1f(RGL.loc_sv_extrusion_length, config->extrusion_length);
+
+    glBindVertexArray(vao);
+    glDrawElements(GL_TRIANGLES_ADJACENCY, (GLsizei)adjacency_count, GL_UNSIGNED_INT, (void*)0);
+
+    RGL.stencil_pass.caster_count++;
+    RGL.stats.stencil_volumes_drawn++;
+    RGL.stats.total_draw_calls++;
+
+    // 6. --- DARKEN AND RESTORE IF THIS CALL OWNS THE PASS ---
+    if (implicit_pass) RGL_EndStencilShadows();
 }
 
 /**
@@ -4057,42 +8434,21 @@ SITAPI void RGL_DrawSpriteDownwardShadow(RGLSprite sprite, vec3 world_pos, vec2
         p4[0], p4[1], p4[2],  u1, v1  // Top-left
     };
 
-    unsigned int indices[] = { 0, 1, 2, 0, 2, 3 };
-
-    // This part can be optimized by adding to a temporary batch instead of glBufferData every time.
-    // But for simplicity, this immediate-mode style is fine.
-    glBindVertexArray(RGL.batch_vao);
-    glBindBuffer(GL_ARRAY_BUFFER, RGL.batch_vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
-
-    // We only need position and texcoord for the shadow shader
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glDisableVertexAttribArray(2);
-    glDisableVertexAttribArray(3);
-    glDisableVertexAttribArray(4);
-
-    // Create and use an index buffer for this single draw
-    GLuint ibo;
-    glGenBuffers(1, &ibo);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+    // The shadow's own VAO holds the position + texcoord layout the shadow shader reads and a
+    // static quad index buffer, so no index buffer is created (or unbound from another VAO) per call.
+    glBindVertexArray(RGL.blob_shadow_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, RGL.blob_shadow_vbo);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
 
     glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
 
-    glDeleteBuffers(1, &ibo); // Clean up
-
     // --- Step 7: Restore state ---
-    _RGL_FlushBatch(); // Clear out any remaining state changes
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
     glDisable(GL_POLYGON_OFFSET_FILL);
     glDisable(GL_BLEND);
     glDepthMask(GL_TRUE);
     glUseProgram(RGL.main_shader.gl_program_id);
-    // Re-enable all attributes for the main shader
-    glEnableVertexAttribArray(0); glEnableVertexAttribArray(1); glEnableVertexAttribArray(2);
-    glEnableVertexAttribArray(3); glEnableVertexAttribArray(4);
 }
 
 SITAPI void RGL_GetViewMatrix(mat4 out_view) {
@@ -4196,6 +8552,276 @@ static bool _RGL_FrustumIntersectsSphere(const vec4 frustum_planes[6], vec3 sphe
     return true;
 }
 
+/**
+ * @brief Checks if an axis-aligned bounding box intersects with the view frustum.
+ * Conservative: for each plane only the box corner furthest along the plane normal is tested.
+ * @param frustum_planes The 6 planes of the frustum.
+ * @param box_min The world-space minimum corner of the box.
+ * @param box_max The world-space maximum corner of the box.
+ * @return True if the box is inside or intersecting the frustum, false if it's completely outside.
+ */
+static bool _RGL_FrustumIntersectsAABB(const vec4 frustum_planes[6], const vec3 box_min, const vec3 box_max) {
+    for (int i = 0; i < 6; i++) {
+        const float* p = frustum_planes[i];
+        float x = (p[0] >= 0.0f) ? box_max[0] : box_min[0];
+        float y = (p[1] >= 0.0f) ? box_max[1] : box_min[1];
+        float z = (p[2] >= 0.0f) ? box_max[2] : box_min[2];
+        if (p[0] * x + p[1] * y + p[2] * z + p[3] < 0.0f) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief (INTERNAL) Maps a view-space depth to its cluster depth slice.
+ * Slices are spaced logarithmically between RGL_DEFAULT_NEAR_PLANE and RGL_DEFAULT_FAR_PLANE, and
+ * depths outside that range clamp to the first/last slice, matching RGL_FRAGMENT_SHADER.
+ * @param view_depth Distance in front of the camera along the view axis.
+ * @return The slice index in [0, RGL_CLUSTER_GRID_Z).
+ */
+static int _RGL_LightClusterSlice(float view_depth) {
+    float slice = logf(fmaxf(view_depth, 0.0001f)) * RGL.light_clusters.z_scale + RGL.light_clusters.z_bias;
+    if (slice <= 0.0f) return 0;
+    if (slice >= (float)(RGL_CLUSTER_GRID_Z - 1)) return RGL_CLUSTER_GRID_Z - 1;
+    return (int)slice;
+}
+
+/**
+ * @brief (INTERNAL) Finds the range of clusters overlapped by a point or spot light's bounding sphere.
+ *
+ * The sphere's view-space bounding box is projected with the current projection matrix; if any
+ * corner lies behind the camera the light conservatively covers every screen tile.
+ *
+ * @param light The light to bin.
+ * @param out_bounds Receives the inclusive cluster range.
+ * @return True if the light touches at least one cluster, false if it is off screen.
+ */
+static bool _RGL_ComputeLightClusterBounds(const RGLLight* light, RGLLightClusterBounds* out_bounds) {
+    vec4 center;
+    glm_mat4_mulv(RGL.current_view_matrix, (vec4){light->position[0], light->position[1], light->position[2], 1.0f}, center);
+    float r = light->radius;
+
+    // 1. --- Depth Range ---
+    float depth_near = -center[2] - r;
+    float depth_far = -center[2] + r;
+    if (depth_far <= 0.0f) return false; // Entirely behind the camera
+    out_bounds->min_z = (int16_t)_RGL_LightClusterSlice(depth_near);
+    out_bounds->max_z = (int16_t)_RGL_LightClusterSlice(depth_far);
+
+    // 2. --- Screen Tile Range ---
+    float ndc_min[2] = { 1.0f, 1.0f }, ndc_max[2] = { -1.0f, -1.0f };
+    bool covers_screen = false;
+    for (int corner = 0; corner < 8 && !covers_screen; corner++) {
+        vec4 view_corner = {
+            center[0] + ((corner & 1) ? r : -r),
+            center[1] + ((corner & 2) ? r : -r),
+            center[2] + ((corner & 4) ? r : -r),
+            1.0f
+        };
+        vec4 clip;
+        glm_mat4_mulv(RGL.current_projection_matrix, view_corner, clip);
+        if (clip[3] <= 0.0001f) { covers_screen = true; break; }
+        for (int axis = 0; axis < 2; axis++) {
+            float ndc = clip[axis] / clip[3];
+            ndc_min[axis] = fminf(ndc_min[axis], ndc);
+            ndc_max[axis] = fmaxf(ndc_max[axis], ndc);
+        }
+    }
+
+    if (covers_screen) {
+        out_bounds->min_x = 0; out_bounds->max_x = RGL_CLUSTER_GRID_X - 1;
+        out_bounds->min_y = 0; out_bounds->max_y = RGL_CLUSTER_GRID_Y - 1;
+        return true;
+    }
+    if (ndc_max[0] < -1.0f || ndc_min[0] > 1.0f || ndc_max[1] < -1.0f || ndc_min[1] > 1.0f) return false;
+
+    // NDC -> tile, clamped to the grid. Tiles are laid out from the viewport origin (bottom-left),
+    // like gl_FragCoord.
+    const int dims[2] = { RGL_CLUSTER_GRID_X, RGL_CLUSTER_GRID_Y };
+    int tile_min[2], tile_max[2];
+    for (int axis = 0; axis < 2; axis++) {
+        tile_min[axis] = (int)floorf((ndc_min[axis] * 0.5f + 0.5f) * dims[axis]);
+        tile_max[axis] = (int)floorf((ndc_max[axis] * 0.5f + 0.5f) * dims[axis]);
+        tile_min[axis] = (tile_min[axis] < 0) ? 0 : (tile_min[axis] >= dims[axis] ? dims[axis] - 1 : tile_min[axis]);
+        tile_max[axis] = (tile_max[axis] < 0) ? 0 : (tile_max[axis] >= dims[axis] ? dims[axis] - 1 : tile_max[axis]);
+    }
+    out_bounds->min_x = (int16_t)tile_min[0]; out_bounds->max_x = (int16_t)tile_max[0];
+    out_bounds->min_y = (int16_t)tile_min[1]; out_bounds->max_y = (int16_t)tile_max[1];
+    return true;
+}
+
+/**
+ * @brief (INTERNAL) Converts a light into the layout read by RGL_FRAGMENT_SHADER.
+ * @param light The light to convert.
+ * @param out_light Receives the packed light.
+ */
+static void _RGL_PackShaderLight(const RGLLight* light, RGLShaderLight* out_light) {
+    memset(out_light, 0, sizeof(RGLShaderLight));
+    SituationConvertColorToVec4(light->color, out_light->color_intensity);
+    out_light->color_intensity[3] = light->intensity;
+    glm_vec3_to_vec4(light->position, (float)light->type, out_light->pos_type);
+    glm_vec3_to_vec4(light->direction, 0.0f, out_light->direction);
+    out_light->params[0] = light->radius;
+    if (light->type == RGL_LIGHT_TYPE_SPOT) {
+        out_light->params[1] = cosf(glm_rad(light->spot_outer_angle));
+        out_light->params[2] = cosf(glm_rad(light->spot_inner_angle));
+    }
+}
+
+/**
+ * @brief (INTERNAL) Builds the clustered light grid for the current view and uploads it.
+ *
+ * 1. Frustum-culls the active lights and packs the visible ones, directional lights first.
+ * 2. Finds the cluster range of every visible point/spot light.
+ * 3. Counts lights per cluster, prefix-sums the counts into offsets and scatters the light
+ *    indices, so each cluster's list is a contiguous run of the index buffer.
+ * 4. Uploads the three SSBOs and sets the grid uniforms on the (bound) main shader.
+ *
+ * Steps 1-4 are skipped when neither the light version nor the view, projection and viewport
+ * have changed since the last build; the previous buffers are still valid in that case.
+ */
+static void _RGL_BuildLightClusters(void) {
+    enum { CLUSTER_COUNT = RGL_CLUSTER_GRID_X * RGL_CLUSTER_GRID_Y * RGL_CLUSTER_GRID_Z };
+    RGLShaderLight* packed = RGL.light_clusters.lights;
+    RGLLightClusterBounds* bounds = RGL.light_clusters.bounds;
+    uint32_t* clusters = RGL.light_clusters.clusters;
+
+    double start_time = SituationTimerGetTime();
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    // 0. --- Reuse the Last Grid if Nothing it Depends On Changed ---
+    ma_mutex_lock(&RGL.light_mutex);
+    if (RGL.light_clusters.built &&
+        RGL.light_clusters.built_version == RGL.light_version &&
+        memcmp(RGL.light_clusters.built_viewport, viewport, sizeof(viewport)) == 0 &&
+        memcmp(RGL.light_clusters.built_view, RGL.current_view_matrix, sizeof(mat4)) == 0 &&
+        memcmp(RGL.light_clusters.built_projection, RGL.current_projection_matrix, sizeof(mat4)) == 0) {
+        ma_mutex_unlock(&RGL.light_mutex);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, RGL.light_clusters.light_ssbo);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, RGL.light_clusters.cluster_ssbo);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, RGL.light_clusters.index_ssbo);
+        _RGL_SetLightClusterUniforms(RGL.light_clusters.built_directional_count, viewport);
+        RGL.stats.light_ubo_upload_time_ms += (float)((SituationTimerGetTime() - start_time) * 1000.0);
+        return;
+    }
+    RGL.light_clusters.built = true;
+    RGL.light_clusters.built_version = RGL.light_version;
+    memcpy(RGL.light_clusters.built_viewport, viewport, sizeof(viewport));
+    glm_mat4_copy(RGL.current_view_matrix, RGL.light_clusters.built_view);
+    glm_mat4_copy(RGL.current_projection_matrix, RGL.light_clusters.built_projection);
+    RGL.stats.light_cluster_rebuilds++;
+
+    vec4 frustum_planes[6];
+    mat4 view_proj;
+    glm_mat4_mul(RGL.current_projection_matrix, RGL.current_view_matrix, view_proj);
+    _RGL_ExtractFrustumPlanes(view_proj, frustum_planes);
+
+    // 1. --- Cull and Pack (directional lights first, then point/spot lights) ---
+    int directional_count = 0;
+    int light_count = 0;
+    for (int i = 0; i < RGL.light_slot_count; i++) {
+        if (RGL.lights[i].is_active && RGL.lights[i].type == RGL_LIGHT_TYPE_DIRECTIONAL) {
+            _RGL_PackShaderLight(&RGL.lights[i], &packed[light_count++]);
+        }
+    }
+    directional_count = light_count;
+
+    // 2. --- Find Each Local Light's Cluster Range ---
+    for (int i = 0; i < RGL.light_slot_count; i++) {
+        const RGLLight* light = &RGL.lights[i];
+        if (!light->is_active || light->type == RGL_LIGHT_TYPE_DIRECTIONAL) continue;
+
+        float bias_to_use = (light->culling_bias > 0.0f) ? light->culling_bias : RGL_LIGHT_CULLING_BIAS;
+        if (!_RGL_FrustumIntersectsSphere(frustum_planes, (float*)light->position, light->radius, bias_to_use)) continue;
+        if (!_RGL_ComputeLightClusterBounds(light, &bounds[light_count])) continue;
+
+        _RGL_PackShaderLight(light, &packed[light_count++]);
+    }
+    ma_mutex_unlock(&RGL.light_mutex);
+    RGL.stats.active_lights_per_frame = light_count;
+
+    // 3. --- Bin Lights into Clusters (count, prefix sum, scatter) ---
+    memset(clusters, 0, sizeof(uint32_t) * 2 * CLUSTER_COUNT);
+    for (int l = directional_count; l < light_count; l++) {
+        const RGLLightClusterBounds* b = &bounds[l];
+        for (int z = b->min_z; z <= b->max_z; z++)
+            for (int y = b->min_y; y <= b->max_y; y++)
+                for (int x = b->min_x; x <= b->max_x; x++)
+                    clusters[2 * (x + RGL_CLUSTER_GRID_X * (y + RGL_CLUSTER_GRID_Y * z)) + 1]++;
+    }
+
+    size_t total_indices = 0;
+    for (int c = 0; c < CLUSTER_COUNT; c++) {
+        clusters[2 * c] = (uint32_t)total_indices;
+        total_indices += clusters[2 * c + 1];
+        clusters[2 * c + 1] = 0; // Reused as the scatter cursor below
+    }
+
+    if (total_indices > RGL.light_clusters.index_capacity) {
+        size_t new_capacity = (RGL.light_clusters.index_capacity == 0) ? 1024 : RGL.light_clusters.index_capacity;
+        while (new_capacity < total_indices) new_capacity *= 2;
+        uint32_t* new_indices = (uint32_t*)realloc(RGL.light_clusters.indices, sizeof(uint32_t) * new_capacity);
+        if (!new_indices) {
+            _SituationSetWarning("Failed to grow the light cluster index list. Local lights are disabled this flush.");
+            light_count = directional_count;
+            total_indices = 0;
+            memset(clusters, 0, sizeof(uint32_t) * 2 * CLUSTER_COUNT);
+            RGL.light_clusters.built = false; // Retry on the next flush
+        } else {
+            RGL.light_clusters.indices = new_indices;
+            RGL.light_clusters.index_capacity = new_capacity;
+            RGL.stats.memory_reallocations++;
+        }
+    }
+
+    uint32_t* indices = RGL.light_clusters.indices;
+    for (int l = directional_count; l < light_count; l++) {
+        const RGLLightClusterBounds* b = &bounds[l];
+        for (int z = b->min_z; z <= b->max_z; z++)
+            for (int y = b->min_y; y <= b->max_y; y++)
+                for (int x = b->min_x; x <= b->max_x; x++) {
+                    uint32_t* cluster = &clusters[2 * (x + RGL_CLUSTER_GRID_X * (y + RGL_CLUSTER_GRID_Y * z))];
+                    indices[cluster[0] + cluster[1]++] = (uint32_t)l;
+                }
+    }
+
+    // 4. --- Upload (orphaning each buffer) and Set the Grid Uniforms ---
+#ifdef RGL_ENABLE_BENCHMARKS
+    if (!RGL.benchmark_cpu_only)
+#endif
+    {
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, RGL.light_clusters.light_ssbo);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(RGLShaderLight) * (light_count > 0 ? light_count : 1), light_count > 0 ? packed : NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, RGL.light_clusters.cluster_ssbo);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(uint32_t) * 2 * CLUSTER_COUNT, clusters, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, RGL.light_clusters.index_ssbo);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(uint32_t) * (total_indices > 0 ? total_indices : 1), total_indices > 0 ? indices : NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+        RGL.stats.bytes_uploaded += sizeof(RGLShaderLight) * light_count + sizeof(uint32_t) * (2 * CLUSTER_COUNT + total_indices);
+    }
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, RGL.light_clusters.light_ssbo);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, RGL.light_clusters.cluster_ssbo);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, RGL.light_clusters.index_ssbo);
+
+    RGL.light_clusters.built_directional_count = directional_count;
+    _RGL_SetLightClusterUniforms(directional_count, viewport);
+    RGL.stats.light_ubo_upload_time_ms += (float)((SituationTimerGetTime() - start_time) * 1000.0);
+}
+
+/**
+ * @brief (INTERNAL) Sets the clustered lighting uniforms on the bound main shader.
+ * @param directional_count Number of directional lights at the start of the light SSBO.
+ * @param viewport The viewport the grid was built for.
+ */
+static void _RGL_SetLightClusterUniforms(int directional_count, const GLint viewport[4]) {
+    glUniform1i(RGL.light_clusters.loc_directional_lights, directional_count);
+    glUniform3ui(RGL.light_clusters.loc_cluster_dims, RGL_CLUSTER_GRID_X, RGL_CLUSTER_GRID_Y, RGL_CLUSTER_GRID_Z);
+    glUniform4f(RGL.light_clusters.loc_cluster_viewport, (float)viewport[0], (float)viewport[1],
+                (viewport[2] > 0) ? (float)RGL_CLUSTER_GRID_X / viewport[2] : 0.0f,
+                (viewport[3] > 0) ? (float)RGL_CLUSTER_GRID_Y / viewport[3] : 0.0f);
+    glUniform2f(RGL.light_clusters.loc_cluster_z_params, RGL.light_clusters.z_scale, RGL.light_clusters.z_bias);
+}
+
 /**
  * @brief (INTERNAL) Queues 6 lit quads to form a cube.
  *
@@ -4271,7 +8897,7 @@ static void _RGL_DrawCubeFaces(vec3 position, float size, RGLMaterial material)
     // 5. --- Loop and Queue Each Face ---
     for (int i = 0; i < 6; i++) {
         // Use the safe "populate-then-commit" pattern.
-        RGLInternalDraw* cmd = &RGL.commands[RGL.command_count];
+        RGLInternalDraw* cmd = _RGL_PeekCommand();
 
         // --- Populate the Command ---
         cmd->texture.texture.slot_index = 0; // Untextured
@@ -4303,7 +8929,7 @@ static void _RGL_DrawCubeFaces(vec3 position, float size, RGLMaterial material)
         cmd->z_depth = (cmd->world_positions[0][2] + cmd->world_positions[1][2] + cmd->world_positions[2][2] + cmd->world_positions[3][2]) * 0.25f;
 
         // --- Commit the Command ---
-        RGL.command_count++;
+        _RGL_CommitCommand();
     }
 }
 
@@ -4341,7 +8967,7 @@ SITAPI void RGL_DrawLine3D(Vector3 start, Vector3 end, float thickness, Color co
 SITAPI void RGL_DrawQuad3D(Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4, Vector3 normal, RGLSprite sprite, Color tint, float base_light) {
     if (!_RGL_EnsureCommandCapacity(1)) return;
 
-    RGLInternalDraw* cmd = &RGL.commands[RGL.command_count++];
+    RGLInternalDraw* cmd = _RGL_PushCommand();
     cmd->texture = sprite.texture;
     cmd->is_triangle = false;
     cmd->z_depth = (p1.z + p2.z + p3.z + p4.z) * 0.25f; // Average Z for sorting
@@ -4384,7 +9010,7 @@ SITAPI void RGL_DrawQuad3D(Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4, Vecto
 SITAPI void RGL_DrawTriangle3D(vec3 p1, vec3 p2, vec3 p3, vec3 normal, vec2 uv1, vec2 uv2, vec2 uv3, RGLSprite sprite, Color tint, float base_light) {
     if (!_RGL_EnsureCommandCapacity(1)) return;
 
-    RGLInternalDraw* cmd = &RGL.commands[RGL.command_count++];
+    RGLInternalDraw* cmd = _RGL_PushCommand();
     cmd->texture = sprite.texture;
     cmd->is_triangle = true;
     cmd->z_depth = (p1[2] + p2[2] + p3[2]) / 3.0f;
@@ -4425,6 +9051,7 @@ SITAPI int RGL_AddVertex(const char* level_name, RGLVertex3D_pos vertex) {
         level->vertex_capacity = new_capacity;
     }
     level->vertices[level->vertex_count] = vertex;
+    level->geometry_dirty = true;
     return (int)level->vertex_count++;
 }
 
@@ -4453,6 +9080,7 @@ SITAPI bool RGL_AddWall(const char* level_name, RGLWall wall) {
         level->wall_capacity = new_capacity;
     }
     level->walls[level->wall_count++] = wall;
+    level->geometry_dirty = true;
     return true;
 }
 
@@ -4460,9 +9088,10 @@ SITAPI bool RGL_AddWall(const char* level_name, RGLWall wall) {
 static bool _RGL_TriangulateFlat(const RGLFlat* flat, const RGLVertex3D_pos* vertices, int* triangle_indices, size_t* triangle_count) {
     if (flat->vertex_count < 3) return false;
 
-    // Allocate temporary vertex list for the algorithm
+    // Temporary vertex list for the algorithm, from the frame arena
     size_t n = flat->vertex_count;
-    int* indices = malloc(n * sizeof(int));
+    RGLFrameArenaMark scratch_mark = _RGL_FrameArenaMark();
+    int* indices = (int*)_RGL_FrameAlloc(n * sizeof(int));
     if (!indices) return false;
     for (size_t i = 0; i < n; i++) indices[i] = flat->vertex_indices[i];
 
@@ -4524,14 +9153,14 @@ static bool _RGL_TriangulateFlat(const RGLFlat* flat, const RGLVertex3D_pos* ver
         }
         if (!found_ear) {
             // No ear found, the polygon might be self-intersecting or invalid.
-            free(indices);
+            _RGL_FrameArenaRewind(scratch_mark);
             *triangle_count = 0;
             return false;
         }
     }
 
     *triangle_count = tri_idx / 3;
-    free(indices);
+    _RGL_FrameArenaRewind(scratch_mark);
     return true;
 }
 
@@ -4573,6 +9202,7 @@ SITAPI bool RGL_AddFlat(const char* level_name, RGLFlat flat) {
     RGLFlat new_flat = flat;
     new_flat.vertex_indices = new_indices;
     level->flats[level->flat_count++] = new_flat;
+    level->geometry_dirty = true;
     return true;
 }
 
@@ -4599,6 +9229,7 @@ SITAPI bool RGL_AddThing(const char* level_name, RGLThing thing) {
         level->thing_capacity = new_capacity;
     }
     level->things[level->thing_count++] = thing;
+    level->geometry_dirty = true; // The culling grid buckets things too
     return true;
 }
 
@@ -4649,6 +9280,16 @@ SITAPI bool RGL_CreateLevel(const char* level_name) {
     level->things = NULL;
     level->thing_count = 0;
     level->thing_capacity = 0;
+    level->geometry_dirty = true;
+    glm_mat4_identity(level->static_transform);
+    level->static_vao = level->static_vbo = level->static_ibo = 0;
+    level->static_ranges = NULL;
+    level->static_range_count = 0;
+    level->static_opaque_range_count = 0;
+    level->grid_cols = level->grid_rows = 0;
+    level->cells = NULL;
+    level->cell_count = 0;
+    level->cell_things = NULL;
     return true;
 }
 
@@ -4670,6 +9311,7 @@ SITAPI bool RGL_DestroyLevelByName(const char* level_name) {
     RGLLevel* level = &RGL.levels[index];
 
     // --- Free all dynamically allocated memory within the level struct ---
+    _RGL_FreeLevelStaticGeometry(level);
     free(level->vertices);
     free(level->walls);
     free(level->things);
@@ -4687,6 +9329,16 @@ SITAPI bool RGL_DestroyLevelByName(const char* level_name) {
     }
     RGL.level_count--;
 
+    // Queued draws refer to levels by index: drop this level's (if the flush could not run) and renumber the rest.
+    size_t kept = 0;
+    for (size_t q = 0; q < RGL.static_level_queue_count; q++) {
+        RGLQueuedLevel queued = RGL.static_level_queue[q];
+        if (queued.level_index == index) continue;
+        if (queued.level_index > index) queued.level_index--;
+        RGL.static_level_queue[kept++] = queued;
+    }
+    RGL.static_level_queue_count = kept;
+
     // Adjust the active level index if necessary
     if (RGL.active_level_index == index) {
         RGL.active_level_index = -1; // The active level was destroyed
@@ -4838,7 +9490,8 @@ SITAPI RGLMesh RGL_CreateMeshFromLevel(const char* level_name) {
 
         // Triangulate the flat's 2D vertices (XZ plane)
         size_t max_flat_indices = (flat->vertex_count - 2) * 3;
-        int* flat_triangle_indices_local = malloc(max_flat_indices * sizeof(int)); // Indices relative to flat->vertex_indices
+        RGLFrameArenaMark flat_mark = _RGL_FrameArenaMark();
+        int* flat_triangle_indices_local = (int*)_RGL_FrameAlloc(max_flat_indices * sizeof(int)); // Indices relative to flat->vertex_indices
         if (!flat_triangle_indices_local) {
             _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate temp indices for flat triangulation during mesh creation.");
              // Continue to next flat, losing this one's geometry
@@ -4875,13 +9528,14 @@ SITAPI RGLMesh RGL_CreateMeshFromLevel(const char* level_name) {
              // Triangulation failed - do not add this flat's geometry/indices.
         }
 
-        // Cleanup the temporary local indices buffer for this flat
-        free(flat_triangle_indices_local);
+        // Hand the flat's scratch back so the next flat reuses it
+        _RGL_FrameArenaRewind(flat_mark);
     }
 
-    // --- Pass 4: Do NOT create or upload GPU buffers (VAO/VBO/EBO) ---
-    // This mesh is intended only for CPU-side shadow volume generation,
-    // which operates directly on cpu_vertices and cpu_indices.
+    // --- Pass 4: Upload only the shadow-volume buffers ---
+    // This mesh is never drawn directly, so it gets no gpu_mesh; the stencil shadow
+    // caster only needs its positions and the adjacency cached here.
+    _RGL_BuildMeshShadowData(&new_mesh);
 
     // --- Pass 5: Set the mesh ID and return ---
     // We don't use a global mesh registry for this specific function's output currently.
@@ -4891,15 +9545,22 @@ SITAPI RGLMesh RGL_CreateMeshFromLevel(const char* level_name) {
     return new_mesh;
 }
 
-SITAPI RGLMesh RGL_LoadMeshFromFile(const char* filename) {
+/**
+ * @brief (INTERNAL) Reads and parses an .obj file into CPU memory only, so it can run on a worker thread.
+ * On success out_mesh holds the CPU arrays and counts (no GPU objects, id 0) and *out_gpu_vertices the
+ * interleaved buffer for _RGL_UploadDecodedMesh.
+ */
+static bool _RGL_DecodeObjMesh(const char* filename, RGLMesh* out_mesh, RGLVertex3D** out_gpu_vertices) {
     RGLMesh mesh = {0}; // Always start with a null mesh
+    *out_mesh = mesh;
+    *out_gpu_vertices = NULL;
 
     // --- 1. Load File From Disk using the Platform Layer ---
     unsigned int file_size = 0;
     unsigned char* file_data = NULL;
     if (SituationLoadFileData(filename, &file_size, &file_data) != SITUATION_SUCCESS || !file_data) {
         // situation.h will have already set the error message.
-        return mesh;
+        return false;
     }
     char* file_text = (char*)file_data;
 
@@ -4918,7 +9579,7 @@ SITAPI RGLMesh RGL_LoadMeshFromFile(const char* filename) {
 
     if (result != TINYOBJ_SUCCESS) {
         _SituationSetErrorFromCode(SITUATION_ERROR_GENERAL, "Failed to parse OBJ file data.");
-        return mesh;
+        return false;
     }
 
     // We cannot proceed if the file has no geometry.
@@ -4927,7 +9588,7 @@ SITAPI RGLMesh RGL_LoadMeshFromFile(const char* filename) {
         tinyobj_attrib_free(&attrib);
         tinyobj_shapes_free(shapes, num_shapes);
         tinyobj_materials_free(materials, num_materials);
-        return mesh;
+        return false;
     }
 
     // --- 3. Process and Interleave Vertex Data ---
@@ -4950,7 +9611,7 @@ SITAPI RGLMesh RGL_LoadMeshFromFile(const char* filename) {
         free(mesh.cpu_vertices); free(mesh.cpu_texcoords); free(mesh.cpu_normals); free(mesh.cpu_indices);
         tinyobj_attrib_free(&attrib); tinyobj_shapes_free(shapes, num_shapes); tinyobj_materials_free(materials, num_materials);
         _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate memory for mesh processing.");
-        return (RGLMesh){0};
+        return false;
     }
 
     // Loop through each vertex of each face defined in the OBJ
@@ -4994,33 +9655,47 @@ SITAPI RGLMesh RGL_LoadMeshFromFile(const char* filename) {
     mesh.vertex_count = total_indices;
     mesh.index_count = total_indices;
 
-    // --- 4. Upload Data to the GPU ---
-    // Use the Situation API to create the GPU mesh.
-    // Since we are expanding vertices (non-indexed draw), we pass NULL for indices and 0 count.
-    SituationError err = SituationCreateMesh(gpu_vertex_data, total_indices, sizeof(RGLVertex3D), NULL, 0, &mesh.gpu_mesh);
-
-    // Free the temporary interleaved buffer
-    free(gpu_vertex_data);
-
-    // Free tinyobj resources
+    // --- 4. Free the OBJ Parser Data ---
     tinyobj_attrib_free(&attrib);
     tinyobj_shapes_free(shapes, num_shapes);
     tinyobj_materials_free(materials, num_materials);
 
+    *out_mesh = mesh;
+    *out_gpu_vertices = gpu_vertex_data;
+    return true;
+}
+
+/**
+ * @brief (INTERNAL) Uploads a mesh decoded by _RGL_DecodeObjMesh. Always frees gpu_vertices; on failure
+ * the mesh's CPU arrays are freed too and it is zeroed.
+ */
+static bool _RGL_UploadDecodedMesh(RGLMesh* mesh, RGLVertex3D* gpu_vertices) {
+    // 1. --- Upload Data to the GPU ---
+    // Since we are expanding vertices (non-indexed draw), we pass NULL for indices and 0 count.
+    SituationError err = SituationCreateMesh(gpu_vertices, mesh->vertex_count, sizeof(RGLVertex3D), NULL, 0, &mesh->gpu_mesh);
+    free(gpu_vertices);
+
     if (err != SITUATION_SUCCESS) {
         // Cleanup CPU buffers on failure
-        free(mesh.cpu_vertices); free(mesh.cpu_texcoords); free(mesh.cpu_normals); free(mesh.cpu_indices);
-        return (RGLMesh){0};
+        free(mesh->cpu_vertices); free(mesh->cpu_texcoords); free(mesh->cpu_normals); free(mesh->cpu_indices);
+        free(mesh->cpu_adjacency);
+        memset(mesh, 0, sizeof(RGLMesh));
+        return false;
     }
 
-    // --- 6. Final Cleanup of OBJ Parser Data ---
-    tinyobj_attrib_free(&attrib);
-    tinyobj_shapes_free(shapes, num_shapes);
-    tinyobj_materials_free(materials, num_materials);
+    // 2. --- Cache Shadow-Volume Adjacency ---
+    _RGL_BuildMeshShadowData(mesh);
 
     // TODO: Add the mesh to a managed list in RGLState and assign it a real ID.
-    mesh.id = 1; // Placeholder ID
+    mesh->id = 1; // Placeholder ID
+    return true;
+}
 
+SITAPI RGLMesh RGL_LoadMeshFromFile(const char* filename) {
+    RGLMesh mesh;
+    RGLVertex3D* gpu_vertices = NULL;
+    if (!_RGL_DecodeObjMesh(filename, &mesh, &gpu_vertices)) return mesh;
+    _RGL_UploadDecodedMesh(&mesh, gpu_vertices);
     return mesh;
 }
 
@@ -5108,23 +9783,667 @@ SITAPI bool RGL_SaveMeshToFile(RGLMesh mesh, const char* filename) {
     return true;
 }
 
-
-SITAPI void RGL_DestroyMesh(RGLMesh* mesh) {
-    if (!mesh || mesh->id == 0) return;
-
-    // The ONLY thing RGL needs to do is ask situation.h to destroy the GPU mesh.
+/**
+ * @brief (INTERNAL) Maps a whole file read-only (mmap, or a file mapping on Windows).
+ */
+static bool _RGL_MapFile(const char* filename, RGLMappedFile* out_file) {
+    memset(out_file, 0, sizeof(RGLMappedFile));
+    if (!filename) return false;
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) { CloseHandle(file); return false; }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (!view) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    out_file->data = (const unsigned char*)view;
+    out_file->size = (size_t)size.QuadPart;
+    out_file->file = file;
+    out_file->mapping = mapping;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) { close(fd); return false; }
+    void* view = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping keeps the file alive
+    if (view == MAP_FAILED) return false;
+    out_file->data = (const unsigned char*)view;
+    out_file->size = (size_t)info.st_size;
+#endif
+    return true;
+}
+
+static void _RGL_UnmapFile(RGLMappedFile* file) {
+    if (!file || !file->data) return;
+#if defined(_WIN32)
+    UnmapViewOfFile(file->data);
+    CloseHandle(file->mapping);
+    CloseHandle(file->file);
+#else
+    munmap((void*)file->data, file->size);
+#endif
+    memset(file, 0, sizeof(RGLMappedFile));
+}
+
+/**
+ * @brief (INTERNAL) Lays out the blocks of a .rglmesh file after its header, each aligned to RGL_MESH_FILE_ALIGNMENT.
+ * vertex_count and index_count must already be set.
+ */
+static void _RGL_ComputeMeshFileLayout(RGLMeshFileHeader* header, bool has_adjacency) {
+    const uint64_t align = RGL_MESH_FILE_ALIGNMENT;
+    uint64_t cursor = (sizeof(RGLMeshFileHeader) + align - 1) & ~(align - 1);
+    uint64_t vertex_count = header->vertex_count;
+    uint64_t index_count = header->index_count;
+
+    header->interleaved_offset = cursor; cursor += (vertex_count * sizeof(RGLVertex3D) + align - 1) & ~(align - 1);
+    header->vertices_offset = cursor;    cursor += (vertex_count * sizeof(vec3) + align - 1) & ~(align - 1);
+    header->texcoords_offset = cursor;   cursor += (vertex_count * sizeof(vec2) + align - 1) & ~(align - 1);
+    header->normals_offset = cursor;     cursor += (vertex_count * sizeof(vec3) + align - 1) & ~(align - 1);
+    header->indices_offset = cursor;     cursor += (index_count * sizeof(uint32_t) + align - 1) & ~(align - 1);
+    header->adjacency_offset = 0;
+    if (has_adjacency) {
+        header->adjacency_offset = cursor;
+        cursor += (index_count / 3 * 6 * sizeof(uint32_t) + align - 1) & ~(align - 1);
+    }
+    header->file_size = cursor;
+}
+
+/**
+ * @brief (INTERNAL) Checks that a mapping holds a .rglmesh this build can read directly.
+ * The version and vertex stride must match and every block must lie, aligned, inside the file.
+ * The file may be a stale or damaged cache, so one linear pass also bounds every index and adjacency
+ * entry by vertex_count (the adjacency has no sentinel: open edges repeat the triangle's own vertex).
+ * Vertex data is otherwise taken exactly as written.
+ */
+static bool _RGL_ValidateMeshFile(const RGLMappedFile* file) {
+    if (file->size < sizeof(RGLMeshFileHeader)) return false;
+    const RGLMeshFileHeader* header = (const RGLMeshFileHeader*)file->data;
+    if (header->magic != RGL_MESH_FILE_MAGIC || header->version != RGL_MESH_FILE_VERSION) return false;
+    if (header->vertex_stride != sizeof(RGLVertex3D)) return false;
+    if (header->vertex_count == 0 || header->index_count < 3 || header->index_count % 3 != 0) return false;
+    if (header->vertex_count > INT32_MAX || header->index_count > INT32_MAX) return false;
+
+    // The layout is fully determined by the counts, so recomputing it checks every offset at once.
+    RGLMeshFileHeader expected = *header;
+    _RGL_ComputeMeshFileLayout(&expected, header->adjacency_offset != 0);
+    bool layout_ok = expected.interleaved_offset == header->interleaved_offset &&
+                     expected.vertices_offset == header->vertices_offset &&
+                     expected.texcoords_offset == header->texcoords_offset &&
+                     expected.normals_offset == header->normals_offset &&
+                     expected.indices_offset == header->indices_offset &&
+                     expected.adjacency_offset == header->adjacency_offset &&
+                     expected.file_size == header->file_size &&
+                     header->file_size <= file->size;
+    if (!layout_ok) return false;
+
+    // Indices feed GPU draws and the CPU silhouette code directly; one out of range is an out-of-bounds read.
+    const uint32_t* indices = (const uint32_t*)(file->data + header->indices_offset);
+    for (uint32_t i = 0; i < header->index_count; i++) {
+        if (indices[i] >= header->vertex_count) return false;
+    }
+    if (header->adjacency_offset) {
+        const uint32_t* adjacency = (const uint32_t*)(file->data + header->adjacency_offset);
+        size_t adjacency_count = (size_t)(header->index_count / 3) * 6;
+        for (size_t i = 0; i < adjacency_count; i++) {
+            if (adjacency[i] >= header->vertex_count) return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief (INTERNAL) Writes a mesh's CPU-side data as a .rglmesh file, including its adjacency if built.
+ */
+static bool _RGL_WriteMeshBinary(const RGLMesh* mesh, const char* filename, int64_t source_mod_time) {
+    if (!mesh || !filename || !mesh->cpu_vertices || !mesh->cpu_texcoords || !mesh->cpu_normals || !mesh->cpu_indices ||
+        mesh->vertex_count <= 0 || mesh->index_count < 3) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_INVALID_PARAM, "Cannot save binary mesh: mesh is invalid or missing CPU data.");
+        return false;
+    }
+
+    // 1. --- Build the header and the interleaved upload block ---
+    RGLMeshFileHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = RGL_MESH_FILE_MAGIC;
+    header.version = RGL_MESH_FILE_VERSION;
+    header.vertex_stride = sizeof(RGLVertex3D);
+    header.vertex_count = (uint32_t)mesh->vertex_count;
+    header.index_count = (uint32_t)(mesh->index_count - mesh->index_count % 3);
+    header.source_mod_time = source_mod_time;
+    _RGL_ComputeMeshFileLayout(&header, mesh->cpu_adjacency != NULL);
+
+    RGLVertex3D* interleaved = (RGLVertex3D*)malloc(sizeof(RGLVertex3D) * mesh->vertex_count);
+    if (!interleaved) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate binary mesh vertices.");
+        return false;
+    }
+    for (int i = 0; i < mesh->vertex_count; i++) {
+        glm_vec3_copy(mesh->cpu_vertices[i], interleaved[i].position);
+        glm_vec3_copy(mesh->cpu_normals[i], interleaved[i].normal);
+        glm_vec2_copy(mesh->cpu_texcoords[i], interleaved[i].tex_coord);
+    }
+
+    // 2. --- Write each block at its offset, zero-padding the gaps ---
+    FILE* file = fopen(filename, "wb");
+    if (!file) {
+        free(interleaved);
+        _SituationSetErrorFromCode(SITUATION_ERROR_FILE_ACCESS, "Failed to open binary mesh file for writing.");
+        return false;
+    }
+    struct { uint64_t offset; const void* data; size_t size; } blocks[7] = {
+        { 0, &header, sizeof(header) },
+        { header.interleaved_offset, interleaved, sizeof(RGLVertex3D) * header.vertex_count },
+        { header.vertices_offset, mesh->cpu_vertices, sizeof(vec3) * header.vertex_count },
+        { header.texcoords_offset, mesh->cpu_texcoords, sizeof(vec2) * header.vertex_count },
+        { header.normals_offset, mesh->cpu_normals, sizeof(vec3) * header.vertex_count },
+        { header.indices_offset, mesh->cpu_indices, sizeof(uint32_t) * header.index_count },
+        { header.adjacency_offset, mesh->cpu_adjacency, sizeof(uint32_t) * (header.index_count / 3 * 6) }
+    };
+    static const unsigned char padding[RGL_MESH_FILE_ALIGNMENT] = {0};
+    uint64_t cursor = 0;
+    bool success = true;
+    for (int i = 0; i < 7 && success; i++) {
+        if (i > 0 && blocks[i].offset == 0) continue; // No adjacency stored
+        while (cursor < blocks[i].offset && success) {
+            size_t gap = (size_t)(blocks[i].offset - cursor);
+            if (gap > sizeof(padding)) gap = sizeof(padding);
+            success = fwrite(padding, 1, gap, file) == gap;
+            cursor += gap;
+        }
+        success = success && fwrite(blocks[i].data, 1, blocks[i].size, file) == blocks[i].size;
+        cursor += blocks[i].size;
+    }
+    while (cursor < header.file_size && success) {
+        size_t gap = (size_t)(header.file_size - cursor);
+        if (gap > sizeof(padding)) gap = sizeof(padding);
+        success = fwrite(padding, 1, gap, file) == gap;
+        cursor += gap;
+    }
+    success = (fclose(file) == 0) && success;
+    free(interleaved);
+
+    if (!success) {
+        remove(filename); // Never leave a truncated file that a later load would have to reject
+        _SituationSetErrorFromCode(SITUATION_ERROR_FILE_ACCESS, "Failed to write binary mesh file.");
+    }
+    return success;
+}
+
+/**
+ * @brief (INTERNAL) Creates a mesh from a validated .rglmesh mapping.
+ * The interleaved block goes to SituationCreateMesh untouched; the CPU blocks are copied out (RGLMesh
+ * owns its arrays) and a stored adjacency skips the weld in _RGL_BuildMeshShadowData.
+ */
+static bool _RGL_UploadMappedMesh(const RGLMappedFile* file, RGLMesh* out_mesh) {
+    const RGLMeshFileHeader* header = (const RGLMeshFileHeader*)file->data;
+    const unsigned char* base = file->data;
+    RGLMesh mesh = {0};
+    *out_mesh = mesh;
+    mesh.vertex_count = (int)header->vertex_count;
+    mesh.index_count = (int)header->index_count;
+
+    // 1. --- Upload straight from the mapping ---
+    if (SituationCreateMesh(base + header->interleaved_offset, mesh.vertex_count, sizeof(RGLVertex3D),
+                            (const uint32_t*)(base + header->indices_offset), mesh.index_count, &mesh.gpu_mesh) != SITUATION_SUCCESS) {
+        return false;
+    }
+
+    // 2. --- Copy the CPU-side blocks ---
+    size_t adjacency_count = (size_t)(mesh.index_count / 3) * 6;
+    mesh.cpu_vertices = (vec3*)malloc(sizeof(vec3) * mesh.vertex_count);
+    mesh.cpu_texcoords = (vec2*)malloc(sizeof(vec2) * mesh.vertex_count);
+    mesh.cpu_normals = (vec3*)malloc(sizeof(vec3) * mesh.vertex_count);
+    mesh.cpu_indices = (unsigned int*)malloc(sizeof(unsigned int) * mesh.index_count);
+    if (header->adjacency_offset) mesh.cpu_adjacency = (unsigned int*)malloc(sizeof(unsigned int) * adjacency_count);
+    if (!mesh.cpu_vertices || !mesh.cpu_texcoords || !mesh.cpu_normals || !mesh.cpu_indices ||
+        (header->adjacency_offset && !mesh.cpu_adjacency)) {
+        SituationDestroyMesh(&mesh.gpu_mesh);
+        free(mesh.cpu_vertices); free(mesh.cpu_texcoords); free(mesh.cpu_normals); free(mesh.cpu_indices);
+        free(mesh.cpu_adjacency);
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate binary mesh CPU data.");
+        return false;
+    }
+    memcpy(mesh.cpu_vertices, base + header->vertices_offset, sizeof(vec3) * mesh.vertex_count);
+    memcpy(mesh.cpu_texcoords, base + header->texcoords_offset, sizeof(vec2) * mesh.vertex_count);
+    memcpy(mesh.cpu_normals, base + header->normals_offset, sizeof(vec3) * mesh.vertex_count);
+    memcpy(mesh.cpu_indices, base + header->indices_offset, sizeof(unsigned int) * mesh.index_count);
+    if (mesh.cpu_adjacency) memcpy(mesh.cpu_adjacency, base + header->adjacency_offset, sizeof(unsigned int) * adjacency_count);
+
+    // 3. --- Shadow-volume buffers (reuses the stored adjacency) ---
+    _RGL_BuildMeshShadowData(&mesh);
+
+    mesh.id = 1;
+    *out_mesh = mesh;
+    return true;
+}
+
+/**
+ * @brief Loads a binary .rglmesh file written by RGL_SaveMeshBinary or RGL_ConvertObjToMeshBinary.
+ * The file is memory-mapped and its interleaved block is handed to SituationCreateMesh as-is, so
+ * loading costs one file mapping and a few memcpy's, with no text parsing or adjacency building.
+ * @return The mesh, or a zeroed mesh (id 0) if the file is missing, truncated, corrupt or from another version.
+ */
+SITAPI RGLMesh RGL_LoadMeshBinary(const char* filename) {
+    RGLMesh mesh = {0};
+    RGLMappedFile file;
+    if (!_RGL_MapFile(filename, &file)) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_FILE_ACCESS, "Failed to open binary mesh file.");
+        return mesh;
+    }
+    if (!_RGL_ValidateMeshFile(&file)) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_GENERAL, "Binary mesh file is invalid, truncated or from another version.");
+    } else {
+        _RGL_UploadMappedMesh(&file, &mesh);
+    }
+    _RGL_UnmapFile(&file);
+    return mesh;
+}
+
+/**
+ * @brief Saves a mesh's CPU-side geometry as a binary .rglmesh file.
+ * Unlike RGL_SaveMeshToFile this keeps the exact vertex data and index buffer, plus the cached
+ * shadow-volume adjacency when the mesh has one, so RGL_LoadMeshBinary can skip rebuilding it.
+ */
+SITAPI bool RGL_SaveMeshBinary(RGLMesh mesh, const char* filename) {
+    if (mesh.id == 0) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_INVALID_PARAM, "Cannot save binary mesh: mesh is invalid.");
+        return false;
+    }
+    return _RGL_WriteMeshBinary(&mesh, filename, 0);
+}
+
+/**
+ * @brief Converts an .obj model to a .rglmesh file.
+ * Runs entirely on the CPU (parse, interleave, adjacency weld), so it can be called from an offline
+ * asset tool without a GL context. The .obj's modification time is recorded for RGL_LoadMeshCached.
+ */
+SITAPI bool RGL_ConvertObjToMeshBinary(const char* obj_filename, const char* binary_filename) {
+    RGLMesh mesh;
+    RGLVertex3D* gpu_vertices = NULL;
+    if (!_RGL_DecodeObjMesh(obj_filename, &mesh, &gpu_vertices)) return false;
+    free(gpu_vertices); // The writer re-interleaves from the CPU arrays
+    _RGL_BuildMeshShadowAdjacency(&mesh);
+
+    bool success = _RGL_WriteMeshBinary(&mesh, binary_filename, (int64_t)SituationGetFileModTime(obj_filename));
+    free(mesh.cpu_vertices); free(mesh.cpu_texcoords); free(mesh.cpu_normals); free(mesh.cpu_indices);
+    free(mesh.cpu_adjacency);
+    return success;
+}
+
+/**
+ * @brief Loads an .obj through an automatic binary cache stored next to it ("<obj_filename>.rglmesh").
+ * The cache is used when its recorded source timestamp equals the .obj's current modification time (or
+ * when the .obj is absent, as in a build that ships only caches). Otherwise, or when the cache fails
+ * validation (truncated, or an index out of range), the .obj is parsed as by RGL_LoadMeshFromFile and
+ * the cache is rewritten; failing to write it only raises a warning.
+ */
+SITAPI RGLMesh RGL_LoadMeshCached(const char* obj_filename) {
+    RGLMesh mesh = {0};
+    if (!obj_filename) return mesh;
+
+    // 1. --- Name the cache file ---
+    size_t name_length = strlen(obj_filename);
+    char* cache_filename = (char*)malloc(name_length + sizeof(RGL_MESH_FILE_EXTENSION));
+    if (!cache_filename) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate mesh cache path.");
+        return mesh;
+    }
+    memcpy(cache_filename, obj_filename, name_length);
+    memcpy(cache_filename + name_length, RGL_MESH_FILE_EXTENSION, sizeof(RGL_MESH_FILE_EXTENSION));
+
+    // 2. --- Use the cache if it is current ---
+    bool have_source = SituationFileExists(obj_filename);
+    int64_t source_mod_time = have_source ? (int64_t)SituationGetFileModTime(obj_filename) : 0;
+    RGLMappedFile file;
+    if (_RGL_MapFile(cache_filename, &file)) {
+        bool current = _RGL_ValidateMeshFile(&file) &&
+                       (!have_source || ((const RGLMeshFileHeader*)file.data)->source_mod_time == source_mod_time);
+        bool loaded = current && _RGL_UploadMappedMesh(&file, &mesh);
+        _RGL_UnmapFile(&file);
+        if (loaded) {
+            free(cache_filename);
+            return mesh;
+        }
+    }
+
+    // 3. --- Fall back to the .obj and refresh the cache ---
+    RGLVertex3D* gpu_vertices = NULL;
+    if (_RGL_DecodeObjMesh(obj_filename, &mesh, &gpu_vertices)) {
+        _RGL_BuildMeshShadowAdjacency(&mesh);
+        if (!_RGL_WriteMeshBinary(&mesh, cache_filename, source_mod_time)) {
+            _SituationSetWarning("RGL_LoadMeshCached: could not write the binary mesh cache.");
+        }
+        _RGL_UploadDecodedMesh(&mesh, gpu_vertices);
+    }
+    free(cache_filename);
+    return mesh;
+}
+
+
+SITAPI void RGL_DestroyMesh(RGLMesh* mesh) {
+    if (!mesh || mesh->id == 0) return;
+
+    // The ONLY thing RGL needs to do is ask situation.h to destroy the GPU mesh.
     SituationDestroyMesh(&mesh->gpu_mesh);
+    _RGL_ReleaseInstanceGeometry(mesh);
 
     // RGL is still responsible for the CPU-side data it allocated.
     free(mesh->cpu_vertices);
     free(mesh->cpu_texcoords);
     free(mesh->cpu_normals);
     free(mesh->cpu_indices);
+    _RGL_FreeMeshShadowData(mesh);
 
     // Zero out the struct to invalidate it.
     memset(mesh, 0, sizeof(RGLMesh));
 }
 
+/**
+ * @brief (INTERNAL) Creates the placeholder assets returned for pending or failed async loads.
+ * The texture is a 2x2 grey checkerboard (flagged opaque); the mesh is a unit cube.
+ */
+static void _RGL_EnsureAsyncPlaceholders(void) {
+    if (RGL.async.placeholder_texture.texture.slot_index == 0) {
+        unsigned char pixels[16] = {
+            160, 160, 160, 255,   96,  96,  96, 255,
+             96,  96,  96, 255,  160, 160, 160, 255
+        };
+        SituationImage image = { pixels, 2, 2, 4, SITUATION_COLOR_SRGB };
+        RGLTexture placeholder = {0};
+        placeholder.virtual_display_id = -1;
+        placeholder.is_opaque = true;
+        if (SituationCreateTexture(image, false, &placeholder.texture) == SITUATION_SUCCESS) {
+            RGL.async.placeholder_texture = placeholder;
+        }
+    }
+    if (RGL.async.placeholder_mesh.id == 0) {
+        RGL.async.placeholder_mesh = RGL_GenMeshCube(1.0f, 1.0f, 1.0f);
+    }
+}
+
+/**
+ * @brief (INTERNAL) Finds a load by handle. Released handles are no longer found.
+ */
+static struct RGLAsyncLoad* _RGL_FindAsyncLoad(RGLAssetHandle handle) {
+#ifdef SITUATION_ENABLE_THREADING
+    if (handle == 0) return NULL;
+    for (size_t i = 0; i < RGL.async.count; i++) {
+        RGLAsyncLoad* load = RGL.async.loads[i];
+        if (load->handle == handle) return load->released ? NULL : load;
+    }
+#else
+    (void)handle;
+#endif
+    return NULL;
+}
+
+#ifdef SITUATION_ENABLE_THREADING
+/**
+ * @brief (INTERNAL) Frees whatever a load still owns. Results that reached READY belong to the caller and are kept.
+ */
+static void _RGL_FreeAsyncLoad(RGLAsyncLoad* load) {
+    if (load->image.data) SituationUnloadImage(load->image);
+    free(load->gpu_vertices);
+    if (load->state != RGL_ASSET_READY) {
+        free(load->mesh.cpu_vertices);
+        free(load->mesh.cpu_texcoords);
+        free(load->mesh.cpu_normals);
+        free(load->mesh.cpu_indices);
+        free(load->mesh.cpu_adjacency);
+    }
+    free(load->filename);
+    free(load);
+}
+
+/**
+ * @brief (INTERNAL) Pool job: does all of a load's file IO and decoding, touching no GL or RGL state.
+ */
+static void _RGL_AsyncLoadJob(void* data, void* user) {
+    (void)user;
+    RGLAsyncLoad* load = *(RGLAsyncLoad**)data;
+    bool decoded = false;
+
+    if (load->kind == RGL_ASYNC_TEXTURE) {
+        decoded = SituationLoadImage(load->filename, &load->image) == SITUATION_SUCCESS && load->image.data;
+        if (decoded) load->upload_bytes = (size_t)load->image.width * load->image.height * load->image.channels;
+    } else {
+        decoded = _RGL_DecodeObjMesh(load->filename, &load->mesh, &load->gpu_vertices);
+        if (decoded) {
+            // The adjacency weld is the slow part of creating a mesh; if it fails here the upload retries it.
+            _RGL_BuildMeshShadowAdjacency(&load->mesh);
+            load->upload_bytes = (size_t)load->mesh.vertex_count * (sizeof(RGLVertex3D) + sizeof(vec3)) +
+                                 (size_t)(load->mesh.index_count / 3) * 6 * sizeof(unsigned int);
+        }
+    }
+
+    int expected = RGL_ASYNC_DECODING;
+    if (!atomic_compare_exchange_strong_explicit(&load->decode_state, &expected, decoded ? RGL_ASYNC_DECODED : RGL_ASYNC_DECODE_FAILED,
+                                                 memory_order_seq_cst, memory_order_seq_cst)) {
+        // Released while decoding: the render thread has already forgotten this load.
+        _RGL_FreeAsyncLoad(load);
+    }
+}
+
+/**
+ * @brief (INTERNAL) Registers a load and queues its decode job. Returns its handle, or 0 on failure.
+ */
+static RGLAssetHandle _RGL_SubmitAsyncLoad(SituationThreadPool* pool, RGLAsyncKind kind, const char* filename, bool generate_mipmaps, RGLAssetCallback callback, void* user_data) {
+    if (!RGL.is_initialized) { _SituationSetErrorFromCode(SITUATION_ERROR_NOT_INITIALIZED, "RGL not initialized"); return 0; }
+    if (!pool || !filename) return 0;
+    _RGL_EnsureAsyncPlaceholders();
+
+    // 1. --- Make room in the load table ---
+    if (RGL.async.count >= RGL.async.capacity) {
+        size_t new_capacity = RGL.async.capacity == 0 ? 16 : RGL.async.capacity * 2;
+        RGLAsyncLoad** new_loads = realloc(RGL.async.loads, sizeof(RGLAsyncLoad*) * new_capacity);
+        if (!new_loads) {
+            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to grow async load table");
+            return 0;
+        }
+        RGL.async.loads = new_loads;
+        RGL.async.capacity = new_capacity;
+    }
+
+    // 2. --- Create the request ---
+    RGLAsyncLoad* load = (RGLAsyncLoad*)calloc(1, sizeof(RGLAsyncLoad));
+    size_t name_length = strlen(filename);
+    char* name = load ? (char*)malloc(name_length + 1) : NULL;
+    if (!name) {
+        free(load);
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate async load");
+        return 0;
+    }
+    memcpy(name, filename, name_length + 1);
+    if (++RGL.async.next_handle == 0) RGL.async.next_handle = 1;
+    load->handle = RGL.async.next_handle;
+    load->kind = kind;
+    atomic_init(&load->decode_state, RGL_ASYNC_DECODING);
+    load->state = RGL_ASSET_LOADING;
+    load->filename = name;
+    load->generate_mipmaps = generate_mipmaps;
+    load->callback = callback;
+    load->user_data = user_data;
+    RGL.async.loads[RGL.async.count++] = load;
+
+    // 3. --- Decode on the low-priority (IO) queue; if it is full the decode runs here instead ---
+    SituationSubmitJobEx(pool, _RGL_AsyncLoadJob, &load, sizeof(load), SIT_SUBMIT_DEFAULT | SIT_SUBMIT_RUN_IF_FULL);
+    return load->handle;
+}
+
+/**
+ * @brief (INTERNAL) Uploads a decoded load on the render thread. Returns false if the GPU upload failed.
+ */
+static bool _RGL_FinishAsyncLoad(RGLAsyncLoad* load) {
+    if (load->kind == RGL_ASYNC_TEXTURE) {
+        RGLTexture texture = {0};
+        texture.virtual_display_id = -1;
+        bool ok = SituationCreateTexture(load->image, load->generate_mipmaps, &texture.texture) == SITUATION_SUCCESS;
+        SituationUnloadImage(load->image);
+        load->image.data = NULL;
+        if (ok) load->texture = texture;
+        return ok;
+    }
+    RGLVertex3D* gpu_vertices = load->gpu_vertices;
+    load->gpu_vertices = NULL; // Freed by the upload either way
+    return _RGL_UploadDecodedMesh(&load->mesh, gpu_vertices);
+}
+#endif
+
+/**
+ * @brief (INTERNAL) The per-frame half of the async loader, run from RGL_Begin.
+ * Decoded loads are uploaded oldest first until the frame's byte budget is spent; the first upload of a
+ * frame always goes ahead so an asset larger than the budget still finishes. Callbacks fire here, on
+ * the render thread, and may release their own handle.
+ */
+static void _RGL_PumpAsyncLoads(void) {
+#ifdef SITUATION_ENABLE_THREADING
+    if (RGL.async.count == 0) return;
+    size_t budget = RGL.async.upload_budget ? RGL.async.upload_budget : RGL_ASYNC_UPLOAD_BUDGET;
+    size_t spent = 0;
+
+    // 1. --- Upload and notify, in request order ---
+    for (size_t i = 0; i < RGL.async.count; i++) {
+        RGLAsyncLoad* load = RGL.async.loads[i];
+        if (load->released || load->state != RGL_ASSET_LOADING) continue;
+        int decode_state = atomic_load(&load->decode_state);
+        if (decode_state == RGL_ASYNC_DECODING) continue;
+
+        bool success = false;
+        if (decode_state == RGL_ASYNC_DECODED) {
+            if (spent > 0 && spent + load->upload_bytes > budget) break;
+            spent += load->upload_bytes;
+            success = _RGL_FinishAsyncLoad(load);
+        }
+        load->state = success ? RGL_ASSET_READY : RGL_ASSET_FAILED;
+        if (load->callback) load->callback(load->handle, success, load->user_data);
+    }
+    RGL.stats.async_bytes_uploaded = spent;
+
+    // 2. --- Drop released entries ---
+    size_t kept = 0;
+    for (size_t i = 0; i < RGL.async.count; i++) {
+        RGLAsyncLoad* load = RGL.async.loads[i];
+        if (!load->released) { RGL.async.loads[kept++] = load; continue; }
+        int expected = RGL_ASYNC_DECODING;
+        if (atomic_compare_exchange_strong_explicit(&load->decode_state, &expected, RGL_ASYNC_CANCELLED,
+                                                    memory_order_seq_cst, memory_order_seq_cst)) {
+            continue; // Still decoding: the worker frees it when it finishes.
+        }
+        _RGL_FreeAsyncLoad(load);
+    }
+    RGL.async.count = kept;
+#endif
+}
+
+static void _RGL_ShutdownAsyncLoads(void) {
+#ifdef SITUATION_ENABLE_THREADING
+    for (size_t i = 0; i < RGL.async.count; i++) RGL.async.loads[i]->released = true;
+    _RGL_PumpAsyncLoads();
+    free(RGL.async.loads);
+#endif
+    if (RGL.async.placeholder_texture.texture.slot_index != 0) RGL_UnloadTexture(RGL.async.placeholder_texture);
+    RGL_DestroyMesh(&RGL.async.placeholder_mesh);
+    memset(&RGL.async, 0, sizeof(RGL.async));
+}
+
+#ifdef SITUATION_ENABLE_THREADING
+/**
+ * @brief Starts loading a texture without blocking.
+ * The file is read and decoded by a job on the pool's low-priority (IO) queue; the decoded pixels are
+ * uploaded in a later RGL_Begin, within the per-frame budget set by RGL_SetAsyncUploadBudget. Until then
+ * RGL_GetAsyncTexture returns a checkerboard placeholder, so the handle can be drawn with immediately.
+ * @param pool The worker pool that decodes the file.
+ * @param generate_mipmaps Passed to SituationCreateTexture at upload time.
+ * @param callback Optional; called once on the render thread when the load is READY or FAILED.
+ * @return A handle for RGL_GetAsyncTexture / RGL_GetAssetState, or 0 on failure. Release it with RGL_ReleaseAsyncAsset.
+ */
+SITAPI RGLAssetHandle RGL_LoadTextureAsync(SituationThreadPool* pool, const char* filename, bool generate_mipmaps, RGLAssetCallback callback, void* user_data) {
+    return _RGL_SubmitAsyncLoad(pool, RGL_ASYNC_TEXTURE, filename, generate_mipmaps, callback, user_data);
+}
+
+/**
+ * @brief Starts loading an .obj mesh without blocking.
+ * Parsing, interleaving and the shadow-volume adjacency build all run on the pool's IO queue; only the
+ * buffer uploads happen on the render thread, in a later RGL_Begin. Until then RGL_GetAsyncMesh returns
+ * a unit cube placeholder.
+ * @return A handle, or 0 on failure. See RGL_LoadTextureAsync.
+ */
+SITAPI RGLAssetHandle RGL_LoadMeshAsync(SituationThreadPool* pool, const char* filename, RGLAssetCallback callback, void* user_data) {
+    return _RGL_SubmitAsyncLoad(pool, RGL_ASYNC_MESH, filename, false, callback, user_data);
+}
+#endif
+
+/**
+ * @brief Polls an asynchronous load. Released or unknown handles report RGL_ASSET_INVALID.
+ */
+SITAPI RGLAssetState RGL_GetAssetState(RGLAssetHandle handle) {
+    struct RGLAsyncLoad* load = _RGL_FindAsyncLoad(handle);
+#ifdef SITUATION_ENABLE_THREADING
+    if (load) return load->state;
+#else
+    (void)load;
+#endif
+    return RGL_ASSET_INVALID;
+}
+
+/**
+ * @brief Returns an async texture: the real one once READY, otherwise the shared placeholder.
+ * @note The placeholder is owned by RGL; never unload what this returns before the load is READY.
+ */
+SITAPI RGLTexture RGL_GetAsyncTexture(RGLAssetHandle handle) {
+    struct RGLAsyncLoad* load = _RGL_FindAsyncLoad(handle);
+#ifdef SITUATION_ENABLE_THREADING
+    if (load && load->state == RGL_ASSET_READY && load->kind == RGL_ASYNC_TEXTURE) return load->texture;
+#else
+    (void)load;
+#endif
+    return RGL.async.placeholder_texture;
+}
+
+/**
+ * @brief Returns an async mesh: the real one once READY, otherwise the shared unit cube placeholder.
+ * @note The placeholder is owned by RGL; never destroy what this returns before the load is READY.
+ */
+SITAPI RGLMesh RGL_GetAsyncMesh(RGLAssetHandle handle) {
+    struct RGLAsyncLoad* load = _RGL_FindAsyncLoad(handle);
+#ifdef SITUATION_ENABLE_THREADING
+    if (load && load->state == RGL_ASSET_READY && load->kind == RGL_ASYNC_MESH) return load->mesh;
+#else
+    (void)load;
+#endif
+    return RGL.async.placeholder_mesh;
+}
+
+/**
+ * @brief Forgets an async handle.
+ * A READY texture or mesh now belongs to the caller (fetch it first, free it with RGL_UnloadTexture /
+ * RGL_DestroyMesh). A load that has not finished is cancelled: its callback never fires and its decoded
+ * data is discarded. Safe to call from the load's own callback.
+ */
+SITAPI void RGL_ReleaseAsyncAsset(RGLAssetHandle handle) {
+    struct RGLAsyncLoad* load = _RGL_FindAsyncLoad(handle);
+#ifdef SITUATION_ENABLE_THREADING
+    if (load) load->released = true;
+#else
+    (void)load;
+#endif
+}
+
+/**
+ * @brief Sets how many bytes of decoded assets RGL_Begin may upload per frame.
+ * Lower values trade load latency for smoother frames. One asset is always uploaded per frame even if
+ * it alone exceeds the budget. 0 restores the default, RGL_ASYNC_UPLOAD_BUDGET.
+ */
+SITAPI void RGL_SetAsyncUploadBudget(size_t bytes_per_frame) {
+    RGL.async.upload_budget = bytes_per_frame;
+}
+
 // --- Standard Primitives ---
 
 SITAPI RGLMesh RGL_GenMeshPlane(float width, float length, int res_x, int res_z) {
@@ -5271,144 +10590,561 @@ SITAPI RGLMesh RGL_GenMeshRock(float radius, int subdivisions, int seed) {
 }
 
 /**
- * @brief Draws the active level, including walls, flats, and things, with full dynamic lighting.
+ * @brief (INTERNAL) Builds a level's local-to-world matrix (translate, then yaw, pitch, roll).
+ */
+static void _RGL_ComputeLevelTransform(const RGLLevel* level, mat4 out_transform) {
+    glm_mat4_identity(out_transform);
+    glm_translate(out_transform, (float*)level->position);
+    if (level->rotation_eul_deg[1] != 0.0f) glm_rotate_y(out_transform, glm_rad(level->rotation_eul_deg[1]), out_transform);
+    if (level->rotation_eul_deg[0] != 0.0f) glm_rotate_x(out_transform, glm_rad(level->rotation_eul_deg[0]), out_transform);
+    if (level->rotation_eul_deg[2] != 0.0f) glm_rotate_z(out_transform, glm_rad(level->rotation_eul_deg[2]), out_transform);
+}
+
+/**
+ * @brief (INTERNAL) Releases a level's cached GPU geometry and marks it for rebuilding.
+ * A draw of the level still queued this batch refers to the cache, so the batch is flushed first.
+ */
+static void _RGL_FreeLevelStaticGeometry(RGLLevel* level) {
+    int level_index = (int)(level - RGL.levels);
+    for (size_t q = 0; q < RGL.static_level_queue_count; q++) {
+        if (RGL.static_level_queue[q].level_index == level_index) {
+            _RGL_FlushBatch();
+            break;
+        }
+    }
+    if (level->static_vao) glDeleteVertexArrays(1, &level->static_vao);
+    if (level->static_vbo) glDeleteBuffers(1, &level->static_vbo);
+    if (level->static_ibo) glDeleteBuffers(1, &level->static_ibo);
+    free(level->static_ranges);
+    free(level->cells);
+    free(level->cell_things);
+    level->static_vao = level->static_vbo = level->static_ibo = 0;
+    level->static_ranges = NULL;
+    level->static_range_count = 0;
+    level->static_opaque_range_count = 0;
+    level->cells = NULL;
+    level->cell_count = 0;
+    level->cell_things = NULL;
+    level->grid_cols = level->grid_rows = 0;
+    level->geometry_dirty = true;
+}
+
+/**
+ * @brief (INTERNAL) Returns the index of `texture` in a level build's texture table, appending it if needed.
+ * @return The texture index, or -1 on allocation failure.
+ */
+static int _RGL_FindOrAddLevelTexture(RGLTexture** textures, size_t* count, size_t* capacity, RGLTexture texture) {
+    for (size_t t = 0; t < *count; t++) {
+        const SituationTexture* existing = &(*textures)[t].texture;
+        if (existing->slot_index == texture.texture.slot_index && existing->generation == texture.texture.generation) return (int)t;
+    }
+    if (*count >= *capacity) {
+        size_t new_capacity = *capacity == 0 ? 8 : *capacity * 2;
+        RGLTexture* new_textures = realloc(*textures, new_capacity * sizeof(RGLTexture));
+        if (!new_textures) return -1;
+        *textures = new_textures;
+        *capacity = new_capacity;
+    }
+    (*textures)[*count] = texture;
+    return (int)(*count)++;
+}
+
+/**
+ * @brief (INTERNAL) Maps a level-local XZ position to its spatial grid cell (clamped to the grid).
+ */
+static inline uint32_t _RGL_LevelCellIndex(const RGLLevel* level, float x, float z) {
+    int col = (int)((x - level->grid_origin[0]) * level->grid_inv_cell_size[0]);
+    int row = (int)((z - level->grid_origin[1]) * level->grid_inv_cell_size[1]);
+    if (col < 0) col = 0; else if (col >= level->grid_cols) col = level->grid_cols - 1;
+    if (row < 0) row = 0; else if (row >= level->grid_rows) row = level->grid_rows - 1;
+    return (uint32_t)(row * level->grid_cols + col);
+}
+
+/**
+ * @brief (INTERNAL) Tests a cell's bit in a queued RGL_DrawLevel call's visible-cell mask.
+ */
+static inline bool _RGL_IsLevelCellVisible(const uint32_t* visible, uint32_t cell) {
+    return (visible[cell >> 5] >> (cell & 31)) & 1u;
+}
+
+/**
+ * @brief (INTERNAL) Grows a grid cell's world-space bounds to include a point (with optional padding).
+ */
+static inline void _RGL_ExpandLevelCell(RGLLevelCell* cell, const vec3 point, float padding) {
+    for (int a = 0; a < 3; a++) {
+        if (point[a] - padding < cell->bounds_min[a]) cell->bounds_min[a] = point[a] - padding;
+        if (point[a] + padding > cell->bounds_max[a]) cell->bounds_max[a] = point[a] + padding;
+    }
+}
+
+/**
+ * @brief (INTERNAL) Bakes a level's walls and flats into one static, indexed GPU mesh and builds
+ * the level's spatial grid.
+ *
+ * Geometry is generated the same way RGL_CreateMeshFromLevel walks the level (wall quads,
+ * ear-clipped flats), but in the batch vertex format with normals, UVs and brightness, already
+ * transformed to world space. A single scratch buffer is reused for every flat's triangulation.
+ * The staging buffers come from the frame arena, so a level that moves every frame rebuilds
+ * without heap traffic once the arena has grown to fit it.
  *
- * This is the definitive, feature-complete version that:
- * - Uses PushMatrix/PopMatrix to safely apply a world transform to the level without
- *   affecting other draw calls in the frame.
- * - Applies a world transform (position, rotation) to the entire level.
- * - Uses robust ear-clipping triangulation for non-convex floors and ceilings.
- * - Calculates correct surface normals for all geometry to enable dynamic lighting.
- * - Updates the world position of lights attached to "things" within the level.
+ * The level's XZ extent is split into a uniform grid sized for about RGL_LEVEL_GRID_TARGET_ITEMS
+ * walls/flats/things per cell. Each primitive goes to the cell holding its centroid, and each cell
+ * keeps the world-space AABB of what it owns, so culling is one box test per cell. Indices are
+ * ordered texture-major, then by cell, so each (texture, cell) pair is one draw range and
+ * neighbouring visible cells of a texture merge into a single draw.
  *
- * @param level_name The name of the level to draw. If NULL, draws the active level.
+ * @param level The level to build. Its previous cache (if any) is released first.
+ * @param transform The level's local-to-world matrix, baked into the vertices and cell bounds.
+ * @return True on success (including an empty level), false on allocation failure.
  */
-SITAPI void RGL_DrawLevel(void) {
-    // 1. --- PRE-FLIGHT CHECKS ---
-    if (RGL.active_level_index < 0 || RGL.active_level_index >= (int)RGL.level_count) return;
-    RGLLevel* level = &RGL.levels[RGL.active_level_index];
+static bool _RGL_BuildLevelStaticGeometry(RGLLevel* level, mat4 transform) {
+    _RGL_FreeLevelStaticGeometry(level);
+    glm_mat4_copy(transform, level->static_transform);
+
+    // 1. --- Size the buffers (same counting pass as RGL_CreateMeshFromLevel) ---
+    size_t max_vertices = level->wall_count * 4;
+    size_t max_indices = level->wall_count * 6;
+    size_t max_flat_indices = 0;
+    for (size_t i = 0; i < level->flat_count; i++) {
+        size_t n = level->flats[i].vertex_count;
+        if (n < 3) continue;
+        max_vertices += n;
+        max_indices += (n - 2) * 3;
+        if ((n - 2) * 3 > max_flat_indices) max_flat_indices = (n - 2) * 3;
+    }
+    size_t item_count = level->wall_count + level->flat_count + level->thing_count;
+    if (item_count == 0) {
+        level->geometry_dirty = false;
+        return true;
+    }
 
-    // 2. --- SAVE THE CURRENT TRANSFORMATION STATE (CRITICAL) ---
-    // This is the PushMatrix from your original file. It saves the current camera
-    // and transform state so we can safely modify it for the level and then restore it.
-    RGL_PushMatrix();
+    // 2. --- Lay out the spatial grid over the level's local XZ extent ---
+    float min_x = FLT_MAX, min_z = FLT_MAX, max_x = -FLT_MAX, max_z = -FLT_MAX;
+    for (size_t i = 0; i < level->vertex_count; i++) {
+        min_x = fminf(min_x, level->vertices[i].x); max_x = fmaxf(max_x, level->vertices[i].x);
+        min_z = fminf(min_z, level->vertices[i].z); max_z = fmaxf(max_z, level->vertices[i].z);
+    }
+    for (size_t i = 0; i < level->thing_count; i++) {
+        min_x = fminf(min_x, level->things[i].x); max_x = fmaxf(max_x, level->things[i].x);
+        min_z = fminf(min_z, level->things[i].z); max_z = fmaxf(max_z, level->things[i].z);
+    }
+    float extent_x = fmaxf(max_x - min_x, 1.0f);
+    float extent_z = fmaxf(max_z - min_z, 1.0f);
+    float cell_size = sqrtf(extent_x * extent_z * (float)RGL_LEVEL_GRID_TARGET_ITEMS / (float)item_count);
+    level->grid_cols = (int)RGL_Clamp(ceilf(extent_x / cell_size), 1.0f, (float)RGL_LEVEL_GRID_MAX_DIM);
+    level->grid_rows = (int)RGL_Clamp(ceilf(extent_z / cell_size), 1.0f, (float)RGL_LEVEL_GRID_MAX_DIM);
+    level->grid_origin[0] = min_x;
+    level->grid_origin[1] = min_z;
+    level->grid_inv_cell_size[0] = (float)level->grid_cols / extent_x;
+    level->grid_inv_cell_size[1] = (float)level->grid_rows / extent_z;
+    size_t cell_count = (size_t)level->grid_cols * (size_t)level->grid_rows;
+
+    // 3. --- Collect the distinct textures, then allocate every build buffer up front ---
+    RGLTexture* textures = NULL;
+    size_t texture_count = 0, texture_capacity = 0;
+    bool textures_ok = true;
+    for (size_t i = 0; i < level->wall_count && textures_ok; i++) {
+        textures_ok = _RGL_FindOrAddLevelTexture(&textures, &texture_count, &texture_capacity, level->walls[i].texture.texture) >= 0;
+    }
+    for (size_t i = 0; i < level->flat_count && textures_ok; i++) {
+        if (level->flats[i].vertex_count < 3) continue;
+        textures_ok = _RGL_FindOrAddLevelTexture(&textures, &texture_count, &texture_capacity, level->flats[i].texture.texture) >= 0;
+    }
+    // Opaque textures go first, so their ranges form one span ahead of the translucent ones.
+    size_t opaque_texture_count = 0;
+    for (size_t t = 0; t < texture_count; t++) {
+        if (!_RGL_IsLevelTextureOpaque(&textures[t])) continue;
+        RGLTexture swap = textures[t];
+        memmove(&textures[opaque_texture_count + 1], &textures[opaque_texture_count], (t - opaque_texture_count) * sizeof(RGLTexture));
+        textures[opaque_texture_count++] = swap;
+    }
+    size_t key_count = texture_count * cell_count;
+    size_t max_pieces = level->wall_count + level->flat_count;
+
+    // A "piece" is one wall or flat's index run, tagged with its (texture, cell) sort key.
+    typedef struct { uint32_t key; uint32_t first; uint32_t count; } RGLLevelPiece;
+    // Everything but the cells, cell things and ranges the level keeps is frame arena scratch.
+    RGLFrameArenaMark scratch_mark = _RGL_FrameArenaMark();
+    RGLBatchVertex* vertices = (RGLBatchVertex*)_RGL_FrameAlloc(max_vertices * sizeof(RGLBatchVertex));
+    uint32_t* indices = (uint32_t*)_RGL_FrameAlloc(max_indices * sizeof(uint32_t));
+    uint32_t* sorted_indices = (uint32_t*)_RGL_FrameAlloc(max_indices * sizeof(uint32_t));
+    RGLLevelPiece* pieces = (RGLLevelPiece*)_RGL_FrameAlloc(max_pieces * sizeof(RGLLevelPiece));
+    int* flat_triangles = (int*)_RGL_FrameAlloc(max_flat_indices * sizeof(int));
+    uint32_t* key_offsets = (uint32_t*)_RGL_FrameAlloc((key_count + 1) * sizeof(uint32_t));
+    RGLLevelCell* cells = (RGLLevelCell*)malloc(cell_count * sizeof(RGLLevelCell));
+    uint32_t* cell_things = level->thing_count ? (uint32_t*)malloc(level->thing_count * sizeof(uint32_t)) : NULL;
+    RGLLevelDrawRange* ranges = max_pieces ? (RGLLevelDrawRange*)malloc(max_pieces * sizeof(RGLLevelDrawRange)) : NULL; // At most one range per piece
+    if (!textures_ok || (max_vertices && !vertices) || (max_indices && (!indices || !sorted_indices)) ||
+        (max_pieces && (!pieces || !ranges)) || (max_flat_indices && !flat_triangles) || !cells ||
+        (level->thing_count && !cell_things) || !key_offsets) {
+        _RGL_FrameArenaRewind(scratch_mark);
+        free(textures); free(ranges); free(cells); free(cell_things);
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate level geometry cache.");
+        return false;
+    }
+    memset(key_offsets, 0, (key_count + 1) * sizeof(uint32_t));
+    for (size_t c = 0; c < cell_count; c++) {
+        glm_vec3_fill(cells[c].bounds_min, FLT_MAX);
+        glm_vec3_fill(cells[c].bounds_max, -FLT_MAX);
+        cells[c].first_thing = cells[c].thing_count = 0;
+    }
 
-    // 3. --- CALCULATE AND APPLY THE LEVEL'S TRANSFORM (from your original file) ---
-    // This transform will be applied to all subsequent RGL_Draw... calls until we pop.
-    mat4 level_transform;
-    glm_mat4_identity(level_transform);
-    glm_translate(level_transform, level->position);
-    if (level->rotation_eul_deg[1] != 0.0f) glm_rotate_y(level_transform, glm_rad(level->rotation_eul_deg[1]), level_transform);
-    if (level->rotation_eul_deg[0] != 0.0f) glm_rotate_x(level_transform, glm_rad(level->rotation_eul_deg[0]), level_transform);
-    if (level->rotation_eul_deg[2] != 0.0f) glm_rotate_z(level_transform, glm_rad(level->rotation_eul_deg[2]), level_transform);
-
-    // Set this transform for all of the level's geometry.
-    // The `RGL_DrawSpritePro` and other drawing functions will automatically multiply their
-    // vertices by this matrix if `RGL.use_transform` is true.
-    RGL_SetTransform(level_transform);
-
-    // 4. --- DRAW WALLS (with lighting from the patch) ---
+    size_t vertex_count = 0, index_count = 0, piece_count = 0;
+    const vec4 white = {1.0f, 1.0f, 1.0f, 1.0f};
+
+    // 4. --- Walls: one quad each, matching RGL_DrawQuad3D's corner order and sprite UVs ---
     for (size_t i = 0; i < level->wall_count; i++) {
         const RGLWall* wall = &level->walls[i];
         RGLVertex3D_pos v_start = level->vertices[wall->start_vertex];
         RGLVertex3D_pos v_end = level->vertices[wall->end_vertex];
 
-        vec3 p1 = {v_start.x, wall->bottom_y, v_start.z};
-        vec3 p2 = {v_end.x,   wall->bottom_y, v_end.z};
-        vec3 p3 = {v_end.x,   wall->top_y,    v_end.z};
-        vec3 p4 = {v_start.x, wall->top_y,    v_start.z};
-
+        vec3 local[4] = {
+            {v_start.x, wall->top_y,    v_start.z}, // Top-Left
+            {v_start.x, wall->bottom_y, v_start.z}, // Bottom-Left
+            {v_end.x,   wall->bottom_y, v_end.z},   // Bottom-Right
+            {v_end.x,   wall->top_y,    v_end.z}    // Top-Right
+        };
         vec3 edge = {v_end.x - v_start.x, 0.0f, v_end.z - v_start.z};
         vec3 normal;
-        glm_vec3_cross(edge, (vec3){0,1,0}, normal); // normal = edge x up
+        glm_vec3_cross(edge, (vec3){0, 1, 0}, normal); // normal = edge x up
+        glm_mat4_mulv3(transform, normal, 0.0f, normal);
         glm_vec3_normalize(normal);
 
-        // NOTE: The new RGL_DrawQuad3D needs the normal.
-        RGL_DrawQuad3D(p1, p2, p3, p4, normal, wall->texture, WHITE, wall->brightness);
+        const RGLSprite* sprite = &wall->texture;
+        float u1 = 0.0f, v1 = 0.0f, u2 = 1.0f, v2 = 1.0f;
+        if (sprite->texture.texture.slot_index != 0 && sprite->texture.texture.width > 0 && sprite->texture.texture.height > 0) {
+            u1 = sprite->source_rect.x / sprite->texture.texture.width;
+            v1 = sprite->source_rect.y / sprite->texture.texture.height;
+            u2 = (sprite->source_rect.x + sprite->source_rect.width) / sprite->texture.texture.width;
+            v2 = (sprite->source_rect.y + sprite->source_rect.height) / sprite->texture.texture.height;
+        }
+        const vec2 uvs[4] = { {u1, v1}, {u1, v2}, {u2, v2}, {u2, v1} };
+
+        int texture_index = _RGL_FindOrAddLevelTexture(&textures, &texture_count, &texture_capacity, sprite->texture); // Already in the table
+        uint32_t cell = _RGL_LevelCellIndex(level, (v_start.x + v_end.x) * 0.5f, (v_start.z + v_end.z) * 0.5f);
+
+        uint32_t base = (uint32_t)vertex_count;
+        for (int v = 0; v < 4; v++) {
+            vec3 world;
+            glm_mat4_mulv3(transform, local[v], 1.0f, world);
+            _RGL_PackBatchVertex(&vertices[vertex_count++], world, normal, uvs[v], white, wall->brightness);
+            _RGL_ExpandLevelCell(&cells[cell], world, 0.0f);
+        }
+
+        RGLLevelPiece* piece = &pieces[piece_count++];
+        piece->key = (uint32_t)texture_index * (uint32_t)cell_count + cell;
+        piece->first = (uint32_t)index_count;
+        piece->count = 6;
+        const uint32_t quad[6] = {0, 1, 2, 0, 2, 3};
+        for (int k = 0; k < 6; k++) indices[index_count++] = base + quad[k];
     }
 
-    // 5. --- DRAW FLATS (with lighting and robust triangulation) ---
+    // 5. --- Flats: ear-clipped polygons with planar XZ UVs, matching the old per-frame path ---
     for (size_t i = 0; i < level->flat_count; i++) {
-        const RGLFlat* flat = &level->flats[i]; // Corrected access to level->flats
+        const RGLFlat* flat = &level->flats[i];
         if (flat->vertex_count < 3) continue;
 
-        // Determine normal based on vertex winding order (This part is fine)
-        vec3 v0_2d = {level->vertices[flat->vertex_indices[0]].x, level->vertices[flat->vertex_indices[0]].z};
-        vec3 v1_2d = {level->vertices[flat->vertex_indices[1]].x, level->vertices[flat->vertex_indices[1]].z};
-        vec3 v2_2d = {level->vertices[flat->vertex_indices[2]].x, level->vertices[flat->vertex_indices[2]].z};
-        vec2 edge1_2d, edge2_2d;
-        glm_vec2_sub(v1_2d, v0_2d, edge1_2d);
-        glm_vec2_sub(v2_2d, v0_2d, edge2_2d);
-        // Use 2D cross product for winding check (z component of 3D cross product)
-        float cross_z = edge1_2d[0] * edge2_2d[1] - edge1_2d[1] * edge2_2d[0];
-        vec3 normal = {0.0f, (cross_z > 0.0f) ? 1.0f : -1.0f, 0.0f}; // Up or Down normal
-
-        // Use the robust ear-clipping triangulation
-        size_t max_output_indices = (flat->vertex_count - 2) * 3; // Max possible indices
-        int* triangle_indices = malloc(max_output_indices * sizeof(int));
-        if (!triangle_indices) {
-            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate triangle indices for flat drawing.");
-            continue; // Skip this flat
+        size_t triangle_count = 0;
+        if (!_RGL_TriangulateFlat(flat, level->vertices, flat_triangles, &triangle_count)) {
+            _SituationSetWarning("RGL_DrawLevel: Triangulation failed for a flat.");
+            continue;
         }
 
-        size_t triangle_count = 0;
-        // *** PROBLEM FIXED HERE: CALL THE TRIANGULATION FUNCTION ***
-        if (_RGL_TriangulateFlat(flat, level->vertices, triangle_indices, &triangle_count)) {
-            // Now iterate through the INDICES returned by the triangulation
-            for (size_t t_idx = 0; t_idx < triangle_count * 3; t_idx += 3) {
-                // Get the ORIGINAL vertex indices for this triangle
-                int original_v_idx1 = triangle_indices[t_idx];
-                int original_v_idx2 = triangle_indices[t_idx + 1];
-                int original_v_idx3 = triangle_indices[t_idx + 2];
-
-                // Get the actual 3D positions from the level's vertex list, applying the flat's Y
-                vec3 pos[3] = {
-                    {level->vertices[original_v_idx1].x, flat->y, level->vertices[original_v_idx1].z},
-                    {level->vertices[original_v_idx2].x, flat->y, level->vertices[original_v_idx2].z},
-                    {level->vertices[original_v_idx3].x, flat->y, level->vertices[original_v_idx3].z}
-                };
+        // Winding of the first three vertices picks the up/down normal.
+        const RGLVertex3D_pos* a = &level->vertices[flat->vertex_indices[0]];
+        const RGLVertex3D_pos* b = &level->vertices[flat->vertex_indices[1]];
+        const RGLVertex3D_pos* c = &level->vertices[flat->vertex_indices[2]];
+        float cross_z = (b->x - a->x) * (c->z - a->z) - (b->z - a->z) * (c->x - a->x);
+        vec3 normal = {0.0f, (cross_z > 0.0f) ? 1.0f : -1.0f, 0.0f};
+        glm_mat4_mulv3(transform, normal, 0.0f, normal);
+        glm_vec3_normalize(normal);
 
-                // Calculate UVs based on XZ coordinates and flat's scale
-                vec2 uvs[3] = {
-                    {pos[0][0] * flat->u_scale, pos[0][2] * flat->v_scale},
-                    {pos[1][0] * flat->u_scale, pos[1][2] * flat->v_scale},
-                    {pos[2][0] * flat->u_scale, pos[2][2] * flat->v_scale}
-                };
+        int texture_index = _RGL_FindOrAddLevelTexture(&textures, &texture_count, &texture_capacity, flat->texture.texture); // Already in the table
 
-                // Draw the triangle
-                RGL_DrawTriangle3D(pos[0], pos[1], pos[2], normal, uvs[0], uvs[1], uvs[2], flat->texture, WHITE, flat->brightness);
-            }
-        } else {
-            // Triangulation failed (e.g., self-intersecting polygon)
-            _SituationSetWarning("RGL_DrawLevel: Triangulation failed for a flat.");
+        // Planar UVs are shifted by whole texture repeats so they stay near 0: the packed vertex keeps
+        // them as half floats, which would visibly swim and block far from the level's origin.
+        float u_origin = a->x * flat->u_scale, v_origin = a->z * flat->v_scale;
+        for (size_t v = 1; v < flat->vertex_count; v++) {
+            const RGLVertex3D_pos* p = &level->vertices[flat->vertex_indices[v]];
+            u_origin = fminf(u_origin, p->x * flat->u_scale);
+            v_origin = fminf(v_origin, p->z * flat->v_scale);
+        }
+        u_origin = floorf(u_origin);
+        v_origin = floorf(v_origin);
+
+        // Triangle indices refer to level vertices; emit each distinct one once for this flat.
+        float centroid_x = 0.0f, centroid_z = 0.0f;
+        uint32_t base = (uint32_t)vertex_count;
+        size_t first_vertex = vertex_count;
+        for (size_t v = 0; v < flat->vertex_count; v++) {
+            const RGLVertex3D_pos* p = &level->vertices[flat->vertex_indices[v]];
+            vec3 local = {p->x, flat->y, p->z};
+            vec3 world;
+            glm_mat4_mulv3(transform, local, 1.0f, world);
+            vec2 uv = {p->x * flat->u_scale - u_origin, p->z * flat->v_scale - v_origin};
+            _RGL_PackBatchVertex(&vertices[vertex_count++], world, normal, uv, white, flat->brightness);
+            centroid_x += p->x;
+            centroid_z += p->z;
         }
+        uint32_t cell = _RGL_LevelCellIndex(level, centroid_x / (float)flat->vertex_count, centroid_z / (float)flat->vertex_count);
+        for (size_t v = first_vertex; v < vertex_count; v++) _RGL_ExpandLevelCell(&cells[cell], vertices[v].position, 0.0f);
+
+        RGLLevelPiece* piece = &pieces[piece_count++];
+        piece->key = (uint32_t)texture_index * (uint32_t)cell_count + cell;
+        piece->first = (uint32_t)index_count;
+        piece->count = (uint32_t)(triangle_count * 3);
+        for (size_t t = 0; t < triangle_count * 3; t++) {
+            // Map the level vertex index back to its position within this flat's outline.
+            int level_index = flat_triangles[t];
+            size_t local_index = 0;
+            while (local_index < flat->vertex_count && flat->vertex_indices[local_index] != level_index) local_index++;
+            indices[index_count++] = base + (uint32_t)local_index;
+        }
+    }
 
-        // --- Cleanup the temporary indices buffer ---
-        free(triangle_indices);
+    // 6. --- Order indices by (texture, cell) with a counting sort over the pieces ---
+    size_t range_count = 0, opaque_range_count = 0;
+    for (size_t p = 0; p < piece_count; p++) key_offsets[pieces[p].key + 1] += pieces[p].count;
+    for (size_t k = 0; k < key_count; k++) {
+        uint32_t count = key_offsets[k + 1];
+        key_offsets[k + 1] += key_offsets[k];
+        if (count == 0) continue;
+        if (k / cell_count < opaque_texture_count) opaque_range_count++;
+        ranges[range_count++] = (RGLLevelDrawRange){ textures[k / cell_count], (uint32_t)(k % cell_count), key_offsets[k], count };
+    }
+    for (size_t p = 0; p < piece_count; p++) {
+        uint32_t* cursor = &key_offsets[pieces[p].key]; // Advances through the key's slice as pieces are placed
+        memcpy(&sorted_indices[*cursor], &indices[pieces[p].first], pieces[p].count * sizeof(uint32_t));
+        *cursor += pieces[p].count;
     }
 
-    // 6. --- DRAW THINGS (with attached light logic from the patch) ---
+    // 7. --- Bucket things into cells and place their attached lights ---
+    // Things are static between rebuilds, so their lights only need moving here.
+    for (size_t i = 0; i < level->thing_count; i++) {
+        cells[_RGL_LevelCellIndex(level, level->things[i].x, level->things[i].z)].thing_count++;
+    }
+    uint32_t thing_offset = 0;
+    for (size_t c = 0; c < cell_count; c++) {
+        cells[c].first_thing = thing_offset;
+        thing_offset += cells[c].thing_count;
+        cells[c].thing_count = 0; // Reused as the write cursor below
+    }
     for (size_t i = 0; i < level->thing_count; i++) {
         const RGLThing* thing = &level->things[i];
-        vec3 thing_pos = { thing->x, thing->y, thing->z }; // Local position
+        RGLLevelCell* cell = &cells[_RGL_LevelCellIndex(level, thing->x, thing->z)];
+        cell_things[cell->first_thing + cell->thing_count++] = (uint32_t)i;
+
+        vec3 world_thing_pos;
+        glm_mat4_mulv3(transform, (vec3){thing->x, thing->y, thing->z}, 1.0f, world_thing_pos);
+        _RGL_ExpandLevelCell(cell, world_thing_pos, thing->scale * RGL_BILLBOARD_BOUNDS_SCALE);
+        if (thing->attached_light_id > 0) RGL_SetLightPosition(thing->attached_light_id, world_thing_pos);
+    }
+
+    // 8. --- Upload the mesh once as static buffers ---
+    if (index_count > 0) {
+        glGenVertexArrays(1, &level->static_vao);
+        glGenBuffers(1, &level->static_vbo);
+        glGenBuffers(1, &level->static_ibo);
+        glBindBuffer(GL_ARRAY_BUFFER, level->static_vbo);
+        glBufferData(GL_ARRAY_BUFFER, vertex_count * sizeof(RGLBatchVertex), vertices, GL_STATIC_DRAW);
+        _RGL_SetBatchVertexLayout(level->static_vao, level->static_vbo);
+        glBindVertexArray(level->static_vao);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, level->static_ibo);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_count * sizeof(uint32_t), sorted_indices, GL_STATIC_DRAW);
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
 
-        // Update the position of any light attached to this thing
-        if (thing->attached_light_id > 0) {
-            // Transform the thing's local position into world space using the level's transform
-            vec3 world_thing_pos;
-            glm_mat4_mulv3(level_transform, thing_pos, 1.0f, world_thing_pos);
-            RGL_SetLightPosition(thing->attached_light_id, world_thing_pos);
+    _RGL_FrameArenaRewind(scratch_mark);
+    free(textures);
+    level->static_ranges = ranges;
+    level->static_range_count = range_count;
+    level->static_opaque_range_count = opaque_range_count;
+    level->cells = cells;
+    level->cell_count = cell_count;
+    level->cell_things = cell_things;
+    level->geometry_dirty = false;
+    return true;
+}
+
+/**
+ * @brief (INTERNAL) True if baked level geometry with this texture can be drawn without blending.
+ * Level vertices are untinted, so this matches the batcher's test for a command's texture.
+ */
+static inline bool _RGL_IsLevelTextureOpaque(const RGLTexture* texture) {
+    return texture->texture.slot_index == 0 || texture->is_opaque;
+}
+
+/**
+ * @brief (INTERNAL) Draws one span of the cached geometry of every level queued this batch.
+ * Called from _RGL_FlushBatch after the shader, lights and depth state are set up: the opaque span
+ * before the batch, the translucent span between its opaque and alpha buckets (see
+ * _RGL_DrawTranslucentLevelPass). Ranges in culled cells are skipped; consecutive visible ranges of
+ * one texture are contiguous in the index buffer and go out as a single draw.
+ * @param translucent False for the opaque ranges (drawn without blending), true for the rest.
+ */
+static void _RGL_DrawQueuedStaticLevels(bool translucent) {
+    if (translucent) glEnable(GL_BLEND); else glDisable(GL_BLEND);
+    for (size_t q = 0; q < RGL.static_level_queue_count; q++) {
+        int level_index = RGL.static_level_queue[q].level_index;
+        if (level_index < 0 || level_index >= (int)RGL.level_count) continue;
+        const RGLLevel* level = &RGL.levels[level_index];
+        if (!level->static_vao) continue;
+        size_t r = translucent ? level->static_opaque_range_count : 0;
+        size_t range_end = translucent ? level->static_range_count : level->static_opaque_range_count;
+        if (r == range_end) continue;
+        const uint32_t* visible = &RGL.static_level_visibility[RGL.static_level_queue[q].first_visibility_word];
+
+        glBindVertexArray(level->static_vao);
+        while (r < range_end) {
+            const RGLLevelDrawRange* range = &level->static_ranges[r];
+            if (!_RGL_IsLevelCellVisible(visible, range->cell)) { r++; continue; }
+
+            // Merge the following visible ranges of the same texture.
+            uint32_t first_index = range->first_index;
+            uint32_t index_count = range->index_count;
+            size_t next = r + 1;
+            while (next < range_end) {
+                const RGLLevelDrawRange* n = &level->static_ranges[next];
+                if (n->texture.texture.slot_index != range->texture.texture.slot_index ||
+                    n->texture.texture.generation != range->texture.texture.generation ||
+                    !_RGL_IsLevelCellVisible(visible, n->cell) || n->first_index != first_index + index_count) break;
+                index_count += n->index_count;
+                next++;
+            }
+
+            uint32_t slot = range->texture.texture.slot_index;
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, slot);
+            glUniform1i(RGL.loc_use_texture, slot != 0);
+
+            glDrawElements(GL_TRIANGLES, (GLsizei)index_count, GL_UNSIGNED_INT, (void*)(uintptr_t)(first_index * sizeof(uint32_t)));
+            RGL.stats.total_draw_calls++;
+            RGL.stats.total_vertices_drawn += index_count;
+            r = next;
         }
+    }
+}
 
-        // Draw the billboard. It will be correctly transformed by RGL_SetTransform.
-        RGL_DrawBillboard(thing->texture, thing_pos, (vec2){thing->scale, thing->scale}, WHITE);
+/**
+ * @brief (INTERNAL) Draws the queued levels' translucent ranges between the batch's opaque and alpha buckets.
+ * They are depth-tested against the opaque world but write no depth, so opaque geometry and sprites
+ * behind a translucent wall still show through it.
+ * @param bindless True if the batch is drawing bindless; its uniform is switched off for the pass.
+ */
+static void _RGL_DrawTranslucentLevelPass(bool bindless) {
+    if (bindless) glUniform1i(RGL.bindless.loc_enabled, 0);
+    glDepthMask(GL_FALSE);
+    _RGL_DrawQueuedStaticLevels(true);
+    glDepthMask(GL_TRUE);
+    glBindVertexArray(RGL.batch_vao);
+    if (bindless) glUniform1i(RGL.bindless.loc_enabled, 1);
+}
+
+/**
+ * @brief Draws the active level, including walls, flats, and things, with full dynamic lighting.
+ *
+ * Walls and flats are static: the first draw after an edit (RGL_AddVertex/AddWall/AddFlat/AddThing)
+ * or a change of the level's position/rotation bakes them into a cached world-space mesh and
+ * rebuilds the level's spatial grid. Every frame then tests each grid cell's bounds against the
+ * current camera frustum, so only visible geometry and things reach the GPU and the batcher.
+ * The visible walls and flats are queued, and the next flush draws them with one indexed draw per
+ * texture (per contiguous run of visible cells), with no per-frame triangulation or allocation.
+ * Opaque textures (see RGL_SetTextureOpaque) are drawn ahead of the batch; translucent ones are
+ * blended after its opaque bucket without writing depth. Visible things are drawn as billboards through the batch.
+ * Render thread only; it is ignored with a warning while a command or draw list is being recorded.
+ */
+SITAPI void RGL_DrawLevel(void) {
+    // 1. --- PRE-FLIGHT CHECKS ---
+    if (!RGL.is_batching) return;
+    if (g_rgl_recording_list) {
+        // Baking, culling and the static level queue are render-thread state; none of it can be recorded.
+        _SituationSetWarning("RGL_DrawLevel is render-thread only; it cannot be recorded into a command list.");
+        return;
     }
+    if (RGL.active_level_index < 0 || RGL.active_level_index >= (int)RGL.level_count) return;
 
-    // 7. --- RESTORE THE PREVIOUS TRANSFORMATION STATE (CRITICAL) ---
-    // Reset the transform flag so it's not applied to non-level objects.
-    RGL_ResetTransform();
-    // Restore the exact view/projection matrices we had before this function was called.
-    RGL_PopMatrix();
+    RGL_BeginProfileZone("Level");
+    _RGL_QueueActiveLevel(&RGL.levels[RGL.active_level_index]);
+    RGL_EndProfileZone();
+}
+
+/**
+ * @brief (INTERNAL) The body of RGL_DrawLevel: culls a level's grid and queues its visible geometry.
+ */
+static void _RGL_QueueActiveLevel(RGLLevel* level) {
+    // 2. --- Compute the level's transform and revalidate the cache ---
+    mat4 level_transform;
+    _RGL_ComputeLevelTransform(level, level_transform);
+    if (level->geometry_dirty || memcmp(level_transform, level->static_transform, sizeof(mat4)) != 0) {
+        if (!_RGL_BuildLevelStaticGeometry(level, level_transform)) return;
+    }
+    if (level->cell_count == 0) return;
+
+    // 3. --- Reserve this call's visible-cell mask (masks restart with each batch) ---
+    if (RGL.static_level_queue_count == 0) RGL.static_level_visibility_count = 0;
+    size_t mask_words = (level->cell_count + 31) / 32;
+    if (RGL.static_level_visibility_count + mask_words > RGL.static_level_visibility_capacity) {
+        size_t new_capacity = RGL.static_level_visibility_capacity ? RGL.static_level_visibility_capacity : 64;
+        while (new_capacity < RGL.static_level_visibility_count + mask_words) new_capacity *= 2;
+        uint32_t* new_masks = realloc(RGL.static_level_visibility, new_capacity * sizeof(uint32_t));
+        if (!new_masks) {
+            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to grow static level visibility masks.");
+            return;
+        }
+        RGL.static_level_visibility = new_masks;
+        RGL.static_level_visibility_capacity = new_capacity;
+        RGL.stats.memory_reallocations++;
+    }
+    uint32_t* visible = &RGL.static_level_visibility[RGL.static_level_visibility_count];
+    memset(visible, 0, mask_words * sizeof(uint32_t));
+
+    // 4. --- Cull grid cells against the current view frustum ---
+    vec4 frustum_planes[6];
+    mat4 view_proj;
+    glm_mat4_mul(RGL.current_projection_matrix, RGL.current_view_matrix, view_proj);
+    _RGL_ExtractFrustumPlanes(view_proj, frustum_planes);
+    bool any_visible = false;
+    for (size_t c = 0; c < level->cell_count; c++) {
+        const RGLLevelCell* cell = &level->cells[c];
+        if (cell->bounds_min[0] <= cell->bounds_max[0] &&
+            _RGL_FrustumIntersectsAABB(frustum_planes, cell->bounds_min, cell->bounds_max)) {
+            visible[c >> 5] |= 1u << (c & 31);
+            any_visible = true;
+        }
+    }
+    if (!any_visible) return;
+
+    // 5. --- Queue the cached walls and flats, with this view's mask, for the next flush ---
+    if (level->static_vao) {
+        if (RGL.static_level_queue_count >= RGL.static_level_queue_capacity) {
+            size_t new_capacity = RGL.static_level_queue_capacity == 0 ? 4 : RGL.static_level_queue_capacity * 2;
+            RGLQueuedLevel* new_queue = realloc(RGL.static_level_queue, new_capacity * sizeof(RGLQueuedLevel));
+            if (!new_queue) {
+                _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to grow static level queue.");
+                return;
+            }
+            RGL.static_level_queue = new_queue;
+            RGL.static_level_queue_capacity = new_capacity;
+        }
+        RGLQueuedLevel* entry = &RGL.static_level_queue[RGL.static_level_queue_count++];
+        entry->level_index = RGL.active_level_index;
+        entry->first_visibility_word = (uint32_t)RGL.static_level_visibility_count;
+        RGL.static_level_visibility_count += mask_words;
+    }
+
+    // 6. --- DRAW THINGS in visible cells ---
+    for (size_t c = 0; c < level->cell_count; c++) {
+        const RGLLevelCell* cell = &level->cells[c];
+        if (!_RGL_IsLevelCellVisible(visible, (uint32_t)c)) continue;
+        for (uint32_t t = 0; t < cell->thing_count; t++) {
+            const RGLThing* thing = &level->things[level->cell_things[cell->first_thing + t]];
+            vec3 world_thing_pos;
+            glm_mat4_mulv3(level_transform, (vec3){thing->x, thing->y, thing->z}, 1.0f, world_thing_pos);
+            if (!_RGL_FrustumIntersectsSphere(frustum_planes, world_thing_pos, thing->scale * RGL_BILLBOARD_BOUNDS_SCALE, 0.0f)) continue;
+            RGL_DrawBillboard(thing->texture, world_thing_pos, (vec2){thing->scale, thing->scale}, WHITE);
+        }
+    }
 }
 
 // --- Debug visualization ---
@@ -5530,17 +11266,17 @@ SITAPI bool RGL_PlaceLevelOnPath(const char* level_name, const char* path_name,
         return false;
     }
 
-    // Temporarily set the active Path to get its properties
-    int original_active_Path = RGL.active_Path_index;
-    if (!RGL_SetActivePath(path_name)) {
-        RGL.active_Path_index = original_active_Path; // Restore original
-        return false; // RGL_SetActivePath already set the error
+    // Query the named Path directly; the active Path and its bookmark are left alone.
+    int path_idx = _RGL_FindPathIndex(path_name);
+    if (path_idx == -1) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_NOT_FOUND, "No Path with the specified name was found.");
+        return false;
     }
 
     // Get the properties of the Path at the specified Z
+    RGLPathCursor cursor = {0};
     RGLPathPoint props;
-    if (!RGL_GetPathPropertiesAt(path_z, &props)) {
-        RGL.active_Path_index = original_active_Path; // Restore original
+    if (!RGL_GetPathPropertiesAtEx(path_idx, path_z, &cursor, &props)) {
         _SituationSetErrorFromCode(SITUATION_ERROR_NOT_FOUND, "Could not get Path properties at specified Z-position.");
         return false;
     }
@@ -5558,7 +11294,7 @@ SITAPI bool RGL_PlaceLevelOnPath(const char* level_name, const char* path_name,
     // To orient the level with the Path, we need the Path's direction (tangent).
     // We can approximate this by looking at a point slightly ahead on the path.
     RGLPathPoint props_ahead;
-    if (RGL_GetPathPropertiesAt(path_z + 1.0f, &props_ahead)) {
+    if (RGL_GetPathPropertiesAtEx(path_idx, path_z + 1.0f, &cursor, &props_ahead)) {
         vec2 tangent = { props_ahead.world_x_offset - props.world_x_offset, 1.0f };
         glm_vec2_normalize(tangent);
         float Path_yaw_rads = atan2f(tangent[0], tangent[1]); // atan2(x, z) gives yaw
@@ -5570,9 +11306,6 @@ SITAPI bool RGL_PlaceLevelOnPath(const char* level_name, const char* path_name,
         level->rotation_eul_deg[1] = yaw_offset_degrees;
     }
 
-    // Restore the original active Path
-    RGL.active_Path_index = original_active_Path;
-
     return true;
 }
 
@@ -5614,7 +11347,9 @@ SITAPI void RGL_DrawPath(float player_z, int draw_distance) {
     // This is the dynamic dispatch. The code "jumps" to the address stored in
     // 'draw_path_func' and executes it. By default, this address points to
     // our internal _RGL_DrawPathScene_Road function.
+    RGL_BeginProfileZone("Path");
     style->draw_path_func(player_z, draw_distance, style->user_data);
+    RGL_EndProfileZone();
 }
 
 
@@ -5682,18 +11417,17 @@ SITAPI void RGL_DrawPanoramaBackground(RGLTexture texture, float scroll_offset_x
     SituationConvertColorToVec4(tint, norm_color);
     float u_width = (float)width / (float)texture.texture.width;
 
-    // BUGFIX: Vertex format is 10 floats.
-    float vertices[] = {
-        // pos.xyz, uv.xy, color.rgba, light
-        // Triangle 1
-        0.0f,      0.0f,       0.0f,  scroll_offset_x,           y_offset_pct,                      norm_color[0], norm_color[1], norm_color[2], norm_color[3], 1.0f,
-        0.0f,      (float)height, 0.0f,  scroll_offset_x,           y_offset_pct + height_scale,       norm_color[0], norm_color[1], norm_color[2], norm_color[3], 1.0f,
-        (float)width, 0.0f,       0.0f,  scroll_offset_x + u_width, y_offset_pct,                      norm_color[0], norm_color[1], norm_color[2], norm_color[3], 1.0f,
-        // Triangle 2
-        0.0f,      (float)height, 0.0f,  scroll_offset_x,           y_offset_pct + height_scale,       norm_color[0], norm_color[1], norm_color[2], norm_color[3], 1.0f,
-        (float)width, (float)height, 0.0f,  scroll_offset_x + u_width, y_offset_pct + height_scale,       norm_color[0], norm_color[1], norm_color[2], norm_color[3], 1.0f,
-        (float)width, 0.0f,       0.0f,  scroll_offset_x + u_width, y_offset_pct,                      norm_color[0], norm_color[1], norm_color[2], norm_color[3], 1.0f
-    };
+    // Vertices go into the reserved head of the batch VBO, in the batch vertex format.
+    const float w = (float)width, h = (float)height;
+    const float u0 = scroll_offset_x, u1 = scroll_offset_x + u_width;
+    const float v0 = y_offset_pct, v1 = y_offset_pct + height_scale;
+    const vec3 positions[6] = { {0.0f, 0.0f, 0.0f}, {0.0f, h, 0.0f}, {w, 0.0f, 0.0f}, {0.0f, h, 0.0f}, {w, h, 0.0f}, {w, 0.0f, 0.0f} };
+    const vec2 uvs[6]       = { {u0, v0}, {u0, v1}, {u1, v0}, {u0, v1}, {u1, v1}, {u1, v0} };
+    const vec3 normal = {0.0f, 0.0f, 1.0f};
+    RGLBatchVertex vertices[6];
+    for (int i = 0; i < 6; i++) {
+        _RGL_PackBatchVertex(&vertices[i], positions[i], normal, uvs[i], norm_color, 1.0f);
+    }
 
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, texture.texture.slot_index);
@@ -6255,6 +11989,7 @@ SITAPI void RGL_RegisterSceneryStyle(RGLSceneryType type, const RGLSceneryStyle*
 
 /**
  * @brief Finds all scenery objects on the active Path within a given Z-axis range.
+ * Runs in O(log n + k) over the path's scenery index, which is rebuilt on the first query after an edit.
  * @param start_z The starting Z-coordinate of the search range.
  * @param end_z The ending Z-coordinate of the search range.
  * @param out_scenery An array of pointers to RGLScenery structs to store the results.
@@ -6267,49 +12002,27 @@ SITAPI int RGL_FindSceneryInRange(float start_z, float end_z, RGLScenery* out_sc
         return 0;
     }
 
-    // 2. --- Get Active Path Context ---
+    // 2. --- Get Active Path Context and its index ---
     RGLPathData* Path = _RGL_GetActivePathData();
-    if (!Path || Path->num_points == 0) {
+    if (!Path || Path->num_points == 0 || !_RGL_BuildSceneryIndex(Path)) {
         return 0;
     }
 
-    // 3. --- Efficiently Find Starting Point ---
-    // Uses the O(log n) binary search helper for excellent performance.
-    int start_idx = _RGL_FindPathPointIndexAt(Path->points, Path->num_points, start_z);
-    if (start_idx == -1) {
-        return 0; // The entire path is before the start_z.
-    }
-
-    // 4. --- Linear Scan Through Relevant Segment ---
+    // 3. --- Binary-search the anchors in range, then copy them out in path order ---
+    const RGLSceneryIndex* index = &Path->scenery_index;
+    const uint32_t* ids;
+    size_t end;
     int found_count = 0;
-    for (size_t i = start_idx; i < Path->num_points; i++) {
-        RGLPathPoint* p = &Path->points[i];
-
-        // Stop scanning once we've passed the end of the range.
-        if (p->world_z > end_z) {
-            break;
-        }
-
-        // Check all three scenery slots for this path point.
-        if (p->scenery_left.type != RGL_SCENERY_NONE) {
-            out_scenery[found_count++] = &p->scenery_left;
-            if (found_count >= max_scenery) return found_count; // Buffer full, exit early.
-        }
-        if (p->scenery_right.type != RGL_SCENERY_NONE) {
-            out_scenery[found_count++] = &p->scenery_right;
-            if (found_count >= max_scenery) return found_count;
-        }
-        if (p->scenery_overhead.type != RGL_SCENERY_NONE) {
-            out_scenery[found_count++] = &p->scenery_overhead;
-            if (found_count >= max_scenery) return found_count;
-        }
+    for (size_t i = _RGL_ScenerySpan(index, RGL_SCENERY_NONE, start_z, end_z, &ids, &end); i < end; i++) {
+        out_scenery[found_count++] = _RGL_GetAnchorScenery(Path, &index->anchors[i]);
+        if (found_count >= max_scenery) break; // Buffer full, exit early.
     }
-
     return found_count;
 }
 
 /**
  * @brief Finds all scenery objects on the active Path within a 3D spherical radius.
+ * Only the anchors inside the sphere's Z slab are tested, using positions resolved when the index was built.
  * @param world_pos The 3D world-space center of the search sphere.
  * @param radius The radius of the search sphere.
  * @param out_scenery An array of pointers to RGLScenery structs to store the results.
@@ -6320,41 +12033,20 @@ SITAPI int RGL_FindSceneryInRadius(vec3 world_pos, float radius, RGLScenery* out
     if (!out_objects || max_objects <= 0 || radius <= 0) return 0;
 
     RGLPathData* Path = _RGL_GetActivePathData();
-    if (!Path || Path->num_points == 0) return 0;
+    if (!Path || Path->num_points == 0 || !_RGL_BuildSceneryIndex(Path)) return 0;
 
+    const RGLSceneryIndex* index = &Path->scenery_index;
+    const uint32_t* ids;
+    size_t end;
     int found_count = 0;
     float radius_sq = radius * radius;
-    float min_z = world_pos[2] - radius;
-    float max_z = world_pos[2] + radius;
-
-    int start_idx = _RGL_FindPathPointIndexAt(Path->points, Path->num_points, min_z);
-    if (start_idx == -1) start_idx = 0;
-
-    for (int i = start_idx; i < Path->num_points; i++) {
-        RGLPathPoint* p = &Path->points[i];
-        if (p->world_z > max_z) break;
-
-        RGLScenery* scenery_slots[] = { &p->scenery_left, &p->scenery_right, &p->scenery_overhead };
-
-        for (int j = 0; j < 3; j++) {
-            RGLScenery* s = scenery_slots[j];
-            if (s->type == RGL_SCENERY_NONE) continue;
-
-            // CORRECTED, SUPERIOR LOGIC:
-            vec3 scenery_pos;
-            scenery_pos[0] = p->world_x_offset + s->x_offset * (p->primary_ribbon_width * 0.5f);
-            scenery_pos[1] = p->world_y_offset + s->y_offset;
-            scenery_pos[2] = p->world_z;
-
-            if (glm_vec3_distance2(world_pos, scenery_pos) < radius_sq) {
-                out_objects[found_count++] = s;
-                if (found_count >= max_objects) {
-                    return found_count;
-                }
-            }
+    for (size_t i = _RGL_ScenerySpan(index, RGL_SCENERY_NONE, world_pos[2] - radius, world_pos[2] + radius, &ids, &end); i < end; i++) {
+        const RGLSceneryAnchor* anchor = &index->anchors[i];
+        if (glm_vec3_distance2(world_pos, (float*)anchor->world_pos) < radius_sq) {
+            out_objects[found_count++] = _RGL_GetAnchorScenery(Path, anchor);
+            if (found_count >= max_objects) break;
         }
     }
-
     return found_count;
 }
 
@@ -6392,6 +12084,7 @@ SITAPI bool RGL_CreatePath(const char* path_name) {
     new_path_entry->data.style = RGL_GetDefaultRoadStyle(); // Assign default style on creation
 
     RGL.Path_count++;
+    RGL.path_topology_version++; // Junctions naming this path can now resolve to it
 
     if (RGL.Path_count == 1) {
         RGL.active_Path_index = 0;
@@ -6412,6 +12105,59 @@ SITAPI bool RGL_SetPathLooping(const char* path_name, float z_pos) {
     return true;
 }
 
+/**
+ * @brief Enables distance-based level of detail for a named path.
+ * Both built-in road styles read it. The CPU road merges far segments (their edges stay on the sample
+ * grid, so merged segments do not swim as the player drives) and fades the lane lines and rumble strips
+ * out at their cutoffs. Both styles cut and fade scenery, and draw far sprite scenery as instanced
+ * impostor quads. The horizon is unchanged: the window still reaches draw_distance segments.
+ * @param path_name The name of the Path to modify.
+ * @param lod The settings (copied), or NULL to draw every segment and feature at full detail again.
+ * @return True on success, false if the Path is not found or a setting is negative.
+ */
+SITAPI bool RGL_SetPathLOD(const char* path_name, const RGLPathLOD* lod) {
+    int index = _RGL_FindPathIndex(path_name);
+    if (index == -1) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_NOT_FOUND, "Cannot set LOD: Path not found.");
+        return false;
+    }
+    RGLPathData* path = &RGL.Paths[index].data;
+    if (!lod) {
+        path->lod_enabled = false;
+        return true;
+    }
+    if (lod->full_detail_distance < 0.0f || lod->line_distance < 0.0f || lod->rumble_distance < 0.0f ||
+        lod->scenery_distance < 0.0f || lod->impostor_distance < 0.0f || lod->fade_distance < 0.0f) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_INVALID_PARAM, "RGL_SetPathLOD: distances must not be negative.");
+        return false;
+    }
+
+    path->lod = *lod;
+    // Only power-of-two steps keep every merged edge on the edges of the finer steps nearer the camera.
+    int step = 1;
+    while (step * 2 <= lod->max_segment_step && step < 1024) step *= 2;
+    path->lod.max_segment_step = step;
+    path->lod_enabled = true;
+    return true;
+}
+
+/**
+ * @brief Returns LOD settings suited to the default camera: full detail for the first 150 units,
+ * segments up to 8 samples long beyond, lines and rumbles faded out by 250 and 400 units, and sprite
+ * scenery drawn as impostors past 300 units. Scenery is kept out to the horizon.
+ */
+SITAPI RGLPathLOD RGL_GetDefaultPathLOD(void) {
+    RGLPathLOD lod = {0};
+    lod.full_detail_distance = 150.0f;
+    lod.max_segment_step = 8;
+    lod.line_distance = 250.0f;
+    lod.rumble_distance = 400.0f;
+    lod.scenery_distance = 0.0f;
+    lod.impostor_distance = 300.0f;
+    lod.fade_distance = 50.0f;
+    return lod;
+}
+
 /**
  * @brief Destroys a specific named Path and frees its associated memory.
  * If the Path being destroyed is currently active, the active Path index will be
@@ -6427,7 +12173,11 @@ SITAPI bool RGL_DestroyPathByName(const char* path_name) {
         return false;
     }
 
-    free(RGL.Paths[index].data.points);
+    _RGL_FreePathPoints(&RGL.Paths[index].data);
+    _RGL_FreePathSamples(&RGL.Paths[index].data);
+    _RGL_FreeSceneryIndex(&RGL.Paths[index].data);
+    _RGL_FreeGPURoad(&RGL.Paths[index].data);
+    RGL.path_topology_version++; // The paths after this one shift down, so resolved junction targets go stale
 
     if (RGL.active_Path_index == index) {
         RGL.active_Path_index = -1;
@@ -6469,6 +12219,27 @@ SITAPI const RGLPathStyle* RGL_GetDefaultRoadStyle(void) {
     return &RGL_DEFAULT_ROAD_STYLE;
 }
 
+// The GPU road preset: same look as the default road, expanded by the vertex shader.
+static const RGLPathStyle RGL_GPU_ROAD_STYLE = {
+    .draw_path_func = _RGL_DrawPathScene_GPURoad,
+    .user_data = NULL
+};
+
+/**
+ * @brief [Helper] Returns the built-in road style whose geometry is generated on the GPU.
+ *
+ * It draws the same surface, shoulders, dashed lane lines and split road as the default style, but the
+ * path's samples and appearance live in storage buffers (uploaded once, and again only after an edit),
+ * and the vertex shader expands RGL_GPU_ROAD_QUADS_PER_SEGMENT quads per segment from gl_VertexID.
+ * The CPU cost of a frame no longer grows with the draw distance: one draw per window with bindless
+ * textures, otherwise up to three per run of segments sharing their textures. Scenery is drawn as before.
+ * @note Draws are render-thread only; while recording a command list this style falls back to the CPU road.
+ *       Lane lines are drawn for up to 8 primary lanes.
+ */
+SITAPI const RGLPathStyle* RGL_GetGPURoadStyle(void) {
+    return &RGL_GPU_ROAD_STYLE;
+}
+
 /**
  * @brief Assigns a custom visual style to a named path.
  * After calling this, any subsequent calls to RGL_DrawPath (or wrappers like RGL_DrawPathAsRoad)
@@ -6504,15 +12275,14 @@ SITAPI void RGL_AddPathPoint(const char* path_name, RGLPathPoint point) {
 
     if (Path->num_points >= Path->capacity) {
         size_t new_capacity = (Path->capacity == 0) ? 256 : Path->capacity * 2;
-        RGLPathPoint* new_points = realloc(Path->points, sizeof(RGLPathPoint) * new_capacity);
-        if (!new_points) {
+        if (!_RGL_ReservePathPoints(Path, new_capacity)) {
              _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to reallocate Path points buffer.");
             return;
         }
-        Path->points = new_points;
-        Path->capacity = new_capacity;
     }
-    Path->points[Path->num_points++] = point;
+    _RGL_StorePathPoint(Path, Path->num_points++, &point);
+    Path->samples.valid = false;
+    Path->scenery_index.valid = false;
 }
 
 /**
@@ -6539,7 +12309,7 @@ SITAPI bool RGL_GetPathPoint(const char* path_name, int index, RGLPathPoint* out
     RGLPathData* data = &RGL.Paths[path_idx].data;
     if (index < 0 || index >= data->num_points) return false;
 
-    if (out_point) *out_point = data->points[index];
+    if (out_point) _RGL_LoadPathPoint(data, index, out_point);
     return true;
 }
 
@@ -6550,7 +12320,9 @@ SITAPI bool RGL_SetPathPoint(const char* path_name, int index, RGLPathPoint poin
     RGLPathData* data = &RGL.Paths[path_idx].data;
     if (index < 0 || index >= data->num_points) return false;
 
-    data->points[index] = point;
+    _RGL_StorePathPoint(data, index, &point);
+    data->samples.valid = false;
+    data->scenery_index.valid = false;
     return true;
 }
 
@@ -6561,13 +12333,21 @@ SITAPI bool RGL_RemovePathPoint(const char* path_name, int index) {
     RGLPathData* data = &RGL.Paths[path_idx].data;
     if (index < 0 || index >= data->num_points) return false;
 
-    // Shift remaining points down
+    // Shift remaining points down in every per-point array
     size_t points_to_move = data->num_points - index - 1;
     if (points_to_move > 0) {
-        memmove(&data->points[index], &data->points[index + 1], points_to_move * sizeof(RGLPathPoint));
+        float* geometry[] = { data->world_z, data->x_offset, data->y_offset, data->roll_degrees,
+                              data->ribbon_width, data->split_offset, data->split_width, data->rumble_width };
+        for (size_t i = 0; i < sizeof(geometry) / sizeof(geometry[0]); i++) {
+            memmove(&geometry[i][index], &geometry[i][index + 1], points_to_move * sizeof(float));
+        }
+        memmove(&data->appearance[index], &data->appearance[index + 1], points_to_move * sizeof(RGLPathAppearance));
+        memmove(&data->scenery[index], &data->scenery[index + 1], points_to_move * sizeof(RGLPathScenery));
     }
 
     data->num_points--;
+    data->samples.valid = false;
+    data->scenery_index.valid = false;
     return true;
 }
 
@@ -6580,81 +12360,12 @@ SITAPI const char* RGL_GetActivePathName(void) {
 
 SITAPI bool RGL_GetPathPropertiesAt(float z_pos, RGLPathPoint* out_point) {
     RGLPathData* Path = _RGL_GetActivePathData();
-    if (!Path || Path->num_points < 4) {
+    if (!Path || Path->num_points < 4 || !out_point) {
         return false;
     }
 
-    if (Path->loop_to_z >= 0.0f) {
-        float last_z = Path->points[Path->num_points - 1].world_z;
-        if (z_pos > last_z) {
-            float path_length = last_z - Path->loop_to_z;
-            if (path_length > 0.001f) {
-                 z_pos = fmodf(z_pos - Path->loop_to_z, path_length) + Path->loop_to_z;
-            }
-        }
-    }
-
-    // --- Segment Search on the active Path ---
-    // Start our search from the active Path's "sticky bookmark".
-    int p1_idx = Path->last_segment_index_cache;
-
-    // Search forward (most common case).
-    while (p1_idx < Path->num_points - 1 && Path->points[p1_idx + 1].world_z <= z_pos) {
-        p1_idx++;
-    }
-
-    // Search backward (less common case).
-    while (p1_idx > 0 && Path->points[p1_idx].world_z > z_pos) {
-        p1_idx--;
-    }
-
-    // Update the active Path's "sticky bookmark" for the next frame.
-    Path->last_segment_index_cache = p1_idx;
-
-    // --- Interpolation (now operates on the active Path's points) ---
-    int p0_idx = p1_idx - 1;
-    int p2_idx = p1_idx + 1;
-    int p3_idx = p1_idx + 2;
-
-    p0_idx = (p0_idx < 0) ? 0 : p0_idx;
-    p1_idx = (p1_idx < 0) ? 0 : p1_idx;
-    p2_idx = (p2_idx >= Path->num_points) ? Path->num_points - 1 : p2_idx;
-    p3_idx = (p3_idx >= Path->num_points) ? Path->num_points - 1 : p3_idx;
-
-    // All point lookups now use the 'Path->points' array.
-    RGLPathPoint p0 = Path->points[p0_idx];
-    RGLPathPoint p1 = Path->points[p1_idx];
-    RGLPathPoint p2 = Path->points[p2_idx];
-    RGLPathPoint p3 = Path->points[p3_idx];
-
-    float segment_length_z = p2.world_z - p1.world_z;
-    float t = (segment_length_z > 0.0001f) ? (z_pos - p1.world_z) / segment_length_z : 0.0f;
-    t = fmaxf(0.0f, fminf(1.0f, t));
-
-    out_point->world_z = z_pos;
-    out_point->world_x_offset       = _catmull_rom(p0.world_x_offset, p1.world_x_offset, p2.world_x_offset, p3.world_x_offset, t);
-    out_point->world_y_offset       = _catmull_rom(p0.world_y_offset, p1.world_y_offset, p2.world_y_offset, p3.world_y_offset, t);
-    out_point->path_roll_degrees    = _lerp(p1.path_roll_degrees, p2.path_roll_degrees, t);
-    out_point->primary_ribbon_width        = _lerp(p1.primary_ribbon_width, p2.primary_ribbon_width, t);
-    out_point->split_offset         = _lerp(p1.split_offset, p2.split_offset, t);
-    out_point->split_width          = _lerp(p1.split_width, p2.split_width, t);
-    out_point->rumble_width         = _lerp(p1.rumble_width, p2.rumble_width, t);
-    out_point->split_offset         = _lerp(p1.split_offset, p2.split_offset, t);
-    out_point->split_width          = _lerp(p1.split_width, p2.split_width, t);
-
-    out_point->split_surface_texture   = p1.split_surface_texture;
-    out_point->split_surface_color     = p1.split_surface_color;
-    out_point->split_lanes          = p1.split_lanes;
-    out_point->primary_lanes        = p1.primary_lanes;
-    out_point->surface_texture         = p1.surface_texture;
-    out_point->color_surface           = p1.color_surface;
-    out_point->color_rumble         = p1.color_rumble;
-    out_point->color_lines          = p1.color_lines;
-    out_point->scenery_left         = p1.scenery_left;
-    out_point->scenery_right        = p1.scenery_right;
-    out_point->scenery_overhead     = p1.scenery_overhead;
-    out_point->user_tag             = p1.user_tag;
-
+    // The active Path's "sticky bookmark" is the cursor; RGL_GetPathPropertiesAtEx leaves it alone.
+    _RGL_EvaluatePathPoint(Path, z_pos, &Path->last_segment_index_cache, out_point);
     return true;
 }
 
@@ -6670,53 +12381,14 @@ SITAPI bool RGL_GetPathPropertiesAt(float z_pos, RGLPathPoint* out_point) {
 SITAPI bool RGL_GetGroundAt(vec2 world_xz, RGLGroundInfo* out_info) {
     if (!out_info) return false;
 
-    RGLPathPoint props;
-    if (!RGL_GetPathPropertiesAt(world_xz[1], &props)) {
+    // Read the cached curve samples instead of re-evaluating the spline per query.
+    RGLPathSample props;
+    if (!_RGL_SamplePathAt(_RGL_GetActivePathData(), world_xz[1], &props)) {
         out_info->is_hit = false;
         return false;
     }
 
-    out_info->is_hit = true;
-    out_info->ground_y = props.world_y_offset;
-    out_info->type = RGL_GROUND_TYPE_OFF_PATH;
-
-    float Path_center_x = props.world_x_offset;
-    float primary_half_width = props.primary_ribbon_width * 0.5f;
-    float primary_rumble_half_width = primary_half_width + props.rumble_width;
-    float dx_primary = world_xz[0] - Path_center_x;
-
-    // Check primary Path
-    if (fabsf(dx_primary) < primary_rumble_half_width) {
-        float lateral_offset = (primary_half_width > 0.01f) ? dx_primary / primary_half_width : 0.0f;
-        _RGL_CalculateBankedSurface(&props, lateral_offset, out_info->surface_normal);
-
-        // Adjust ground height based on banking (outer edge of a banked turn is higher)
-        float banking_height_offset = sinf(glm_rad(props.path_roll_degrees)) * dx_primary;
-        out_info->ground_y += banking_height_offset;
-
-        out_info->type = (fabsf(dx_primary) < primary_half_width) ? RGL_GROUND_TYPE_PATH : RGL_GROUND_TYPE_SHOULDER;
-        return true;
-    }
-
-    // Check split Path
-    if (props.split_width > 0.01f) {
-        float split_center_x = props.world_x_offset + props.split_offset;
-        float split_half_width = props.split_width * 0.5f;
-        float split_rumble_half_width = split_half_width + props.rumble_width;
-        float dx_split = world_xz[0] - split_center_x;
-
-        if (fabsf(dx_split) < split_rumble_half_width) {
-            float lateral_offset = (split_half_width > 0.01f) ? dx_split / split_half_width : 0.0f;
-            _RGL_CalculateBankedSurface(&props, lateral_offset, out_info->surface_normal);
-            float banking_height_offset = sinf(glm_rad(props.path_roll_degrees)) * dx_split;
-            out_info->ground_y += banking_height_offset;
-            out_info->type = (fabsf(dx_split) < split_half_width) ? RGL_GROUND_TYPE_PATH : RGL_GROUND_TYPE_SHOULDER;
-            return true;
-        }
-    }
-
-    // Off-Path: use a flat normal
-    glm_vec3_copy((vec3){0.0f, 1.0f, 0.0f}, out_info->surface_normal);
+    _RGL_ClassifyGround(&props, world_xz[0], out_info);
     return true;
 }
 
@@ -6733,23 +12405,23 @@ SITAPI void RGL_UpdatePathScenery(float player_z, float view_distance) {
     if (!Path || Path->num_points < 2) return;
 
     // Determine the range of path points to check
-    int start_idx = _RGL_FindPathPointIndexAt(Path->points, Path->num_points, player_z);
+    int start_idx = _RGL_FindPathPointIndexAt(Path->world_z, Path->num_points, player_z);
     if (start_idx == -1) start_idx = 0;
 
-    int end_idx = _RGL_FindPathPointIndexAt(Path->points, Path->num_points, player_z + view_distance);
+    int end_idx = _RGL_FindPathPointIndexAt(Path->world_z, Path->num_points, player_z + view_distance);
     if (end_idx == -1) end_idx = Path->num_points - 1;
 
     // Lambda helper function to process a single scenery object
-    auto void process_scenery(RGLScenery* scenery, RGLPathPoint* p) {
+    auto void process_scenery(RGLScenery* scenery, int i) {
         if (scenery->type == RGL_SCENERY_LIGHT_SOURCE) {
             // If the light hasn't been created in the RGL system yet...
             if (scenery->data.light.light_id == 0) {
                 // Calculate its absolute world position using the parent path point.
                 // This is the CRITICAL step that was missing.
                 vec3 pos = {
-                    p->world_x_offset + scenery->x_offset,
-                    p->world_y_offset + scenery->y_offset,
-                    p->world_z
+                    Path->x_offset[i] + scenery->x_offset,
+                    Path->y_offset[i] + scenery->y_offset,
+                    Path->world_z[i]
                 };
 
                 // Create the light and store its ID back in the scenery data.
@@ -6767,10 +12439,10 @@ SITAPI void RGL_UpdatePathScenery(float player_z, float view_distance) {
 
     // Iterate through the visible segment of the path and process all scenery slots
     for (int i = start_idx; i <= end_idx; i++) {
-        RGLPathPoint* p = &Path->points[i];
-        process_scenery(&p->scenery_left, p);
-        process_scenery(&p->scenery_right, p);
-        process_scenery(&p->scenery_overhead, p);
+        RGLPathScenery* p = &Path->scenery[i];
+        process_scenery(&p->left, i);
+        process_scenery(&p->right, i);
+        process_scenery(&p->overhead, i);
     }
 }
 
@@ -6934,52 +12606,61 @@ static void _RGL_DrawPathScene_Road(float player_z, int draw_distance, void* use
     (void)user_data; // This default implementation doesn't use custom data.
 
     RGLPathData* path = _RGL_GetActivePathData();
-    if (!path || path->num_points < 2) {
+    if (!path || !_RGL_BuildPathSamples(path)) {
         return;
     }
 
     // --- 1. Looping Logic ---
     // Handle seamless looping by wrapping the player's Z-position if the path is configured to loop.
-    if (path->loop_to_z >= 0.0f) {
-        float last_z = path->points[path->num_points - 1].world_z;
-        if (player_z > last_z) {
-            float path_length = last_z - path->loop_to_z;
-            if (path_length > 0.001f) {
-                player_z = fmodf(player_z - path->loop_to_z, path_length) + path->loop_to_z;
-            }
-        }
-    }
+    player_z = _RGL_WrapPathZ(path, player_z);
 
-    const float segment_length = 5.0f;
+    const float segment_length = RGL_PATH_SAMPLE_SPACING;
+
+    // Segment edges are snapped to the sample grid so every edge is a direct cache read, and
+    // each edge is read once: the near edge of one segment is the far edge of the next.
+    int base_index = (int)floorf((player_z - path->samples.start_z) / segment_length);
+    float base_z = path->samples.start_z + base_index * segment_length;
+    RGLPathSample prop_far;
+    float z_far = base_z + draw_distance * segment_length;
+    _RGL_SamplePathAt(path, z_far, &prop_far);
 
     // --- 2. Main Drawing Loop (Far to Near) for Road Geometry ---
     // We iterate from the farthest visible segment towards the camera for correct alpha blending.
+    // With LOD, far edges that are not on their distance's coarser grid are skipped, so one quad spans
+    // several samples; the far edge of the window is always kept, so the horizon does not move.
     for (int i = draw_distance; i > 0; i--) {
-        RGLPathPoint prop_near, prop_far;
-        float z_near = player_z + (i - 1) * segment_length;
-        float z_far  = player_z + i * segment_length;
+        float z_near = base_z + (i - 1) * segment_length;
+        float distance = z_near - player_z;
+        if (i > 1 && !_RGL_IsPathLODEdge(path, base_index + i - 1, distance)) continue;
+
+        RGLPathSample prop_near;
+        _RGL_SamplePathAt(path, z_near, &prop_near);
+        float line_fade = 1.0f, rumble_fade = 1.0f;
+        if (path->lod_enabled) {
+            line_fade = _RGL_PathLODFade(path->lod.line_distance, path->lod.fade_distance, distance);
+            rumble_fade = _RGL_PathLODFade(path->lod.rumble_distance, path->lod.fade_distance, distance);
+        }
 
-        // Interpolate path properties at the start and end of the segment.
-        if (!RGL_GetPathPropertiesAt(z_near, &prop_near)) continue;
-        if (!RGL_GetPathPropertiesAt(z_far, &prop_far)) continue;
+        // Lanes, colors and textures come from the control point the near edge belongs to.
+        const RGLPathAppearance* look = &path->appearance[prop_near.point_index];
 
         // Calculate the surface normal for lighting, based on the banking of the near point.
         vec3 normal;
-        _RGL_CalculateBankedSurface(&prop_near, 0.0f, normal);
+        _RGL_CalculateBankedNormal(prop_near.roll_degrees, normal);
 
         // --- RENDER THE PRIMARY ROAD SURFACE ---
-        vec3 p1 = {prop_near.world_x_offset - prop_near.primary_ribbon_width * 0.5f, prop_near.world_y_offset, z_near};
-        vec3 p2 = {prop_far.world_x_offset  - prop_far.primary_ribbon_width  * 0.5f, prop_far.world_y_offset,  z_far};
-        vec3 p3 = {prop_far.world_x_offset  + prop_far.primary_ribbon_width  * 0.5f, prop_far.world_y_offset,  z_far};
-        vec3 p4 = {prop_near.world_x_offset + prop_near.primary_ribbon_width * 0.5f, prop_near.world_y_offset, z_near};
+        vec3 p1 = {prop_near.x_offset - prop_near.ribbon_width * 0.5f, prop_near.y_offset, z_near};
+        vec3 p2 = {prop_far.x_offset  - prop_far.ribbon_width  * 0.5f, prop_far.y_offset,  z_far};
+        vec3 p3 = {prop_far.x_offset  + prop_far.ribbon_width  * 0.5f, prop_far.y_offset,  z_far};
+        vec3 p4 = {prop_near.x_offset + prop_near.ribbon_width * 0.5f, prop_near.y_offset, z_near};
 
         // Alternate road color for a subtle segment definition effect.
-        Color road_color = ((int)(z_near / 10.0f) % 2 == 0) ? prop_near.color_surface : (Color){60,60,60,255};
-        _RGL_DrawPathQuad(p1, p2, p3, p4, normal, prop_near.surface_texture, road_color);
+        Color road_color = ((int)(z_near / 10.0f) % 2 == 0) ? look->color_surface : (Color){60,60,60,255};
+        _RGL_DrawPathQuad(p1, p2, p3, p4, normal, look->surface_texture, road_color);
 
         // --- RENDER RUMBLE STRIPS / SHOULDERS ---
-        if (prop_near.rumble_width > 0.0f) {
-            Color rumble_color = ((int)(z_near / 5.0f) % 2 == 0) ? prop_near.color_rumble : WHITE;
+        if (prop_near.rumble_width > 0.0f && rumble_fade > 0.0f) {
+            Color rumble_color = _RGL_FadeColor(((int)(z_near / 5.0f) % 2 == 0) ? look->color_rumble : WHITE, rumble_fade);
             float rumble_w = prop_near.rumble_width;
 
             // Left shoulder
@@ -6994,51 +12675,446 @@ static void _RGL_DrawPathScene_Road(float player_z, int draw_distance, void* use
         }
 
         // --- RENDER LANE MARKINGS ---
-        if (prop_near.primary_lanes > 1 && ((int)(z_near / 4.0f) % 2 != 0)) { // Dashed lines effect
-            float lane_width = prop_near.primary_ribbon_width / prop_near.primary_lanes;
+        if (look->primary_lanes > 1 && line_fade > 0.0f && ((int)(z_near / 4.0f) % 2 != 0)) { // Dashed lines effect
+            float lane_width = prop_near.ribbon_width / look->primary_lanes;
             float line_half_w = 0.15f;
-            for(int j = 1; j < prop_near.primary_lanes; ++j) {
-                float x_offset = -prop_near.primary_ribbon_width * 0.5f + j * lane_width;
-                vec3 l1 = {prop_near.world_x_offset + x_offset - line_half_w, prop_near.world_y_offset + 0.01f, z_near};
-                vec3 l2 = {prop_far.world_x_offset  + x_offset - line_half_w, prop_far.world_y_offset  + 0.01f, z_far};
-                vec3 l3 = {prop_far.world_x_offset  + x_offset + line_half_w, prop_far.world_y_offset  + 0.01f, z_far};
-                vec3 l4 = {prop_near.world_x_offset + x_offset + line_half_w, prop_near.world_y_offset + 0.01f, z_near};
-                _RGL_DrawPathQuad(l1, l2, l3, l4, normal, (RGLSprite){0}, prop_near.color_lines);
+            Color line_color = _RGL_FadeColor(look->color_lines, line_fade);
+            for(int j = 1; j < look->primary_lanes; ++j) {
+                float x_offset = -prop_near.ribbon_width * 0.5f + j * lane_width;
+                vec3 l1 = {prop_near.x_offset + x_offset - line_half_w, prop_near.y_offset + 0.01f, z_near};
+                vec3 l2 = {prop_far.x_offset  + x_offset - line_half_w, prop_far.y_offset  + 0.01f, z_far};
+                vec3 l3 = {prop_far.x_offset  + x_offset + line_half_w, prop_far.y_offset  + 0.01f, z_far};
+                vec3 l4 = {prop_near.x_offset + x_offset + line_half_w, prop_near.y_offset + 0.01f, z_near};
+                _RGL_DrawPathQuad(l1, l2, l3, l4, normal, (RGLSprite){0}, line_color);
+            }
+        }
+
+        // --- RENDER THE SPLIT ROAD ---
+        if (prop_near.split_width > 0.01f) {
+            float split_x_near = prop_near.x_offset + prop_near.split_offset;
+            float split_x_far  = prop_far.x_offset  + prop_far.split_offset;
+            vec3 s1 = {split_x_near - prop_near.split_width * 0.5f, prop_near.y_offset, z_near};
+            vec3 s2 = {split_x_far  - prop_far.split_width  * 0.5f, prop_far.y_offset,  z_far};
+            vec3 s3 = {split_x_far  + prop_far.split_width  * 0.5f, prop_far.y_offset,  z_far};
+            vec3 s4 = {split_x_near + prop_near.split_width * 0.5f, prop_near.y_offset, z_near};
+            Color split_color = ((int)(z_near/10.f)%2 == 0) ? look->split_surface_color : (Color){50,50,50,255};
+            _RGL_DrawPathQuad(s1, s2, s3, s4, normal, look->split_surface_texture, split_color);
+        }
+
+        prop_far = prop_near;
+        z_far = z_near;
+    }
+
+    // --- 3. Scenery Drawing Loop ---
+    // This is kept separate from the road geometry loop to ensure all scenery
+    // is drawn on top of the road surface, respecting depth.
+    // After the loop, prop_far holds the sample nearest the camera.
+    _RGL_DrawPathSceneryWindow(path, player_z, draw_distance, prop_far.point_index);
+}
+
+/**
+ * @brief (INTERNAL) Draws the scenery of a road window back-to-front, from the control point at the far
+ * end of the window down to `start_idx` (the point of the sample nearest the camera).
+ */
+static void _RGL_DrawPathSceneryWindow(RGLPathData* path, float player_z, int draw_distance, int start_idx) {
+    const float segment_length = RGL_PATH_SAMPLE_SPACING;
+    if (start_idx < 0) start_idx = 0;
+
+    // Find the farthest visible path point index.
+    int far_idx = _RGL_FindPathPointIndexAt(path->world_z, path->num_points, player_z + draw_distance * segment_length);
+    if (far_idx == -1) far_idx = path->num_points - 1;
+
+    // Iterate backwards from the farthest point to draw scenery back-to-front.
+    for (int i = far_idx; i >= start_idx; i--) {
+        if (path->world_z[i] < player_z - 50.0f) break; // Simple culling for objects behind the camera
+
+        float distance = path->world_z[i] - player_z;
+        RGLPathScenery* current = &path->scenery[i];
+        if (current->left.type != RGL_SCENERY_NONE) _RGL_DrawPathSceneryLOD(path, i, &current->left, distance);
+        if (current->right.type != RGL_SCENERY_NONE) _RGL_DrawPathSceneryLOD(path, i, &current->right, distance);
+        if (current->overhead.type != RGL_SCENERY_NONE) _RGL_DrawPathSceneryLOD(path, i, &current->overhead, distance);
+    }
+
+    _RGL_FlushPathImpostors();
+}
+
+// --- Path LOD ---
+
+static int _RGL_PathLODStep(const RGLPathData* path, float distance) {
+    if (!path->lod_enabled || path->lod.full_detail_distance <= 0.0f) return 1;
+    int step = 1;
+    float threshold = path->lod.full_detail_distance;
+    while (distance >= threshold && step < path->lod.max_segment_step) {
+        step *= 2;
+        threshold *= 2.0f;
+    }
+    return step;
+}
+
+static bool _RGL_IsPathLODEdge(const RGLPathData* path, int grid_index, float distance) {
+    int step = _RGL_PathLODStep(path, distance);
+    if (step <= 1) return true;
+    // Edges are picked on the absolute sample grid, not relative to the window, so a kept edge stays
+    // kept while the window slides forward; only edges crossing a step threshold change.
+    int phase = grid_index % step;
+    if (phase < 0) phase += step;
+    return phase == 0;
+}
+
+static float _RGL_PathLODFade(float cutoff, float fade_distance, float distance) {
+    if (cutoff <= 0.0f) return 1.0f;
+    if (fade_distance <= 0.0f) return distance < cutoff ? 1.0f : 0.0f;
+    return glm_clamp((cutoff - distance) / fade_distance, 0.0f, 1.0f);
+}
+
+static Color _RGL_FadeColor(Color color, float fade) {
+    if (fade < 1.0f) color.a = (unsigned char)((float)color.a * fade + 0.5f);
+    return color;
+}
+
+/**
+ * @brief (INTERNAL) Draws one scenery object of a road window under the path's LOD settings.
+ * Only the built-in sprite style can be faded or turned into an impostor, since a custom style's
+ * callback has no tint to fade; custom styles still honor the scenery cutoff.
+ */
+static void _RGL_DrawPathSceneryLOD(const RGLPathData* path, size_t index, RGLScenery* scenery, float distance) {
+    if (!path->lod_enabled) {
+        _RGL_DrawPathScenery(path, index, scenery);
+        return;
+    }
+
+    // 1. --- Cutoff ---
+    float fade = _RGL_PathLODFade(path->lod.scenery_distance, path->lod.fade_distance, distance);
+    if (fade <= 0.0f) return;
+
+    bool is_sprite = scenery->type < RGL_MAX_SCENERY_TYPES && g_scenery_styles[scenery->type] == &g_default_sprite_style;
+    if (!is_sprite) {
+        _RGL_DrawPathScenery(path, index, scenery);
+        return;
+    }
+
+    vec3 world_pos;
+    _RGL_GetPathSceneryPosition(path, index, scenery, world_pos);
+    Color tint = _RGL_FadeColor(WHITE, fade);
+
+    // 2. --- Near sprites: a faded billboard through the batch ---
+    // Impostors are queued instanced draws, which only exist on the render thread.
+    bool impostor = path->lod.impostor_distance > 0.0f && distance >= path->lod.impostor_distance &&
+                    RGL.is_batching && !g_rgl_recording_list;
+    if (!impostor) {
+        RGL_DrawBillboardCylindricalY(scenery->data.visual.sprite, world_pos, scenery->data.visual.size_in_world_units, tint);
+        return;
+    }
+
+    // 3. --- Far sprites: gathered, then drawn as one Y-locked instanced quad draw per sprite ---
+    // Same orientation and lighting as the batched billboard above, so crossing the threshold does not pop.
+    // Translucent sprites land in the flush's blended instance pass: over the road, under the near
+    // sprites of the alpha bucket, and without writing depth, so their edges leave no halo.
+    if (RGL.path_impostors.count == RGL.path_impostors.capacity) {
+        size_t new_capacity = RGL.path_impostors.capacity > 0 ? RGL.path_impostors.capacity * 2 : 256;
+        RGLPathImpostor* items = (RGLPathImpostor*)realloc(RGL.path_impostors.items, new_capacity * sizeof(RGLPathImpostor));
+        if (!items) {
+            RGL_DrawBillboardCylindricalY(scenery->data.visual.sprite, world_pos, scenery->data.visual.size_in_world_units, tint);
+            return;
+        }
+        RGL.path_impostors.items = items;
+        RGL.path_impostors.capacity = new_capacity;
+        RGL.stats.memory_reallocations++;
+    }
+    RGLPathImpostor* item = &RGL.path_impostors.items[RGL.path_impostors.count++];
+    item->sprite = scenery->data.visual.sprite;
+    glm_vec3_copy(world_pos, item->position);
+    glm_vec2_copy(scenery->data.visual.size_in_world_units, item->size);
+    item->tint = tint;
+    item->distance = distance;
+}
+
+static int _RGL_ComparePathImpostorSprites(const RGLPathImpostor* a, const RGLPathImpostor* b) {
+    const RGLSprite* sa = &a->sprite;
+    const RGLSprite* sb = &b->sprite;
+    if (sa->texture.texture.slot_index != sb->texture.texture.slot_index) {
+        return sa->texture.texture.slot_index < sb->texture.texture.slot_index ? -1 : 1;
+    }
+    return memcmp(&sa->source_rect, &sb->source_rect, sizeof(sa->source_rect));
+}
+
+static int _RGL_ComparePathImpostors(const void* a, const void* b) {
+    const RGLPathImpostor* ia = (const RGLPathImpostor*)a;
+    const RGLPathImpostor* ib = (const RGLPathImpostor*)b;
+    int sprite_order = _RGL_ComparePathImpostorSprites(ia, ib);
+    if (sprite_order != 0) return sprite_order;
+    // Within a run, instances are drawn in buffer order: far first, so faded edges blend over what is behind.
+    if (ia->distance != ib->distance) return ia->distance > ib->distance ? -1 : 1;
+    return 0;
+}
+
+static void _RGL_FlushPathImpostors(void) {
+    size_t count = RGL.path_impostors.count;
+    if (count == 0) return;
+    RGL.path_impostors.count = 0;
+
+    // 1. --- Staging arrays for one run, sized to the largest gather so far ---
+    if (RGL.path_impostors.run_capacity < count) {
+        size_t new_capacity = RGL.path_impostors.capacity;
+        vec3* positions = (vec3*)realloc(RGL.path_impostors.positions, new_capacity * sizeof(vec3));
+        if (positions) RGL.path_impostors.positions = positions;
+        vec2* sizes = (vec2*)realloc(RGL.path_impostors.sizes, new_capacity * sizeof(vec2));
+        if (sizes) RGL.path_impostors.sizes = sizes;
+        Color* tints = (Color*)realloc(RGL.path_impostors.tints, new_capacity * sizeof(Color));
+        if (tints) RGL.path_impostors.tints = tints;
+        if (!positions || !sizes || !tints) {
+            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to grow the path impostor buffers.");
+            return;
+        }
+        RGL.path_impostors.run_capacity = new_capacity;
+        RGL.stats.memory_reallocations++;
+    }
+
+    // 2. --- Group by sprite, then one instanced draw per group ---
+    RGLPathImpostor* items = RGL.path_impostors.items;
+    qsort(items, count, sizeof(RGLPathImpostor), _RGL_ComparePathImpostors);
+    size_t first = 0;
+    while (first < count) {
+        size_t end = first + 1;
+        while (end < count && _RGL_ComparePathImpostorSprites(&items[first], &items[end]) == 0) end++;
+        for (size_t i = first; i < end; i++) {
+            glm_vec3_copy(items[i].position, RGL.path_impostors.positions[i - first]);
+            glm_vec2_copy(items[i].size, RGL.path_impostors.sizes[i - first]);
+            RGL.path_impostors.tints[i - first] = items[i].tint;
+        }
+        RGL_DrawBillboardCylindricalYInstanced(items[first].sprite, RGL.path_impostors.positions, RGL.path_impostors.sizes,
+                                               RGL.path_impostors.tints, (int)(end - first));
+        first = end;
+    }
+}
+
+// --- GPU Road ---
+
+/**
+ * @brief (INTERNAL) The drawing function of the GPU road style (see RGL_GetGPURoadStyle).
+ * The window is snapped to the sample grid exactly like _RGL_DrawPathScene_Road, so both styles draw
+ * the same segments; only who builds the quads differs.
+ */
+static void _RGL_DrawPathScene_GPURoad(float player_z, int draw_distance, void* user_data) {
+    RGLPathData* path = _RGL_GetActivePathData();
+    if (!path || draw_distance <= 0 || !_RGL_BuildPathSamples(path)) return;
+
+    // 1. --- Fall back to the CPU road where no GL draw can be queued ---
+    if (g_rgl_recording_list || !RGL.is_batching || !_RGL_UploadGPURoad(path)) {
+        _RGL_DrawPathScene_Road(player_z, draw_distance, user_data);
+        return;
+    }
+
+    // 2. --- Describe the window ---
+    player_z = _RGL_WrapPathZ(path, player_z);
+    const float segment_length = RGL_PATH_SAMPLE_SPACING;
+    float base_z = path->samples.start_z + floorf((player_z - path->samples.start_z) / segment_length) * segment_length;
+
+    RGLGPURoadDraw window = {0};
+    window.sample_ssbo = path->gpu_road.sample_ssbo;
+    window.point_ssbo = path->gpu_road.point_ssbo;
+    glm_vec4_copy((vec4){base_z, path->samples.start_z, segment_length, (float)path->samples.count}, window.params);
+    window.loop[0] = path->loop_to_z;
+    window.loop[1] = path->world_z[path->num_points - 1];
+    window.window_segments = (uint32_t)draw_distance;
+
+    // 3. --- Draw what the frame submitted so far, so the road keeps its place in the frame ---
+    _RGL_FlushBatch();
+
+    // 4. --- Queue the runs ---
+    RGLPathSample near_edge;
+    _RGL_SamplePathAt(path, base_z, &near_edge);
+    if (path->gpu_road.bindless) {
+        window.first_segment = 0;
+        window.segment_count = window.window_segments;
+        window.layers = RGL_GPU_ROAD_LAYER_ALL;
+        window.bindless = true;
+        const vec4 full_uv = {0.0f, 0.0f, 1.0f, 1.0f};
+        RGLTexture no_texture = {0};
+        RGLInstanceData* slot = _RGL_QueueInstancedDraw(3, -1, no_texture, full_uv, 1, false);
+        if (slot) {
+            RGL.instancing.draws[RGL.instancing.draw_count - 1].road = window;
+            glm_mat4_identity(slot->model);
+            glm_vec4_one(slot->tint);
+        }
+    } else if (path->gpu_road.single_texture_pair) {
+        _RGL_QueueGPURoadRun(path, &window, 0, window.window_segments, 0);
+    } else {
+        // Segment s (counted from the far end) takes its textures from its near edge, as on the CPU.
+        uint32_t run_start = 0;
+        RGLPathSample edge;
+        _RGL_SamplePathAt(path, base_z + (draw_distance - 1) * segment_length, &edge);
+        int run_point = edge.point_index;
+        for (uint32_t seg = 1; seg <= window.window_segments; seg++) {
+            int point = -1;
+            if (seg < window.window_segments) {
+                _RGL_SamplePathAt(path, base_z + (float)(window.window_segments - 1 - seg) * segment_length, &edge);
+                point = edge.point_index;
+                const RGLPathAppearance* a = &path->appearance[point];
+                const RGLPathAppearance* b = &path->appearance[run_point];
+                if (a->surface_texture.texture.texture.slot_index == b->surface_texture.texture.texture.slot_index &&
+                    a->split_surface_texture.texture.texture.slot_index == b->split_surface_texture.texture.texture.slot_index) continue;
             }
+            _RGL_QueueGPURoadRun(path, &window, run_start, seg - run_start, run_point);
+            run_start = seg;
+            run_point = point;
         }
+    }
 
-        // --- RENDER THE SPLIT ROAD ---
-        if (prop_near.split_width > 0.01f) {
-            float split_x_near = prop_near.world_x_offset + prop_near.split_offset;
-            float split_x_far  = prop_far.world_x_offset  + prop_far.split_offset;
-            vec3 s1 = {split_x_near - prop_near.split_width * 0.5f, prop_near.world_y_offset, z_near};
-            vec3 s2 = {split_x_far  - prop_far.split_width  * 0.5f, prop_far.world_y_offset,  z_far};
-            vec3 s3 = {split_x_far  + prop_far.split_width  * 0.5f, prop_far.world_y_offset,  z_far};
-            vec3 s4 = {split_x_near + prop_near.split_width * 0.5f, prop_near.world_y_offset, z_near};
-            Color split_color = ((int)(z_near/10.f)%2 == 0) ? prop_near.split_surface_color : (Color){50,50,50,255};
-            _RGL_DrawPathQuad(s1, s2, s3, s4, normal, prop_near.split_surface_texture, split_color);
-        }
+    // 5. --- Scenery, through the batch as with the CPU road ---
+    _RGL_DrawPathSceneryWindow(path, player_z, draw_distance, near_edge.point_index);
+}
+
+/**
+ * @brief (INTERNAL) Queues the draws of one run of segments sharing surface and split textures.
+ * Without bindless the fragment shader samples one bound texture per draw, so the textured surface
+ * and split layers get their own draws and everything untextured shares a third.
+ */
+static void _RGL_QueueGPURoadRun(const RGLPathData* path, RGLGPURoadDraw* window, uint32_t first_segment, uint32_t segment_count, int point) {
+    const RGLPathAppearance* look = &path->appearance[point];
+    RGLTexture surface = look->surface_texture.texture;
+    RGLTexture split = look->split_surface_texture.texture;
+    RGLTexture no_texture = {0};
+    RGLTexture textures[3] = { surface, split, no_texture };
+    uint32_t layers[3] = { 0, 0, RGL_GPU_ROAD_LAYER_SHOULDERS | RGL_GPU_ROAD_LAYER_LINES };
+
+    if (surface.texture.slot_index != 0) layers[0] |= RGL_GPU_ROAD_LAYER_SURFACE;
+    else layers[2] |= RGL_GPU_ROAD_LAYER_SURFACE;
+    if (split.texture.slot_index == 0) layers[2] |= RGL_GPU_ROAD_LAYER_SPLIT;
+    else if (split.texture.slot_index == surface.texture.slot_index) layers[0] |= RGL_GPU_ROAD_LAYER_SPLIT;
+    else layers[1] |= RGL_GPU_ROAD_LAYER_SPLIT;
+
+    window->first_segment = first_segment;
+    window->segment_count = segment_count;
+    window->bindless = false;
+    const vec4 full_uv = {0.0f, 0.0f, 1.0f, 1.0f};
+    for (int i = 0; i < 3; i++) {
+        if (layers[i] == 0) continue;
+        RGLInstanceData* slot = _RGL_QueueInstancedDraw(3, -1, textures[i], full_uv, 1, false);
+        if (!slot) return;
+        window->layers = layers[i];
+        RGL.instancing.draws[RGL.instancing.draw_count - 1].road = *window;
+        glm_mat4_identity(slot->model);
+        glm_vec4_one(slot->tint);
     }
+}
 
-    // --- 3. Scenery Drawing Loop ---
-    // This is kept separate from the road geometry loop to ensure all scenery
-    // is drawn on top of the road surface, respecting depth.
-    int start_idx = path->last_segment_index_cache;
-    if (start_idx < 0) start_idx = 0;
+/**
+ * @brief (INTERNAL) Uploads a path's samples and per-point appearance to its GPU road buffers.
+ * Runs only when the sample cache was rebuilt since the last upload, or when a bindless texture was
+ * released since its indices were baked (one may now name another texture); a run of this path still
+ * queued this frame is drawn first, since it refers to the old contents.
+ * @return True if the buffers are current, false if the path has too few points or allocation failed.
+ */
+static bool _RGL_UploadGPURoad(RGLPathData* path) {
+    if (!_RGL_BuildPathSamples(path)) return false;
+    RGLPathGPURoad* road = &path->gpu_road;
+    if (road->valid && road->bindless && road->bindless_generation != RGL.bindless.table_generation) road->valid = false;
+    if (road->valid) return true;
+
+    // 1. --- Allocate the staging copies from the frame arena ---
+    const RGLPathSamples* samples = &path->samples;
+    RGLFrameArenaMark scratch_mark = _RGL_FrameArenaMark();
+    RGLGPURoadSample* gpu_samples = (RGLGPURoadSample*)_RGL_FrameAlloc(sizeof(RGLGPURoadSample) * samples->count);
+    RGLGPURoadPoint* gpu_points = (RGLGPURoadPoint*)_RGL_FrameAlloc(sizeof(RGLGPURoadPoint) * path->num_points);
+    if (!gpu_samples || !gpu_points) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to stage GPU road buffers.");
+        _RGL_FrameArenaRewind(scratch_mark);
+        return false;
+    }
 
-    // Find the farthest visible path point index.
-    int far_idx = _RGL_FindPathPointIndexAt(path->points, path->num_points, player_z + draw_distance * segment_length);
-    if (far_idx == -1) far_idx = path->num_points - 1;
+    // 2. --- Pack the samples ---
+    for (size_t i = 0; i < samples->count; i++) {
+        RGLGPURoadSample* out = &gpu_samples[i];
+        out->geometry[0] = samples->x_offset[i];
+        out->geometry[1] = samples->y_offset[i];
+        out->geometry[2] = samples->roll_degrees[i];
+        out->geometry[3] = samples->ribbon_width[i];
+        out->extra[0] = samples->split_offset[i];
+        out->extra[1] = samples->split_width[i];
+        out->extra[2] = samples->rumble_width[i];
+        out->point_index = samples->point_index[i];
+    }
+
+    // 3. --- Pack the appearance, resolving textures to UV rects and bindless indices ---
+    road->bindless = RGL.bindless.enabled;
+    road->bindless_generation = RGL.bindless.table_generation;
+    road->single_texture_pair = true;
+    const RGLPathAppearance* first = &path->appearance[0];
+    for (size_t i = 0; i < path->num_points; i++) {
+        const RGLPathAppearance* look = &path->appearance[i];
+        RGLGPURoadPoint* out = &gpu_points[i];
+        const RGLSprite* sprites[2] = { &look->surface_texture, &look->split_surface_texture };
+        float* uvs[2] = { out->surface_uv, out->split_uv };
+        for (int j = 0; j < 2; j++) {
+            // Same mapping as RGL_DrawQuad3D
+            const SituationTexture* texture = &sprites[j]->texture.texture;
+            uvs[j][0] = 0.0f; uvs[j][1] = 0.0f; uvs[j][2] = 1.0f; uvs[j][3] = 1.0f;
+            out->info[1 + j] = 0;
+            if (texture->slot_index == 0) continue;
+            if (texture->width > 0 && texture->height > 0) {
+                uvs[j][0] = sprites[j]->source_rect.x / texture->width;
+                uvs[j][1] = sprites[j]->source_rect.y / texture->height;
+                uvs[j][2] = (sprites[j]->source_rect.x + sprites[j]->source_rect.width) / texture->width;
+                uvs[j][3] = (sprites[j]->source_rect.y + sprites[j]->source_rect.height) / texture->height;
+            }
+            if (road->bindless) {
+                out->info[1 + j] = _RGL_GetBindlessTextureIndex(texture);
+                if (out->info[1 + j] == 0) road->bindless = false;
+            }
+        }
+        const Color colors[4] = { look->color_surface, look->color_rumble, look->color_lines, look->split_surface_color };
+        for (int j = 0; j < 4; j++) {
+            out->colors[j] = (uint32_t)colors[j].r | ((uint32_t)colors[j].g << 8) | ((uint32_t)colors[j].b << 16) | ((uint32_t)colors[j].a << 24);
+        }
+        out->info[0] = (uint32_t)(look->primary_lanes > 0 ? look->primary_lanes : 0);
+        out->info[3] = 0;
+        if (look->surface_texture.texture.texture.slot_index != first->surface_texture.texture.texture.slot_index ||
+            look->split_surface_texture.texture.texture.slot_index != first->split_surface_texture.texture.texture.slot_index) {
+            road->single_texture_pair = false;
+        }
+    }
 
-    // Iterate backwards from the farthest point to draw scenery back-to-front.
-    for (int i = far_idx; i >= start_idx; i--) {
-        RGLPathPoint* current_point = &path->points[i];
-        if (current_point->world_z < player_z - 50.0f) break; // Simple culling for objects behind the camera
+    // 4. --- Upload (flushing first if this frame still draws the old contents) ---
+    for (size_t d = 0; d < RGL.instancing.draw_count; d++) {
+        if (RGL.instancing.draws[d].mode == 3 && RGL.instancing.draws[d].road.sample_ssbo == road->sample_ssbo && road->sample_ssbo) {
+            _RGL_FlushBatch();
+            break;
+        }
+    }
+    if (!road->sample_ssbo) glGenBuffers(1, &road->sample_ssbo);
+    if (!road->point_ssbo) glGenBuffers(1, &road->point_ssbo);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, road->sample_ssbo);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, (GLsizeiptr)(sizeof(RGLGPURoadSample) * samples->count), gpu_samples, GL_STATIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, road->point_ssbo);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, (GLsizeiptr)(sizeof(RGLGPURoadPoint) * path->num_points), gpu_points, GL_STATIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    RGL.stats.bytes_uploaded += sizeof(RGLGPURoadSample) * samples->count + sizeof(RGLGPURoadPoint) * path->num_points;
+
+    _RGL_FrameArenaRewind(scratch_mark);
+    road->valid = true;
+    return true;
+}
 
-        if (current_point->scenery_left.type != RGL_SCENERY_NONE) _RGL_DrawPathScenery(current_point, &current_point->scenery_left);
-        if (current_point->scenery_right.type != RGL_SCENERY_NONE) _RGL_DrawPathScenery(current_point, &current_point->scenery_right);
-        if (current_point->scenery_overhead.type != RGL_SCENERY_NONE) _RGL_DrawPathScenery(current_point, &current_point->scenery_overhead);
+/**
+ * @brief (INTERNAL) Deletes a path's GPU road buffers. A run still queued this frame refers to them,
+ * so the batch is flushed first and the road keeps its place in the frame.
+ */
+static void _RGL_FreeGPURoad(RGLPathData* path) {
+    RGLPathGPURoad* road = &path->gpu_road;
+    if (!road->sample_ssbo) return;
+    for (size_t d = 0; d < RGL.instancing.draw_count; d++) {
+        if (RGL.instancing.draws[d].mode == 3 && RGL.instancing.draws[d].road.sample_ssbo == road->sample_ssbo) {
+            _RGL_FlushBatch();
+            break;
+        }
     }
+    for (size_t d = 0; d < RGL.instancing.draw_count; d++) {
+        if (RGL.instancing.draws[d].mode == 3 && RGL.instancing.draws[d].road.sample_ssbo == road->sample_ssbo) RGL.instancing.draws[d].instance_count = 0; // Only if the flush could not run
+    }
+    glDeleteBuffers(1, &road->sample_ssbo);
+    glDeleteBuffers(1, &road->point_ssbo);
+    memset(road, 0, sizeof(RGLPathGPURoad));
 }
 
 /**
@@ -7072,15 +13148,14 @@ static void _RGL_DrawPathScene_Road(float player_z, int draw_distance, void* use
  * `RGL_RegisterSceneryStyle()` to "plug in" their own custom drawing functions for new or
  * existing scenery types, and this dispatcher will call them without ever needing to be modified.
  *
- * @param path_point The path point the scenery is attached to.
+ * @param path The path the scenery belongs to.
+ * @param index The index of the path point the scenery is attached to.
  * @param scenery The scenery object to be rendered.
  */
-static void _RGL_DrawPathScenery(RGLPathPoint* path_point, RGLScenery* scenery) {
+static void _RGL_DrawPathScenery(const RGLPathData* path, size_t index, RGLScenery* scenery) {
     // --- Step 1: Calculate the final 3D world position of the scenery's anchor. ---
     vec3 world_pos;
-    world_pos[0] = path_point->world_x_offset + (scenery->x_offset * (path_point->primary_ribbon_width * 0.5f));
-    world_pos[1] = path_point->world_y_offset + scenery->y_offset;
-    world_pos[2] = path_point->world_z;
+    _RGL_GetPathSceneryPosition(path, index, scenery, world_pos);
 
     // --- Step 2: Dynamic Dispatch via the Style Registry. ---
     RGLSceneryType type = scenery->type;
@@ -7103,7 +13178,10 @@ static void _RGL_DrawPathScenery(RGLPathPoint* path_point, RGLScenery* scenery)
                 // --- Step 5: Execute the callback function. ---
                 // The program "jumps" to the memory address stored in 'style->draw_func'
                 // and begins executing the code there (e.g., _RGL_DrawScenery_Sprite).
-                style->draw_func(scenery, path_point, &world_pos, style->user_data);
+                // Callbacks receive an assembled RGLPathPoint view of the anchor point.
+                RGLPathPoint path_point;
+                _RGL_LoadPathPoint(path, index, &path_point);
+                style->draw_func(scenery, &path_point, &world_pos, style->user_data);
             }
         }
     }
@@ -7111,6 +13189,12 @@ static void _RGL_DrawPathScenery(RGLPathPoint* path_point, RGLScenery* scenery)
     // correctly drawing nothing.
 }
 
+static void _RGL_GetPathSceneryPosition(const RGLPathData* path, size_t index, const RGLScenery* scenery, vec3 out_pos) {
+    out_pos[0] = path->x_offset[index] + (scenery->x_offset * (path->ribbon_width[index] * 0.5f));
+    out_pos[1] = path->y_offset[index] + scenery->y_offset;
+    out_pos[2] = path->world_z[index];
+}
+
 // --- PRIVATE HELPER: Find a named Path and return its index ---
 static int _RGL_FindPathIndex(const char* path_name) {
     if (!RGL.is_initialized || !path_name) return -1;
@@ -7132,50 +13216,45 @@ static RGLPathData* _RGL_GetActivePathData() {
 
 SITAPI bool RGL_GetDistanceToMarker(float player_z, const char* marker_name, float* out_distance) {
     if (!marker_name || !out_distance) return false;
+    *out_distance = 0.0f;
 
     RGLPathData* Path = _RGL_GetActivePathData();
-    if (!Path) return false;
-
-    // Scan forward from the player's position
-    for (size_t i = 0; i < Path->num_points; i++) {
-        RGLPathPoint* p = &Path->points[i];
-        if (p->world_z <= player_z) continue; // Only find markers ahead of the player
-
-        RGLScenery* scenery_slots[] = { &p->scenery_left, &p->scenery_right, &p->scenery_overhead };
-        for (int j = 0; j < 3; j++) {
-            RGLScenery* s = scenery_slots[j];
-            if (s->type == RGL_SCENERY_EVENT_MARKER && strncmp(s->data.event.name, marker_name, 31) == 0) {
-                *out_distance = p->world_z - player_z;
-                return true;
-            }
+    if (!Path || Path->num_points == 0 || !_RGL_BuildSceneryIndex(Path)) return false;
+
+    // Scan the marker bucket forward from the player's position, comparing name hashes first.
+    const RGLSceneryIndex* index = &Path->scenery_index;
+    uint32_t name_hash = _RGL_HashMarkerName(marker_name);
+    const uint32_t* ids;
+    size_t end;
+    size_t begin = _RGL_ScenerySpan(index, RGL_SCENERY_EVENT_MARKER, -FLT_MAX, FLT_MAX, &ids, &end);
+    size_t ahead = _RGL_ScenerySpan(index, RGL_SCENERY_EVENT_MARKER, nextafterf(player_z, FLT_MAX), FLT_MAX, &ids, &end); // Strictly ahead
+
+    for (size_t i = ahead; i < end; i++) {
+        const RGLSceneryAnchor* anchor = &index->anchors[ids[i]];
+        if (anchor->name_hash == name_hash && strncmp(_RGL_GetAnchorScenery(Path, anchor)->data.event.name, marker_name, 31) == 0) {
+            *out_distance = anchor->world_pos[2] - player_z;
+            return true;
         }
     }
 
-    // Optional: If the Path loops, check from the beginning of the path as well
+    // If the Path loops, check from the beginning of the path up to the player's position on the next lap.
     if (Path->loop_to_z >= 0.0f) {
-        float path_length = Path->points[Path->num_points - 1].world_z - Path->loop_to_z;
-        for (size_t i = 0; i < Path->num_points; i++) {
-            RGLPathPoint* p = &Path->points[i];
-            // Stop if we've reached the player's original position on the next lap
-            if (p->world_z >= player_z) break;
-
-            RGLScenery* scenery_slots[] = { &p->scenery_left, &p->scenery_right, &p->scenery_overhead };
-            for (int j = 0; j < 3; j++) {
-                RGLScenery* s = scenery_slots[j];
-                if (s->type == RGL_SCENERY_EVENT_MARKER && strncmp(s->data.event.name, marker_name, 31) == 0) {
-                    *out_distance = (p->world_z + path_length) - player_z;
-                    return true;
-                }
+        float path_length = Path->world_z[Path->num_points - 1] - Path->loop_to_z;
+        for (size_t i = begin; i < end; i++) {
+            const RGLSceneryAnchor* anchor = &index->anchors[ids[i]];
+            if (anchor->world_pos[2] >= player_z) break;
+            if (anchor->name_hash == name_hash && strncmp(_RGL_GetAnchorScenery(Path, anchor)->data.event.name, marker_name, 31) == 0) {
+                *out_distance = (anchor->world_pos[2] + path_length) - player_z;
+                return true;
             }
         }
     }
-
-    *out_distance = 0.0f;
     return false;
 }
 
 /**
  * @brief Finds all event markers within a specified Z-range of the path.
+ * Binary-searches the path's marker bucket, so only markers in range are visited.
  *
  * @param start_z The starting Z-coordinate of the search range.
  * @param end_z The ending Z-coordinate of the search range.
@@ -7187,34 +13266,24 @@ SITAPI int RGL_FindMarkersInRange(float start_z, float end_z, RGLMarkerInfo out_
     if (!out_markers || max_markers <= 0 || start_z >= end_z) return 0;
 
     RGLPathData* Path = _RGL_GetActivePathData();
-    if (!Path) return 0;
+    if (!Path || Path->num_points == 0 || !_RGL_BuildSceneryIndex(Path)) return 0;
 
+    const RGLSceneryIndex* index = &Path->scenery_index;
+    const uint32_t* ids;
+    size_t end;
     int found_count = 0;
-    // Use the refactored pure helper function
-    int start_idx = _RGL_FindPathPointIndexAt(Path->points, Path->num_points, start_z);
-    if (start_idx == -1) return 0;
-
-    for (int i = start_idx; i < Path->num_points; i++) {
-        RGLPathPoint* p = &Path->points[i];
-        if (p->world_z > end_z) break;
-
-        RGLScenery* scenery_slots[] = { &p->scenery_left, &p->scenery_right, &p->scenery_overhead };
-        for (int j = 0; j < 3; j++) {
-            if (scenery_slots[j]->type == RGL_SCENERY_EVENT_MARKER) {
-                RGLMarkerInfo* result = &out_markers[found_count];
-                strncpy(result->name, scenery_slots[j]->data.event.name, 31);
-                result->name[31] = '\0';
-                result->id = scenery_slots[j]->data.event.id;
-                result->distance = p->world_z - start_z;
-
-                result->world_pos[0] = p->world_x_offset + scenery_slots[j]->x_offset * (p->primary_ribbon_width * 0.5f);
-                result->world_pos[1] = p->world_y_offset + scenery_slots[j]->y_offset;
-                result->world_pos[2] = p->world_z;
-
-                found_count++;
-                if (found_count >= max_markers) return found_count;
-            }
-        }
+    for (size_t i = _RGL_ScenerySpan(index, RGL_SCENERY_EVENT_MARKER, start_z, end_z, &ids, &end); i < end; i++) {
+        const RGLSceneryAnchor* anchor = &index->anchors[ids[i]];
+        const RGLScenery* marker = _RGL_GetAnchorScenery(Path, anchor);
+        RGLMarkerInfo* result = &out_markers[found_count];
+        strncpy(result->name, marker->data.event.name, 31);
+        result->name[31] = '\0';
+        result->id = marker->data.event.id;
+        result->distance = anchor->world_pos[2] - start_z;
+        glm_vec3_copy((float*)anchor->world_pos, result->world_pos);
+
+        found_count++;
+        if (found_count >= max_markers) return found_count;
     }
     return found_count;
 }
@@ -7236,25 +13305,17 @@ static void _RGL_DrawMapPolygon(GLuint vao, GLuint vbo, vec2* points, int point_
     vec4 norm_color;
     SituationConvertColorToVec4(color, norm_color);
 
-    // BUGFIX: Vertex format is 10 floats.
-    const int floats_per_vertex = 10;
-    float vertices[point_count * floats_per_vertex];
+    const vec3 normal = {0.0f, 0.0f, 1.0f};
+    const vec2 uv = {0.0f, 0.0f};
+    RGLBatchVertex vertices[point_count];
     for(int i = 0; i < point_count; i++) {
-        float* v_ptr = &vertices[i * floats_per_vertex];
-        v_ptr[0] = points[i][0]; // pos.x
-        v_ptr[1] = points[i][1]; // pos.y
-        v_ptr[2] = 0.0f;         // pos.z
-        v_ptr[3] = 0.0f; v_ptr[4] = 0.0f; // uv
-        v_ptr[5] = norm_color[0]; // color.r
-        v_ptr[6] = norm_color[1]; // color.g
-        v_ptr[7] = norm_color[2]; // color.b
-        v_ptr[8] = norm_color[3]; // color.a
-        v_ptr[9] = 1.0f;          // light
+        vec3 position = { points[i][0], points[i][1], 0.0f };
+        _RGL_PackBatchVertex(&vertices[i], position, normal, uv, norm_color, 1.0f);
     }
 
     glBindVertexArray(vao);
     glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float) * point_count * floats_per_vertex, vertices);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(RGLBatchVertex) * point_count, vertices);
 
     glUniform1i(RGL.loc_use_texture, 0);
     glDrawArrays(GL_TRIANGLE_FAN, 0, point_count);
@@ -7303,15 +13364,11 @@ SITAPI void RGL_DrawPathAsMap(RGLTexture target, vec2 center_pos_xz, float world
     glGenBuffers(1, &map_vbo);
     glBindVertexArray(map_vao);
     glBindBuffer(GL_ARRAY_BUFFER, map_vbo);
-    glBufferData(GL_ARRAY_BUFFER, 4096 * sizeof(float), NULL, GL_STREAM_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, 64 * sizeof(RGLBatchVertex), NULL, GL_STREAM_DRAW);
 
-    // BUGFIX: Set up all vertex attributes correctly for the 10-float format.
-    const int floats_per_vertex = 10;
-    size_t stride = floats_per_vertex * sizeof(float);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0); glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (void*)(3*sizeof(float))); glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, stride, (void*)(5*sizeof(float))); glEnableVertexAttribArray(2);
-    glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, stride, (void*)(9*sizeof(float))); glEnableVertexAttribArray(3);
+    // Use the same vertex layout as the main batch so the main shader's attributes line up.
+    _RGL_SetBatchVertexLayout(map_vao, map_vbo);
+    glBindVertexArray(map_vao);
 
     Color Path_color = WHITE;
     Color tunnel_color = (Color){100, 100, 100, 255};
@@ -7320,164 +13377,880 @@ SITAPI void RGL_DrawPathAsMap(RGLTexture target, vec2 center_pos_xz, float world
 
     float min_z = view_rect.y;
     float max_z = view_rect.y + view_rect.height;
-    int start_idx = _RGL_FindPathPointIndexAt(Path->points, Path->num_points, min_z);
+    int start_idx = _RGL_FindPathPointIndexAt(Path->world_z, Path->num_points, min_z);
     if (start_idx == -1) start_idx = 0;
 
+    const float* z = Path->world_z;
+    const float* x = Path->x_offset;
+    const float* w = Path->ribbon_width;
+
     for (int i = start_idx; i < Path->num_points - 1; i++) {
-        RGLPathPoint *p_near = &Path->points[i];
-        RGLPathPoint *p_far = &Path->points[i+1];
-        if (p_near->world_z > max_z) break;
+        int n = i, f = i + 1; // Near and far point of the segment
+        if (z[n] > max_z) break;
 
         vec2 Path_quad[4] = {
-            { p_near->world_x_offset - p_near->primary_ribbon_width * 0.5f, p_near->world_z },
-            { p_far->world_x_offset - p_far->primary_ribbon_width * 0.5f, p_far->world_z },
-            { p_far->world_x_offset + p_far->primary_ribbon_width * 0.5f, p_far->world_z },
-            { p_near->world_x_offset + p_near->primary_ribbon_width * 0.5f, p_near->world_z }
+            { x[n] - w[n] * 0.5f, z[n] },
+            { x[f] - w[f] * 0.5f, z[f] },
+            { x[f] + w[f] * 0.5f, z[f] },
+            { x[n] + w[n] * 0.5f, z[n] }
         };
         _RGL_DrawMapPolygon(map_vao, map_vbo, Path_quad, 4, Path_color);
 
-        if (p_near->split_width > 0.01f) {
+        if (Path->split_width[n] > 0.01f) {
+            const float* so = Path->split_offset;
+            const float* sw = Path->split_width;
             vec2 split_quad[4] = {
-                { p_near->world_x_offset + p_near->split_offset - p_near->split_width * 0.5f, p_near->world_z },
-                { p_far->world_x_offset + p_far->split_offset - p_far->split_width * 0.5f, p_far->world_z },
-                { p_far->world_x_offset + p_far->split_offset + p_far->split_width * 0.5f, p_far->world_z },
-                { p_near->world_x_offset + p_near->split_offset + p_near->split_width * 0.5f, p_near->world_z }
+                { x[n] + so[n] - sw[n] * 0.5f, z[n] },
+                { x[f] + so[f] - sw[f] * 0.5f, z[f] },
+                { x[f] + so[f] + sw[f] * 0.5f, z[f] },
+                { x[n] + so[n] + sw[n] * 0.5f, z[n] }
             };
             _RGL_DrawMapPolygon(map_vao, map_vbo, split_quad, 4, Path_color);
         }
     }
 
-    for (int i = start_idx; i < Path->num_points - 1; i++) {
-        RGLPathPoint *p_near = &Path->points[i];
-        RGLPathPoint *p_far = &Path->points[i+1];
-        if (p_near->world_z > max_z) break;
-
-        if (p_near->scenery_left.type == RGL_SCENERY_SPRITE) {
-            float x = p_near->world_x_offset + p_near->scenery_left.x_offset * p_near->primary_ribbon_width * 0.5f;
-            vec2 dot[4] = {{x-2, p_near->world_z-2}, {x+2, p_near->world_z-2}, {x+2, p_near->world_z+2}, {x-2, p_near->world_z+2}};
-            _RGL_DrawMapPolygon(map_vao, map_vbo, dot, 4, scenery_color);
+    for (int i = start_idx; i < Path->num_points - 1; i++) {
+        int n = i, f = i + 1;
+        if (z[n] > max_z) break;
+
+        const RGLPathScenery* scenery = &Path->scenery[n];
+        if (scenery->left.type == RGL_SCENERY_SPRITE) {
+            float sx = x[n] + scenery->left.x_offset * w[n] * 0.5f;
+            vec2 dot[4] = {{sx-2, z[n]-2}, {sx+2, z[n]-2}, {sx+2, z[n]+2}, {sx-2, z[n]+2}};
+            _RGL_DrawMapPolygon(map_vao, map_vbo, dot, 4, scenery_color);
+        }
+
+        if (scenery->overhead.type == RGL_SCENERY_ARCH) {
+            vec2 tunnel_quad[4] = {
+                { x[n] - w[n] * 0.5f, z[n] },
+                { x[f] - w[f] * 0.5f, z[f] },
+                { x[f] + w[f] * 0.5f, z[f] },
+                { x[n] + w[n] * 0.5f, z[n] }
+            };
+            _RGL_DrawMapPolygon(map_vao, map_vbo, tunnel_quad, 4, tunnel_color);
+        }
+    }
+
+    float s = 4.0f;
+    vec2 player_dot[4] = {
+        {center_pos_xz[0]-s, center_pos_xz[1]-s}, {center_pos_xz[0]+s, center_pos_xz[1]-s},
+        {center_pos_xz[0]+s, center_pos_xz[1]+s}, {center_pos_xz[0]-s, center_pos_xz[1]+s}
+    };
+    _RGL_DrawMapPolygon(map_vao, map_vbo, player_dot, 4, player_color);
+
+    glDeleteBuffers(1, &map_vbo);
+    glDeleteVertexArrays(1, &map_vao);
+    RGL_ResetRenderTarget();
+
+    int width, height;
+    SituationGetVirtualDisplaySize(RGL.active_virtual_display_id, &width, &height);
+    if(width > 0 && height > 0) glViewport(0, 0, width, height);
+}
+
+/**
+ * @brief Queries the active path for a junction at the player's position and returns all available choices.
+ *
+ * This is the definitive function for handling all path network topology. It finds the nearest
+ * RGL_SCENERY_JUNCTION_TRIGGER and populates the `out_info` struct with the type of junction
+ * and all valid destination paths.
+ *
+ * @param player_z The current Z-position of the player on the active path.
+ * @param search_radius The forward distance (in world units) to look for a junction trigger.
+ * @param out_info A pointer to an RGLJunctionInfo struct to store the complete result.
+ * @return True if a junction trigger was found within the search radius, false otherwise.
+ */
+SITAPI bool RGL_QueryJunction(float player_z, float search_radius, RGLJunctionInfo* out_info) {
+    if (!out_info) {
+        return false;
+    }
+    memset(out_info, 0, sizeof(RGLJunctionInfo));
+    out_info->is_valid = false;
+
+    RGLPathData* path = _RGL_GetActivePathData();
+    if (!path || path->num_points == 0 || !_RGL_BuildSceneryIndex(path)) {
+        return false;
+    }
+    return _RGL_FindJunctionIndexed(path, &path->scenery_index, player_z, search_radius, out_info);
+}
+
+/**
+ * @brief Returns the index of a named path, for RGL_SetActivePathByIndex and the batch queries.
+ * Indices are stable until a path is destroyed, which shifts every later path down by one.
+ * @return The index, or -1 if no path has that name.
+ */
+SITAPI int RGL_GetPathIndex(const char* path_name) {
+    return _RGL_FindPathIndex(path_name);
+}
+
+/**
+ * @brief Sets the active path by index, e.g. from a junction choice's resolved path_index.
+ * @return True on success, false if the index is out of range.
+ */
+SITAPI bool RGL_SetActivePathByIndex(int path_index) {
+    if (!RGL.is_initialized || path_index < 0 || path_index >= (int)RGL.Path_count) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_NOT_FOUND, "No Path with the specified index was found.");
+        return false;
+    }
+    RGL.active_Path_index = path_index;
+    RGL.Paths[path_index].data.last_segment_index_cache = 0;
+    return true;
+}
+
+/**
+ * @brief (Main thread) Rebuilds the scenery index of every path edited or affected since its last build.
+ * The single queries (RGL_FindSceneryInRange and friends) rebuild lazily on their own. The batch queries never
+ * build, so call this once after editing paths and before handing batches to worker threads.
+ */
+SITAPI void RGL_UpdateSceneryIndices(void) {
+    if (!RGL.is_initialized) return;
+    for (size_t i = 0; i < RGL.Path_count; i++) _RGL_BuildSceneryIndex(&RGL.Paths[i].data);
+}
+
+/**
+ * @brief Answers many scenery queries, each on any path, in one call.
+ * Read-only: it never rebuilds an index, so any number of threads may call it at once while the paths
+ * are not being edited. A path whose index is out of date reports result_count -1 (call
+ * RGL_UpdateSceneryIndices on the main thread).
+ * @param queries The requests; first_result and result_count are filled in.
+ * @param out_hits Shared output, filled query by query in order.
+ * @param max_hits Capacity of out_hits. Later queries get no hits once it is full.
+ * @return The total number of hits written.
+ */
+SITAPI int RGL_QuerySceneryBatch(RGLSceneryQuery* queries, int query_count, RGLSceneryHit* out_hits, int max_hits) {
+    if (!queries || query_count <= 0) return 0;
+    int written = 0;
+
+    for (int q = 0; q < query_count; q++) {
+        RGLSceneryQuery* query = &queries[q];
+        query->first_result = written;
+        query->result_count = -1;
+        if (!RGL.is_initialized || query->path_index < 0 || query->path_index >= (int)RGL.Path_count) continue;
+        const RGLPathData* path = &RGL.Paths[query->path_index].data;
+        if (!_RGL_IsSceneryIndexCurrent(path)) continue;
+        query->result_count = 0;
+        if (!out_hits || written >= max_hits) continue;
+
+        // 1. --- Z span of the request ---
+        bool sphere = query->radius > 0.0f;
+        float start_z = sphere ? query->center[2] - query->radius : query->start_z;
+        float end_z = sphere ? query->center[2] + query->radius : query->end_z;
+        float radius_sq = query->radius * query->radius;
+        int limit = max_hits - written;
+        if (query->max_results > 0 && query->max_results < limit) limit = query->max_results;
+
+        // 2. --- Walk the span ---
+        const RGLSceneryIndex* index = &path->scenery_index;
+        const uint32_t* ids;
+        size_t end;
+        for (size_t i = _RGL_ScenerySpan(index, query->type, start_z, end_z, &ids, &end); i < end && query->result_count < limit; i++) {
+            const RGLSceneryAnchor* anchor = &index->anchors[ids ? ids[i] : i];
+            const RGLScenery* scenery = _RGL_GetAnchorScenery(path, anchor);
+            if (query->type != RGL_SCENERY_NONE && scenery->type != query->type) continue; // Types without a bucket
+            if (sphere && glm_vec3_distance2(query->center, (float*)anchor->world_pos) >= radius_sq) continue;
+
+            RGLSceneryHit* hit = &out_hits[written++];
+            hit->scenery = scenery;
+            glm_vec3_copy((float*)anchor->world_pos, hit->world_pos);
+            hit->point_index = (int)anchor->point_index;
+            hit->slot = (int)anchor->slot;
+            query->result_count++;
+        }
+    }
+    return written;
+}
+
+/**
+ * @brief Answers many junction queries, each on any path, in one call.
+ * Read-only and thread-safe like RGL_QuerySceneryBatch. Each info's choices carry path_index, already
+ * resolved, so following a junction needs no name lookup.
+ * @param out_infos query_count results; is_valid is false where no junction was found or the index is out of date.
+ * @return The number of queries that found a junction.
+ */
+SITAPI int RGL_QueryJunctionBatch(const RGLJunctionQuery* queries, int query_count, RGLJunctionInfo* out_infos) {
+    if (!queries || !out_infos || query_count <= 0) return 0;
+    int found = 0;
+    for (int q = 0; q < query_count; q++) {
+        memset(&out_infos[q], 0, sizeof(RGLJunctionInfo));
+        const RGLJunctionQuery* query = &queries[q];
+        if (!RGL.is_initialized || query->path_index < 0 || query->path_index >= (int)RGL.Path_count) continue;
+        const RGLPathData* path = &RGL.Paths[query->path_index].data;
+        if (!_RGL_IsSceneryIndexCurrent(path)) continue;
+        if (_RGL_FindJunctionIndexed(path, &path->scenery_index, query->player_z, query->search_radius, &out_infos[q])) found++;
+    }
+    return found;
+}
+
+/**
+ * @brief Gets the interpolated properties of any path at a Z-position, without touching global state.
+ *
+ * Unlike RGL_GetPathPropertiesAt this neither reads the active path nor moves its sticky bookmark: the
+ * segment search starts from, and updates, the caller's cursor. It evaluates the control points
+ * directly and reads no lazily built cache, so any number of threads may call it at once (each with
+ * its own cursor) while the paths are not being edited.
+ *
+ * @param path_index The path to query (see RGL_GetPathIndex).
+ * @param z_pos The world Z position; wrapped for looping paths.
+ * @param cursor The caller's bookmark. May be NULL, at the cost of a search from the start of the path.
+ * @param out_point Receives the interpolated point.
+ * @return True on success, false if the index is out of range or the path has fewer than 4 points.
+ */
+SITAPI bool RGL_GetPathPropertiesAtEx(int path_index, float z_pos, RGLPathCursor* cursor, RGLPathPoint* out_point) {
+    if (!RGL.is_initialized || !out_point || path_index < 0 || path_index >= (int)RGL.Path_count) return false;
+    const RGLPathData* path = &RGL.Paths[path_index].data;
+    if (path->num_points < 4) return false;
+
+    int local_cursor = 0;
+    _RGL_EvaluatePathPoint(path, z_pos, cursor ? &cursor->segment_index : &local_cursor, out_point);
+    return true;
+}
+
+/**
+ * @brief Finds the ground surface of any path at a world XZ coordinate, without touching global state.
+ * Re-entrant and thread-safe like RGL_GetPathPropertiesAtEx. Heights come from the exact curve rather
+ * than RGL_GetGroundAt's sample cache, so the two can differ by the cache's interpolation error.
+ * @return True if the Z is on the path (is_hit is then set), false otherwise.
+ */
+SITAPI bool RGL_GetGroundAtEx(int path_index, vec2 world_xz, RGLPathCursor* cursor, RGLGroundInfo* out_info) {
+    if (!out_info) return false;
+    out_info->is_hit = false;
+    if (!RGL.is_initialized || path_index < 0 || path_index >= (int)RGL.Path_count) return false;
+    const RGLPathData* path = &RGL.Paths[path_index].data;
+    if (path->num_points < 4) return false;
+
+    int local_cursor = 0;
+    RGLPathSample props;
+    _RGL_EvaluatePathSample(path, world_xz[1], cursor ? &cursor->segment_index : &local_cursor, &props);
+    _RGL_ClassifyGround(&props, world_xz[0], out_info);
+    return true;
+}
+
+/**
+ * @brief Finds the ground under many XZ points on one path in a single call.
+ * Points sorted (or clustered) by Z walk the shared cursor forward in O(1) each; unsorted points still
+ * work, just with longer walks. Re-entrant and thread-safe: jobs may split one fleet across threads, as
+ * long as each passes its own cursor.
+ * @param world_xz count points (X, Z).
+ * @param cursor Shared bookmark for the whole batch. May be NULL.
+ * @param out_infos count results. Z beyond the path's ends clamps to the end points, as in RGL_GetGroundAt.
+ * @return count on success, or 0 if the index is out of range or the path has fewer than 4 points.
+ */
+SITAPI int RGL_GetGroundAtBatch(int path_index, const vec2* world_xz, int count, RGLPathCursor* cursor, RGLGroundInfo* out_infos) {
+    if (!world_xz || !out_infos || count <= 0) return 0;
+    for (int i = 0; i < count; i++) out_infos[i].is_hit = false;
+    if (!RGL.is_initialized || path_index < 0 || path_index >= (int)RGL.Path_count) return 0;
+    const RGLPathData* path = &RGL.Paths[path_index].data;
+    if (path->num_points < 4) return 0;
+
+    int local_cursor = 0;
+    int* segment = cursor ? &cursor->segment_index : &local_cursor;
+    for (int i = 0; i < count; i++) {
+        RGLPathSample props;
+        _RGL_EvaluatePathSample(path, world_xz[i][1], segment, &props);
+        _RGL_ClassifyGround(&props, world_xz[i][0], &out_infos[i]);
+    }
+    return count;
+}
+
+// --- Scenery Index ---
+
+/**
+ * @brief (INTERNAL) Builds a path's scenery index: one anchor per non-empty scenery slot, in path order,
+ * with its world position, a counting-sort bucket per type, marker name hashes, and junction
+ * destinations resolved to path indices. Scenery world positions follow the control points, as the
+ * queries always have: centerline offset plus x_offset in half-widths of the ribbon.
+ */
+static bool _RGL_BuildSceneryIndex(RGLPathData* path) {
+    if (_RGL_IsSceneryIndexCurrent(path)) return true;
+    RGLSceneryIndex* index = &path->scenery_index;
+
+    // 1. --- Count slots, per type, and junctions ---
+    size_t anchor_count = 0, junction_count = 0;
+    uint32_t type_counts[RGL_MAX_SCENERY_TYPES] = {0};
+    for (size_t i = 0; i < path->num_points; i++) {
+        const RGLScenery* slots[3] = { &path->scenery[i].left, &path->scenery[i].right, &path->scenery[i].overhead };
+        for (int j = 0; j < 3; j++) {
+            if (slots[j]->type == RGL_SCENERY_NONE) continue;
+            anchor_count++;
+            if ((unsigned)slots[j]->type < RGL_MAX_SCENERY_TYPES) type_counts[slots[j]->type]++;
+            if (slots[j]->type == RGL_SCENERY_JUNCTION_TRIGGER) junction_count++;
+        }
+    }
+
+    // 2. --- Allocate the tables at their exact sizes ---
+    _RGL_FreeSceneryIndex(path);
+    if (anchor_count > 0) {
+        index->anchors = (RGLSceneryAnchor*)malloc(sizeof(RGLSceneryAnchor) * anchor_count);
+        index->by_type = (uint32_t*)malloc(sizeof(uint32_t) * anchor_count);
+        if (junction_count > 0) index->junction_targets = malloc(sizeof(*index->junction_targets) * junction_count);
+        if (!index->anchors || !index->by_type || (junction_count > 0 && !index->junction_targets)) {
+            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate scenery index.");
+            _RGL_FreeSceneryIndex(path);
+            return false;
+        }
+    }
+    uint32_t offset = 0;
+    for (int t = 0; t < RGL_MAX_SCENERY_TYPES; t++) {
+        index->type_start[t] = offset;
+        offset += type_counts[t];
+        type_counts[t] = index->type_start[t]; // Reused as the bucket write cursor
+    }
+    index->type_start[RGL_MAX_SCENERY_TYPES] = offset;
+
+    // 3. --- Fill anchors in path order and scatter them into their buckets ---
+    for (size_t i = 0; i < path->num_points; i++) {
+        const RGLScenery* slots[3] = { &path->scenery[i].left, &path->scenery[i].right, &path->scenery[i].overhead };
+        for (int j = 0; j < 3; j++) {
+            const RGLScenery* scenery = slots[j];
+            if (scenery->type == RGL_SCENERY_NONE) continue;
+
+            uint32_t a = (uint32_t)index->anchor_count++;
+            RGLSceneryAnchor* anchor = &index->anchors[a];
+            anchor->world_pos[0] = path->x_offset[i] + scenery->x_offset * (path->ribbon_width[i] * 0.5f);
+            anchor->world_pos[1] = path->y_offset[i] + scenery->y_offset;
+            anchor->world_pos[2] = path->world_z[i];
+            anchor->point_index = (uint32_t)i;
+            anchor->slot = (uint32_t)j;
+            anchor->name_hash = scenery->type == RGL_SCENERY_EVENT_MARKER ? _RGL_HashMarkerName(scenery->data.event.name) : 0;
+            anchor->junction = -1;
+            if ((unsigned)scenery->type < RGL_MAX_SCENERY_TYPES) index->by_type[type_counts[scenery->type]++] = a;
+
+            // 4. --- Resolve junction destinations once, instead of per query ---
+            if (scenery->type == RGL_SCENERY_JUNCTION_TRIGGER) {
+                anchor->junction = (int32_t)index->junction_count;
+                int32_t* targets = index->junction_targets[index->junction_count++];
+                const char* names[3] = { scenery->data.junction.connect_left.path_name,
+                                         scenery->data.junction.connect_right.path_name,
+                                         scenery->data.junction.connect_straight.path_name };
+                for (int c = 0; c < 3; c++) targets[c] = names[c][0] ? _RGL_FindPathIndex(names[c]) : -1;
+            }
+        }
+    }
+
+    index->topology_version = RGL.path_topology_version;
+    index->valid = true;
+    return true;
+}
+
+/**
+ * @brief (INTERNAL) True if a path's scenery index is built and still matches the path set.
+ */
+static bool _RGL_IsSceneryIndexCurrent(const RGLPathData* path) {
+    return path->scenery_index.valid && path->scenery_index.topology_version == RGL.path_topology_version;
+}
+
+/**
+ * @brief (INTERNAL) Releases a path's scenery index.
+ * @param path The path whose index to free.
+ */
+static void _RGL_FreeSceneryIndex(RGLPathData* path) {
+    free(path->scenery_index.anchors);
+    free(path->scenery_index.by_type);
+    free(path->scenery_index.junction_targets);
+    memset(&path->scenery_index, 0, sizeof(RGLSceneryIndex));
+}
+
+/**
+ * @brief (INTERNAL) Hashes an event marker name with FNV-1a over at most its first 31 characters.
+ * The marker name buffer holds 31 characters plus the terminator, so longer query names hash as stored.
+ */
+static uint32_t _RGL_HashMarkerName(const char* name) {
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < 31 && name[i]; i++) {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief (INTERNAL) Finds the anchors inside the inclusive Z range [start_z, end_z] with two binary searches.
+ * @param type A bucketed type, or RGL_SCENERY_NONE (or a type >= RGL_MAX_SCENERY_TYPES) for all anchors;
+ *        in the latter case callers filter by type themselves.
+ * @param out_ids Receives the bucket's anchor indices, or NULL when the span indexes the anchors directly.
+ * @param out_end Receives one past the last position in range.
+ * @return The first position in range.
+ */
+static size_t _RGL_ScenerySpan(const RGLSceneryIndex* index, RGLSceneryType type, float start_z, float end_z, const uint32_t** out_ids, size_t* out_end) {
+    const uint32_t* ids = NULL;
+    size_t base = 0, count = index->anchor_count;
+    if (type != RGL_SCENERY_NONE && (unsigned)type < RGL_MAX_SCENERY_TYPES) {
+        ids = index->by_type;
+        base = index->type_start[type];
+        count = index->type_start[type + 1] - base;
+    }
+
+    size_t lo = 0, hi = count; // First anchor with z >= start_z
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (index->anchors[ids ? ids[base + mid] : mid].world_pos[2] < start_z) lo = mid + 1; else hi = mid;
+    }
+    size_t first = lo;
+    hi = count; // First anchor with z > end_z
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (index->anchors[ids ? ids[base + mid] : mid].world_pos[2] <= end_z) lo = mid + 1; else hi = mid;
+    }
+
+    *out_ids = ids;
+    *out_end = base + lo;
+    return base + first;
+}
+
+static RGLScenery* _RGL_GetAnchorScenery(const RGLPathData* path, const RGLSceneryAnchor* anchor) {
+    RGLPathScenery* p = &path->scenery[anchor->point_index];
+    return anchor->slot == 0 ? &p->left : (anchor->slot == 1 ? &p->right : &p->overhead);
+}
+
+/**
+ * @brief (INTERNAL) Finds the first junction trigger in [player_z, player_z + search_radius] and fills out_info,
+ * choices included. Reads only the built index, so it is safe on any thread.
+ */
+static bool _RGL_FindJunctionIndexed(const RGLPathData* path, const RGLSceneryIndex* index, float player_z, float search_radius, RGLJunctionInfo* out_info) {
+    const uint32_t* ids;
+    size_t end;
+    size_t i = _RGL_ScenerySpan(index, RGL_SCENERY_JUNCTION_TRIGGER, player_z, player_z + search_radius, &ids, &end);
+    if (i >= end) return false;
+
+    const RGLSceneryAnchor* anchor = &index->anchors[ids[i]];
+    const RGLScenery* junction = _RGL_GetAnchorScenery(path, anchor);
+    const int32_t* targets = index->junction_targets[anchor->junction];
+    out_info->is_valid = true;
+    out_info->type = junction->data.junction.type;
+    memcpy(out_info->choice_left.path_name, junction->data.junction.connect_left.path_name, sizeof(out_info->choice_left.path_name));
+    out_info->choice_left.z_pos = junction->data.junction.connect_left.z_pos;
+    out_info->choice_left.path_index = targets[0];
+    memcpy(out_info->choice_right.path_name, junction->data.junction.connect_right.path_name, sizeof(out_info->choice_right.path_name));
+    out_info->choice_right.z_pos = junction->data.junction.connect_right.z_pos;
+    out_info->choice_right.path_index = targets[1];
+    memcpy(out_info->choice_straight.path_name, junction->data.junction.connect_straight.path_name, sizeof(out_info->choice_straight.path_name));
+    out_info->choice_straight.z_pos = junction->data.junction.connect_straight.z_pos;
+    out_info->choice_straight.path_index = targets[2];
+    return true;
+}
+
+/**
+ * @brief (INTERNAL, PURE) Binary search to find the index of the first path point at or after a given Z position.
+ * This is a critical performance helper for queries, running in O(log n) time.
+ * @param world_z The path's array of control point Z positions.
+ * @param num_points The number of points in the array.
+ * @param z_pos The world Z-coordinate to search for.
+ * @return The index of the first point >= z_pos, or -1 if all points are before z_pos.
+ */
+static int _RGL_FindPathPointIndexAt(const float* world_z, size_t num_points, float z_pos) {
+    if (!world_z || num_points == 0) return -1;
+
+    int low = 0;
+    int high = num_points - 1;
+    int result = -1;
+
+    while (low <= high) {
+        int mid = low + (high - low) / 2;
+        if (world_z[mid] >= z_pos) {
+            result = mid;
+            high = mid - 1;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief (INTERNAL) Grows every per-point array of a path to the given capacity.
+ * @param path The path to grow.
+ * @param capacity The number of points the arrays must be able to hold.
+ * @return True on success, false if an allocation failed (the path keeps its previous capacity).
+ */
+static bool _RGL_ReservePathPoints(RGLPathData* path, size_t capacity) {
+    if (capacity <= path->capacity) return true;
+
+    float** geometry[] = { &path->world_z, &path->x_offset, &path->y_offset, &path->roll_degrees,
+                           &path->ribbon_width, &path->split_offset, &path->split_width, &path->rumble_width };
+    for (size_t i = 0; i < sizeof(geometry) / sizeof(geometry[0]); i++) {
+        float* grown = realloc(*geometry[i], capacity * sizeof(float));
+        if (!grown) return false;
+        *geometry[i] = grown;
+    }
+
+    RGLPathAppearance* new_appearance = realloc(path->appearance, capacity * sizeof(RGLPathAppearance));
+    if (!new_appearance) return false;
+    path->appearance = new_appearance;
+
+    RGLPathScenery* new_scenery = realloc(path->scenery, capacity * sizeof(RGLPathScenery));
+    if (!new_scenery) return false;
+    path->scenery = new_scenery;
+
+    path->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief (INTERNAL) Releases every per-point array of a path.
+ * @param path The path whose control points to free.
+ */
+static void _RGL_FreePathPoints(RGLPathData* path) {
+    free(path->world_z);      path->world_z = NULL;
+    free(path->x_offset);     path->x_offset = NULL;
+    free(path->y_offset);     path->y_offset = NULL;
+    free(path->roll_degrees); path->roll_degrees = NULL;
+    free(path->ribbon_width); path->ribbon_width = NULL;
+    free(path->split_offset); path->split_offset = NULL;
+    free(path->split_width);  path->split_width = NULL;
+    free(path->rumble_width); path->rumble_width = NULL;
+    free(path->appearance);   path->appearance = NULL;
+    free(path->scenery);      path->scenery = NULL;
+    path->num_points = 0;
+    path->capacity = 0;
+}
+
+/**
+ * @brief (INTERNAL) Scatters a control point into a path's geometry, appearance and scenery arrays.
+ * @param path The path to write to. `index` must be below its capacity.
+ * @param index The control point index to overwrite.
+ * @param point The control point to store.
+ */
+static void _RGL_StorePathPoint(RGLPathData* path, size_t index, const RGLPathPoint* point) {
+    path->world_z[index]      = point->world_z;
+    path->x_offset[index]     = point->world_x_offset;
+    path->y_offset[index]     = point->world_y_offset;
+    path->roll_degrees[index] = point->path_roll_degrees;
+    path->ribbon_width[index] = point->primary_ribbon_width;
+    path->split_offset[index] = point->split_offset;
+    path->split_width[index]  = point->split_width;
+    path->rumble_width[index] = point->rumble_width;
+
+    RGLPathAppearance* look = &path->appearance[index];
+    look->surface_texture       = point->surface_texture;
+    look->color_surface         = point->color_surface;
+    look->color_rumble          = point->color_rumble;
+    look->color_lines           = point->color_lines;
+    look->split_surface_texture = point->split_surface_texture;
+    look->split_surface_color   = point->split_surface_color;
+    look->primary_lanes         = point->primary_lanes;
+    look->split_lanes           = point->split_lanes;
+
+    RGLPathScenery* scenery = &path->scenery[index];
+    scenery->left     = point->scenery_left;
+    scenery->right    = point->scenery_right;
+    scenery->overhead = point->scenery_overhead;
+    scenery->user_tag = point->user_tag;
+}
+
+/**
+ * @brief (INTERNAL) Gathers a control point back into an RGLPathPoint view.
+ * @param path The path to read from.
+ * @param index The control point index to read.
+ * @param out_point Receives the assembled control point.
+ */
+static void _RGL_LoadPathPoint(const RGLPathData* path, size_t index, RGLPathPoint* out_point) {
+    out_point->world_z              = path->world_z[index];
+    out_point->world_x_offset       = path->x_offset[index];
+    out_point->world_y_offset       = path->y_offset[index];
+    out_point->path_roll_degrees    = path->roll_degrees[index];
+    out_point->primary_ribbon_width = path->ribbon_width[index];
+    out_point->split_offset         = path->split_offset[index];
+    out_point->split_width          = path->split_width[index];
+    out_point->rumble_width         = path->rumble_width[index];
+
+    const RGLPathAppearance* look = &path->appearance[index];
+    out_point->surface_texture       = look->surface_texture;
+    out_point->color_surface         = look->color_surface;
+    out_point->color_rumble          = look->color_rumble;
+    out_point->color_lines           = look->color_lines;
+    out_point->split_surface_texture = look->split_surface_texture;
+    out_point->split_surface_color   = look->split_surface_color;
+    out_point->primary_lanes         = look->primary_lanes;
+    out_point->split_lanes           = look->split_lanes;
+
+    const RGLPathScenery* scenery = &path->scenery[index];
+    out_point->scenery_left     = scenery->left;
+    out_point->scenery_right    = scenery->right;
+    out_point->scenery_overhead = scenery->overhead;
+    out_point->user_tag         = scenery->user_tag;
+}
+
+/**
+ * @brief (INTERNAL) Wraps a Z position into a looping path's range.
+ * @param path The path whose loop settings to apply.
+ * @param z_pos The world Z position to wrap.
+ * @return The wrapped Z position, or z_pos unchanged if the path does not loop or z_pos is before its end.
+ */
+static float _RGL_WrapPathZ(const RGLPathData* path, float z_pos) {
+    if (path->loop_to_z < 0.0f || path->num_points == 0) return z_pos;
+
+    float last_z = path->world_z[path->num_points - 1];
+    if (z_pos > last_z) {
+        float path_length = last_z - path->loop_to_z;
+        if (path_length > 0.001f) {
+            z_pos = fmodf(z_pos - path->loop_to_z, path_length) + path->loop_to_z;
+        }
+    }
+    return z_pos;
+}
+
+/**
+ * @brief (INTERNAL) Evaluates the path's curve into its sample cache.
+ *
+ * Samples are taken every RGL_PATH_SAMPLE_SPACING units of Z from the first control point, using the
+ * same Catmull-Rom/linear interpolation as RGL_GetPathPropertiesAt. A single forward cursor walks the
+ * control points, so a rebuild is O(samples + points). Does nothing if the cache is still valid.
+ *
+ * Render thread only: RGL_Begin rebuilds every edited path, and the draw paths may rebuild one after a
+ * mid-frame edit. A thread recording a command list never writes the cache (or the GPU road's validity
+ * flag) and gets false instead.
+ *
+ * @param path The path to sample.
+ * @return True if the cache is valid on return, false if the path has too few points, allocation failed,
+ *         or the cache is stale and the caller is recording a command list.
+ */
+static bool _RGL_BuildPathSamples(RGLPathData* path) {
+    if (path->samples.valid) return true;
+    if (path->num_points < 4 || g_rgl_recording_list) return false;
+
+    const float* world_z = path->world_z;
+    int num_points = (int)path->num_points;
+    float start_z = world_z[0];
+    float end_z = world_z[num_points - 1];
+
+    // One extra sample past the end so a query at end_z always has a right neighbour.
+    size_t count = (size_t)fmaxf(0.0f, (end_z - start_z) / RGL_PATH_SAMPLE_SPACING) + 2;
+
+    // 1. --- Grow the Sample Arrays ---
+    // The arrays share one block; contents are rebuilt below, so grow by reallocating from scratch.
+    RGLPathSamples* samples = &path->samples;
+    if (count > samples->capacity) {
+        size_t new_capacity = (samples->capacity == 0) ? count : samples->capacity * 2;
+        if (new_capacity < count) new_capacity = count;
+
+        float* block = malloc(new_capacity * (7 * sizeof(float) + sizeof(int32_t)));
+        if (!block) {
+            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate path sample cache.");
+            return false;
         }
-
-        if (p_near->scenery_overhead.type == RGL_SCENERY_ARCH) {
-            vec2 tunnel_quad[4] = {
-                { p_near->world_x_offset - p_near->primary_ribbon_width * 0.5f, p_near->world_z },
-                { p_far->world_x_offset - p_far->primary_ribbon_width * 0.5f, p_far->world_z },
-                { p_far->world_x_offset + p_far->primary_ribbon_width * 0.5f, p_far->world_z },
-                { p_near->world_x_offset + p_near->primary_ribbon_width * 0.5f, p_near->world_z }
-            };
-            _RGL_DrawMapPolygon(map_vao, map_vbo, tunnel_quad, 4, tunnel_color);
+        free(samples->x_offset);
+        samples->x_offset     = block;
+        samples->y_offset     = block + new_capacity;
+        samples->roll_degrees = block + new_capacity * 2;
+        samples->ribbon_width = block + new_capacity * 3;
+        samples->split_offset = block + new_capacity * 4;
+        samples->split_width  = block + new_capacity * 5;
+        samples->rumble_width = block + new_capacity * 6;
+        samples->point_index  = (int32_t*)(block + new_capacity * 7);
+        samples->capacity = new_capacity;
+    }
+
+    // 2. --- Evaluate the Curve ---
+    int p1_idx = 0;
+    for (size_t s = 0; s < count; s++) {
+        float z_pos = start_z + (float)s * RGL_PATH_SAMPLE_SPACING;
+        while (p1_idx < num_points - 1 && world_z[p1_idx + 1] <= z_pos) {
+            p1_idx++;
         }
-    }
 
-    float s = 4.0f;
-    vec2 player_dot[4] = {
-        {center_pos_xz[0]-s, center_pos_xz[1]-s}, {center_pos_xz[0]+s, center_pos_xz[1]-s},
-        {center_pos_xz[0]+s, center_pos_xz[1]+s}, {center_pos_xz[0]-s, center_pos_xz[1]+s}
-    };
-    _RGL_DrawMapPolygon(map_vao, map_vbo, player_dot, 4, player_color);
+        int p0_idx = (p1_idx > 0) ? p1_idx - 1 : 0;
+        int p2_idx = (p1_idx + 1 < num_points) ? p1_idx + 1 : num_points - 1;
+        int p3_idx = (p1_idx + 2 < num_points) ? p1_idx + 2 : num_points - 1;
 
-    glDeleteBuffers(1, &map_vbo);
-    glDeleteVertexArrays(1, &map_vao);
-    RGL_ResetRenderTarget();
+        float segment_length_z = world_z[p2_idx] - world_z[p1_idx];
+        float t = (segment_length_z > 0.0001f) ? (z_pos - world_z[p1_idx]) / segment_length_z : 0.0f;
+        t = fmaxf(0.0f, fminf(1.0f, t));
 
-    int width, height;
-    SituationGetVirtualDisplaySize(RGL.active_virtual_display_id, &width, &height);
-    if(width > 0 && height > 0) glViewport(0, 0, width, height);
+        samples->x_offset[s]     = _catmull_rom(path->x_offset[p0_idx], path->x_offset[p1_idx], path->x_offset[p2_idx], path->x_offset[p3_idx], t);
+        samples->y_offset[s]     = _catmull_rom(path->y_offset[p0_idx], path->y_offset[p1_idx], path->y_offset[p2_idx], path->y_offset[p3_idx], t);
+        samples->roll_degrees[s] = _lerp(path->roll_degrees[p1_idx], path->roll_degrees[p2_idx], t);
+        samples->ribbon_width[s] = _lerp(path->ribbon_width[p1_idx], path->ribbon_width[p2_idx], t);
+        samples->split_offset[s] = _lerp(path->split_offset[p1_idx], path->split_offset[p2_idx], t);
+        samples->split_width[s]  = _lerp(path->split_width[p1_idx], path->split_width[p2_idx], t);
+        samples->rumble_width[s] = _lerp(path->rumble_width[p1_idx], path->rumble_width[p2_idx], t);
+        samples->point_index[s]  = p1_idx;
+    }
+
+    samples->count = count;
+    samples->start_z = start_z;
+    samples->valid = true;
+    path->gpu_road.valid = false; // The GPU copy is re-uploaded from the new samples on its next draw
+    return true;
 }
 
 /**
- * @brief Queries the active path for a junction at the player's position and returns all available choices.
+ * @brief (INTERNAL) Releases a path's sample cache.
+ * @param path The path whose cache to free.
+ */
+static void _RGL_FreePathSamples(RGLPathData* path) {
+    free(path->samples.x_offset);
+    memset(&path->samples, 0, sizeof(RGLPathSamples));
+}
+
+/**
+ * @brief (INTERNAL) Reads the path's curve at a Z position from its sample cache.
  *
- * This is the definitive function for handling all path network topology. It finds the nearest
- * RGL_SCENERY_JUNCTION_TRIGGER and populates the `out_info` struct with the type of junction
- * and all valid destination paths.
+ * Read-only, so it is safe from any thread: if the path was edited and its cache not yet rebuilt
+ * (see _RGL_BuildPathSamples), the curve is evaluated straight from the control points instead.
+ * Z is wrapped for looping paths; between samples the values are linearly interpolated and
+ * appearance follows the lower sample.
  *
- * @param player_z The current Z-position of the player on the active path.
- * @param search_radius The forward distance (in world units) to look for a junction trigger.
- * @param out_info A pointer to an RGLJunctionInfo struct to store the complete result.
- * @return True if a junction trigger was found within the search radius, false otherwise.
+ * @param path The path to query. May be NULL.
+ * @param z_pos The world Z position to query.
+ * @param out_sample Receives the sampled curve values.
+ * @return True on success, false if the path is NULL or has too few points to sample.
  */
-SITAPI bool RGL_QueryJunction(float player_z, float search_radius, RGLJunctionInfo* out_info) {
-    if (!out_info) {
-        return false;
+static bool _RGL_SamplePathAt(const RGLPathData* path, float z_pos, RGLPathSample* out_sample) {
+    if (!path || path->num_points < 4) return false;
+    if (!path->samples.valid) {
+        int cursor = 0;
+        _RGL_EvaluatePathSample(path, z_pos, &cursor, out_sample);
+        return true;
     }
-    memset(out_info, 0, sizeof(RGLJunctionInfo));
-    out_info->is_valid = false;
 
-    RGLPathData* path = _RGL_GetActivePathData();
-    if (!path || path->num_points == 0) {
-        return false;
-    }
+    const RGLPathSamples* samples = &path->samples;
+    float f = (_RGL_WrapPathZ(path, z_pos) - samples->start_z) * (1.0f / RGL_PATH_SAMPLE_SPACING);
+    f = fmaxf(0.0f, fminf(f, (float)(samples->count - 1)));
 
-    // Define the Z-range to search for a junction trigger
-    const float start_z = player_z;
-    const float end_z = player_z + search_radius;
+    size_t i = (size_t)f;
+    size_t j = (i + 1 < samples->count) ? i + 1 : i;
+    float t = f - (float)i;
 
-    // Find the starting path point for our search
-    int start_idx = _RGL_FindPathPointIndexAt(path->points, path->num_points, start_z);
-    if (start_idx == -1) {
-        return false; // Search range is completely off the path
-    }
+    out_sample->x_offset     = _lerp(samples->x_offset[i], samples->x_offset[j], t);
+    out_sample->y_offset     = _lerp(samples->y_offset[i], samples->y_offset[j], t);
+    out_sample->roll_degrees = _lerp(samples->roll_degrees[i], samples->roll_degrees[j], t);
+    out_sample->ribbon_width = _lerp(samples->ribbon_width[i], samples->ribbon_width[j], t);
+    out_sample->split_offset = _lerp(samples->split_offset[i], samples->split_offset[j], t);
+    out_sample->split_width  = _lerp(samples->split_width[i], samples->split_width[j], t);
+    out_sample->rumble_width = _lerp(samples->rumble_width[i], samples->rumble_width[j], t);
+    out_sample->point_index  = samples->point_index[i];
+    return true;
+}
 
-    // --- Direct Search Loop (from start_idx to the end of the path or search radius) ---
-    for (int i = start_idx; i < path->num_points; i++) {
-        RGLPathPoint* p = &path->points[i];
+/**
+ * @brief (INTERNAL) Moves a segment bookmark to the segment holding z_pos (already wrapped).
+ * Walks forward (the common case) or backward from the bookmark, which is first clamped so a stale
+ * or foreign cursor is always safe. Only the Z array is touched.
+ * @return The index of the segment's first control point, also stored back into the cursor.
+ */
+static int _RGL_SeekPathSegment(const RGLPathData* path, float z_pos, int* cursor) {
+    const float* world_z = path->world_z;
+    int num_points = (int)path->num_points;
+    int p1_idx = *cursor;
+    if (p1_idx < 0 || p1_idx >= num_points) p1_idx = 0;
 
-        // Stop if we've searched past the end of our radius
-        if (p->world_z > end_z) {
-            break;
-        }
+    while (p1_idx < num_points - 1 && world_z[p1_idx + 1] <= z_pos) {
+        p1_idx++;
+    }
+    while (p1_idx > 0 && world_z[p1_idx] > z_pos) {
+        p1_idx--;
+    }
 
-        // Create a lambda to check a scenery slot and populate our struct if it's a junction.
-        // REPLACED LAMBDA WITH MACRO FOR C COMPATIBILITY
-        #define CHECK_AND_POPULATE(scenery_ptr) do { \
-            if ((scenery_ptr)->type == RGL_SCENERY_JUNCTION_TRIGGER) { \
-                out_info->is_valid = true; \
-                out_info->type = (scenery_ptr)->data.junction.type; \
-                memcpy(&out_info->choice_left, &(scenery_ptr)->data.junction.connect_left, sizeof(out_info->choice_left)); \
-                memcpy(&out_info->choice_right, &(scenery_ptr)->data.junction.connect_right, sizeof(out_info->choice_right)); \
-                memcpy(&out_info->choice_straight, &(scenery_ptr)->data.junction.connect_straight, sizeof(out_info->choice_straight)); \
-                return true; \
-            } \
-        } while(0)
+    *cursor = p1_idx;
+    return p1_idx;
+}
 
-        // Check all three scenery slots at this path point.
-        CHECK_AND_POPULATE(&p->scenery_left);
-        CHECK_AND_POPULATE(&p->scenery_right);
-        CHECK_AND_POPULATE(&p->scenery_overhead);
+/**
+ * @brief (INTERNAL) Evaluates the curve's geometry at a Z position from the control points.
+ * Catmull-Rom for the centerline, linear for the widths and roll; the same math the sample cache is
+ * built with. The path must have at least 4 points. Reads nothing but the path and the cursor.
+ */
+static void _RGL_EvaluatePathSample(const RGLPathData* path, float z_pos, int* cursor, RGLPathSample* out_sample) {
+    z_pos = _RGL_WrapPathZ(path, z_pos);
+    const float* world_z = path->world_z;
+    int num_points = (int)path->num_points;
+    int p1_idx = _RGL_SeekPathSegment(path, z_pos, cursor);
+
+    int p0_idx = (p1_idx > 0) ? p1_idx - 1 : 0;
+    int p2_idx = (p1_idx + 1 < num_points) ? p1_idx + 1 : num_points - 1;
+    int p3_idx = (p1_idx + 2 < num_points) ? p1_idx + 2 : num_points - 1;
+
+    float segment_length_z = world_z[p2_idx] - world_z[p1_idx];
+    float t = (segment_length_z > 0.0001f) ? (z_pos - world_z[p1_idx]) / segment_length_z : 0.0f;
+    t = fmaxf(0.0f, fminf(1.0f, t));
 
-        #undef CHECK_AND_POPULATE
-    }
+    out_sample->x_offset     = _catmull_rom(path->x_offset[p0_idx], path->x_offset[p1_idx], path->x_offset[p2_idx], path->x_offset[p3_idx], t);
+    out_sample->y_offset     = _catmull_rom(path->y_offset[p0_idx], path->y_offset[p1_idx], path->y_offset[p2_idx], path->y_offset[p3_idx], t);
+    out_sample->roll_degrees = _lerp(path->roll_degrees[p1_idx], path->roll_degrees[p2_idx], t);
+    out_sample->ribbon_width = _lerp(path->ribbon_width[p1_idx], path->ribbon_width[p2_idx], t);
+    out_sample->split_offset = _lerp(path->split_offset[p1_idx], path->split_offset[p2_idx], t);
+    out_sample->split_width  = _lerp(path->split_width[p1_idx], path->split_width[p2_idx], t);
+    out_sample->rumble_width = _lerp(path->rumble_width[p1_idx], path->rumble_width[p2_idx], t);
+    out_sample->point_index  = p1_idx;
+}
 
-    // No junction trigger was found in the search range.
-    return false;
+/**
+ * @brief (INTERNAL) Evaluates a full RGLPathPoint at a Z position from the control points.
+ * Appearance and scenery are not interpolated; they come from the segment's first point.
+ */
+static void _RGL_EvaluatePathPoint(const RGLPathData* path, float z_pos, int* cursor, RGLPathPoint* out_point) {
+    RGLPathSample geometry;
+    _RGL_EvaluatePathSample(path, z_pos, cursor, &geometry);
+
+    out_point->world_z = _RGL_WrapPathZ(path, z_pos);
+    out_point->world_x_offset       = geometry.x_offset;
+    out_point->world_y_offset       = geometry.y_offset;
+    out_point->path_roll_degrees    = geometry.roll_degrees;
+    out_point->primary_ribbon_width = geometry.ribbon_width;
+    out_point->split_offset         = geometry.split_offset;
+    out_point->split_width          = geometry.split_width;
+    out_point->rumble_width         = geometry.rumble_width;
+
+    const RGLPathAppearance* look = &path->appearance[geometry.point_index];
+    const RGLPathScenery* scenery = &path->scenery[geometry.point_index];
+    out_point->split_surface_texture   = look->split_surface_texture;
+    out_point->split_surface_color     = look->split_surface_color;
+    out_point->split_lanes          = look->split_lanes;
+    out_point->primary_lanes        = look->primary_lanes;
+    out_point->surface_texture         = look->surface_texture;
+    out_point->color_surface           = look->color_surface;
+    out_point->color_rumble         = look->color_rumble;
+    out_point->color_lines          = look->color_lines;
+    out_point->scenery_left         = scenery->left;
+    out_point->scenery_right        = scenery->right;
+    out_point->scenery_overhead     = scenery->overhead;
+    out_point->user_tag             = scenery->user_tag;
 }
 
 /**
- * @brief (INTERNAL, PURE) Binary search to find the index of the first path point at or after a given Z position.
- * This is a critical performance helper for queries, running in O(log n) time.
- * @param points A pointer to the array of path points to search.
- * @param num_points The number of points in the array.
- * @param z_pos The world Z-coordinate to search for.
- * @return The index of the first point >= z_pos, or -1 if all points are before z_pos.
+ * @brief (INTERNAL) Classifies a world X across a sampled path cross-section.
+ * Checks the primary ribbon, then the split ribbon, each with its rumble shoulder; banked surfaces
+ * raise the ground toward the outer edge. Anything else is flat off-path ground at the centerline height.
  */
-static int _RGL_FindPathPointIndexAt(RGLPathPoint* points, size_t num_points, float z_pos) {
-    if (!points || num_points == 0) return -1;
+static void _RGL_ClassifyGround(const RGLPathSample* props, float world_x, RGLGroundInfo* out_info) {
+    out_info->is_hit = true;
+    out_info->ground_y = props->y_offset;
+    out_info->type = RGL_GROUND_TYPE_OFF_PATH;
 
-    int low = 0;
-    int high = num_points - 1;
-    int result = -1;
+    float Path_center_x = props->x_offset;
+    float primary_half_width = props->ribbon_width * 0.5f;
+    float primary_rumble_half_width = primary_half_width + props->rumble_width;
+    float dx_primary = world_x - Path_center_x;
 
-    while (low <= high) {
-        int mid = low + (high - low) / 2;
-        if (points[mid].world_z >= z_pos) {
-            result = mid;
-            high = mid - 1;
-        } else {
-            low = mid + 1;
+    // Check primary Path
+    if (fabsf(dx_primary) < primary_rumble_half_width) {
+        _RGL_CalculateBankedNormal(props->roll_degrees, out_info->surface_normal);
+
+        // Adjust ground height based on banking (outer edge of a banked turn is higher)
+        float banking_height_offset = sinf(glm_rad(props->roll_degrees)) * dx_primary;
+        out_info->ground_y += banking_height_offset;
+
+        out_info->type = (fabsf(dx_primary) < primary_half_width) ? RGL_GROUND_TYPE_PATH : RGL_GROUND_TYPE_SHOULDER;
+        return;
+    }
+
+    // Check split Path
+    if (props->split_width > 0.01f) {
+        float split_center_x = props->x_offset + props->split_offset;
+        float split_half_width = props->split_width * 0.5f;
+        float split_rumble_half_width = split_half_width + props->rumble_width;
+        float dx_split = world_x - split_center_x;
+
+        if (fabsf(dx_split) < split_rumble_half_width) {
+            _RGL_CalculateBankedNormal(props->roll_degrees, out_info->surface_normal);
+            float banking_height_offset = sinf(glm_rad(props->roll_degrees)) * dx_split;
+            out_info->ground_y += banking_height_offset;
+            out_info->type = (fabsf(dx_split) < split_half_width) ? RGL_GROUND_TYPE_PATH : RGL_GROUND_TYPE_SHOULDER;
+            return;
         }
     }
-    return result;
+
+    // Off-Path: use a flat normal
+    glm_vec3_copy((vec3){0.0f, 1.0f, 0.0f}, out_info->surface_normal);
 }
 
 /**
@@ -7558,10 +14331,9 @@ SITAPI void RGL_DrawPathDebugInfo(float player_z, bool show_control_points, bool
     // --- 1. Draw Raw Control Points (User-defined data) ---
     if (show_control_points) {
         for (size_t i = 0; i < Path->num_points; i++) {
-            RGLPathPoint* point = &Path->points[i];
-            if (point->world_z < MIN_Z || point->world_z > MAX_Z) continue;
+            if (Path->world_z[i] < MIN_Z || Path->world_z[i] > MAX_Z) continue;
 
-            vec3 point_pos = {point->world_x_offset, point->world_y_offset, point->world_z};
+            vec3 point_pos = {Path->x_offset[i], Path->y_offset[i], Path->world_z[i]};
 
             // Draw a cube at the control point's location.
             vec3 cube_min, cube_max;
@@ -7572,7 +14344,7 @@ SITAPI void RGL_DrawPathDebugInfo(float player_z, bool show_control_points, bool
 
             // Draw a text label above the control point.
             char label[64];
-            snprintf(label, sizeof(label), "Z:%.1f T:%d", point->world_z, point->user_tag);
+            snprintf(label, sizeof(label), "Z:%.1f T:%d", Path->world_z[i], Path->scenery[i].user_tag);
             // We need to project the 3D world point to 2D screen space for the text.
             mat4 view_proj;
             vec4 screen_pos_h; // Homogeneous coordinates
@@ -7593,9 +14365,9 @@ SITAPI void RGL_DrawPathDebugInfo(float player_z, bool show_control_points, bool
             }
 
             // Draw a line representing the banking normal vector.
-            if (fabsf(point->path_roll_degrees) > 0.1f) {
+            if (fabsf(Path->roll_degrees[i]) > 0.1f) {
                 vec3 bank_normal, bank_end_pos;
-                _RGL_CalculateBankedSurface(point, 0.0f, bank_normal);
+                _RGL_CalculateBankedNormal(Path->roll_degrees[i], bank_normal);
                 glm_vec3_normalize(bank_normal);
                 glm_vec3_scale(bank_normal, 10.0f, bank_end_pos);
                 glm_vec3_add(point_pos, bank_end_pos, bank_end_pos);
@@ -7728,39 +14500,716 @@ static void _RGL_DrawDebugText(const char* text, int x, int y, int size, Color c
     float scale = (float)size / (float)font.char_height;
     vec2 char_size = { font.char_width * scale, font.char_height * scale };
 
-    for (const char* p = text; *p; p++) {
-        if (*p == '\n') {
-            y += char_size[1];
-            x = start_x;
-            continue;
+    for (const char* p = text; *p; p++) {
+        if (*p == '\n') {
+            y += char_size[1];
+            x = start_x;
+            continue;
+        }
+        int char_index = (unsigned char)*p;
+
+        // Calculate source rectangle in the font atlas
+        SitRectangle src_rect = {
+            (float)((char_index % font.chars_per_row) * font.char_width),
+            (float)((char_index / font.chars_per_row) * font.char_height),
+            (float)font.char_width,
+            (float)font.char_height
+        };
+
+        RGLSprite glyph_sprite = { font.atlas_texture, src_rect };
+        Color colors[4] = {color, color, color, color};
+
+        // Use the master drawing function to draw the character at the correct scaled size
+        RGL_DrawSpritePro(
+            glyph_sprite,
+            (vec3){(float)x, (float)y, 0.0f},
+            char_size,
+            (vec2){0.0f, 0.0f}, // Top-left origin
+            (vec3){0.0f, 0.0f, 0.0f}, // No rotation
+            (vec2){0.0f, 0.0f}, // No skew
+            colors,
+            NULL
+        );
+        x += char_size[0];
+    }
+}
+
+// --- Frame Profiler ---
+
+/**
+ * @brief Starts or stops per-frame profiling.
+ * While enabled, each RGL_Begin/RGL_End pair becomes one RGLFrameProfile in a ring of
+ * RGL_PROFILE_FRAME_HISTORY frames. RGL times its own flush stages (sort, vertex assembly, light
+ * culling, upload, draw) as well as path, level, stencil shadow and async upload work; user code can
+ * add zones with RGL_BeginProfileZone. CPU times come from SituationTimerGetTime. GPU times come from
+ * GL_TIMESTAMP queries that are read back RGL_PROFILE_GPU_LATENCY frames later, so they never stall.
+ * @note A frame that is already open keeps recording until its RGL_End. The ring is kept until RGL_Shutdown.
+ */
+SITAPI void RGL_SetProfilingEnabled(bool enabled) {
+    if (!RGL.is_initialized) return;
+    if (enabled && !RGL.profiler.frames) {
+        RGL.profiler.frames = (RGLFrameProfile*)calloc(RGL_PROFILE_FRAME_HISTORY, sizeof(RGLFrameProfile));
+        if (!RGL.profiler.frames) {
+            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate profiler frame ring");
+            return;
+        }
+        glGenQueries(RGL_PROFILE_GPU_LATENCY * (2 + RGL_PROFILE_MAX_ZONES * 2), &RGL.profiler.queries[0][0]);
+    }
+    RGL.profiler.enabled = enabled;
+}
+
+SITAPI bool RGL_IsProfilingEnabled(void) {
+    return RGL.profiler.enabled;
+}
+
+/**
+ * @brief Opens a timed zone in the current profiled frame.
+ * Zones nest; each must be closed with RGL_EndProfileZone before its parent. Zones still open at
+ * RGL_End are closed there. Calls outside a profiled frame, or on a thread recording a command list,
+ * are ignored, so zones can be left in shipping code at the cost of one branch.
+ * @param name Zone label. Only the pointer is stored, so it must stay valid while the frame is in the ring.
+ */
+SITAPI void RGL_BeginProfileZone(const char* name) {
+    if (!RGL.profiler.frame_open || g_rgl_recording_list) return;
+    RGLFrameProfile* frame = &RGL.profiler.frames[RGL.profiler.frame_counter % RGL_PROFILE_FRAME_HISTORY];
+    int depth = RGL.profiler.depth++;
+    if (depth >= RGL_PROFILE_MAX_DEPTH) {
+        frame->dropped_zones++;
+        return;
+    }
+    if (frame->zone_count >= RGL_PROFILE_MAX_ZONES) {
+        frame->dropped_zones++;
+        RGL.profiler.stack[depth] = -1;
+        return;
+    }
+
+    int index = frame->zone_count++;
+    RGLProfileZone* zone = &frame->zones[index];
+    zone->name = name ? name : "(unnamed)";
+    zone->depth = depth;
+    zone->cpu_start_ms = (float)((SituationTimerGetTime() - RGL.profiler.frame_start_time) * 1000.0);
+    zone->cpu_ms = 0.0f;
+    zone->gpu_start_ms = -1.0f;
+    zone->gpu_ms = -1.0f;
+    RGL.profiler.stack[depth] = index;
+    glQueryCounter(RGL.profiler.queries[RGL.profiler.frame_counter % RGL_PROFILE_GPU_LATENCY][2 + index * 2], GL_TIMESTAMP);
+}
+
+SITAPI void RGL_EndProfileZone(void) {
+    if (!RGL.profiler.frame_open || g_rgl_recording_list) return;
+    _RGL_ProfileCloseZone();
+}
+
+static void _RGL_ProfileCloseZone(void) {
+    if (RGL.profiler.depth == 0) return;
+    int depth = --RGL.profiler.depth;
+    if (depth >= RGL_PROFILE_MAX_DEPTH || RGL.profiler.stack[depth] < 0) return; // Dropped when opened
+
+    int index = RGL.profiler.stack[depth];
+    RGLProfileZone* zone = &RGL.profiler.frames[RGL.profiler.frame_counter % RGL_PROFILE_FRAME_HISTORY].zones[index];
+    zone->cpu_ms = (float)((SituationTimerGetTime() - RGL.profiler.frame_start_time) * 1000.0) - zone->cpu_start_ms;
+    glQueryCounter(RGL.profiler.queries[RGL.profiler.frame_counter % RGL_PROFILE_GPU_LATENCY][3 + index * 2], GL_TIMESTAMP);
+}
+
+static void _RGL_ProfileBeginFrame(void) {
+    if (!RGL.profiler.frames) return;
+    if (RGL.profiler.frame_open) _RGL_ProfileEndFrame(); // RGL_Begin without a matching RGL_End
+
+    // 1. --- Pick up finished GPU results; the set this frame reuses is given up on if still pending ---
+    int set = (int)(RGL.profiler.frame_counter % RGL_PROFILE_GPU_LATENCY);
+    for (int i = 0; i < RGL_PROFILE_GPU_LATENCY; i++) _RGL_ResolveProfileQueries(i, i == set);
+    if (!RGL.profiler.enabled) return;
+
+    // 2. --- Open the record ---
+    RGLFrameProfile* frame = &RGL.profiler.frames[RGL.profiler.frame_counter % RGL_PROFILE_FRAME_HISTORY];
+    RGL.profiler.frame_start_time = SituationTimerGetTime();
+    frame->frame_index = RGL.profiler.frame_counter;
+    frame->cpu_start_ms = RGL.profiler.frame_start_time * 1000.0;
+    frame->cpu_ms = 0.0f;
+    frame->gpu_ms = -1.0f;
+    frame->gpu_resolved = false;
+    frame->zone_count = 0;
+    frame->dropped_zones = 0;
+    RGL.profiler.depth = 0;
+
+    glQueryCounter(RGL.profiler.queries[set][0], GL_TIMESTAMP);
+    RGL.profiler.query_frame[set] = RGL.profiler.frame_counter + 1;
+    RGL.profiler.frame_open = true;
+}
+
+static void _RGL_ProfileEndFrame(void) {
+    if (!RGL.profiler.frame_open) return;
+    while (RGL.profiler.depth > 0) _RGL_ProfileCloseZone(); // Zones left open by the caller
+
+    RGLFrameProfile* frame = &RGL.profiler.frames[RGL.profiler.frame_counter % RGL_PROFILE_FRAME_HISTORY];
+    frame->cpu_ms = (float)((SituationTimerGetTime() - RGL.profiler.frame_start_time) * 1000.0);
+    glQueryCounter(RGL.profiler.queries[RGL.profiler.frame_counter % RGL_PROFILE_GPU_LATENCY][1], GL_TIMESTAMP);
+    RGL.profiler.frame_open = false;
+    RGL.profiler.frame_counter++;
+}
+
+/**
+ * @brief (INTERNAL) Copies a query set's timestamps into the frame record it belongs to.
+ * Timestamps complete in submission order, so once the frame-end query is available every zone query is too.
+ * @param discard_pending If the results are not ready yet, give up on them (the set is about to be reused)
+ *        and leave the frame's GPU times at -1 rather than stall.
+ */
+static void _RGL_ResolveProfileQueries(int set, bool discard_pending) {
+    uint64_t tagged_frame = RGL.profiler.query_frame[set];
+    if (tagged_frame == 0) return;
+    const GLuint* queries = RGL.profiler.queries[set];
+
+    GLint available = 0;
+    glGetQueryObjectiv(queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        if (discard_pending) RGL.profiler.query_frame[set] = 0;
+        return;
+    }
+    RGL.profiler.query_frame[set] = 0;
+
+    RGLFrameProfile* frame = &RGL.profiler.frames[(tagged_frame - 1) % RGL_PROFILE_FRAME_HISTORY];
+    if (frame->frame_index != tagged_frame - 1) return;
+
+    GLuint64 frame_begin = 0, frame_end = 0;
+    glGetQueryObjectui64v(queries[0], GL_QUERY_RESULT, &frame_begin);
+    glGetQueryObjectui64v(queries[1], GL_QUERY_RESULT, &frame_end);
+    frame->gpu_ms = (float)((double)(frame_end - frame_begin) * 1e-6);
+    for (int i = 0; i < frame->zone_count; i++) {
+        GLuint64 zone_begin = 0, zone_end = 0;
+        glGetQueryObjectui64v(queries[2 + i * 2], GL_QUERY_RESULT, &zone_begin);
+        glGetQueryObjectui64v(queries[3 + i * 2], GL_QUERY_RESULT, &zone_end);
+        frame->zones[i].gpu_start_ms = (float)((double)(zone_begin - frame_begin) * 1e-6);
+        frame->zones[i].gpu_ms = (float)((double)(zone_end - zone_begin) * 1e-6);
+    }
+    frame->gpu_resolved = true;
+}
+
+static void _RGL_ShutdownProfiler(void) {
+    if (RGL.profiler.frames) {
+        glDeleteQueries(RGL_PROFILE_GPU_LATENCY * (2 + RGL_PROFILE_MAX_ZONES * 2), &RGL.profiler.queries[0][0]);
+        free(RGL.profiler.frames);
+    }
+    memset(&RGL.profiler, 0, sizeof(RGL.profiler));
+}
+
+SITAPI int RGL_GetProfileFrameCount(void) {
+    if (!RGL.profiler.frames) return 0;
+    return RGL.profiler.frame_counter < RGL_PROFILE_FRAME_HISTORY ? (int)RGL.profiler.frame_counter : RGL_PROFILE_FRAME_HISTORY;
+}
+
+/**
+ * @brief Copies a completed frame's timings out of the profiler ring.
+ * GPU times of the newest RGL_PROFILE_GPU_LATENCY frames are usually still -1 (gpu_resolved is false).
+ * @param frames_ago 0 for the most recently completed frame, up to RGL_GetProfileFrameCount() - 1.
+ */
+SITAPI bool RGL_GetFrameProfile(int frames_ago, RGLFrameProfile* out_profile) {
+    if (!out_profile || frames_ago < 0 || frames_ago >= RGL_GetProfileFrameCount()) return false;
+    *out_profile = RGL.profiler.frames[(RGL.profiler.frame_counter - 1 - (uint64_t)frames_ago) % RGL_PROFILE_FRAME_HISTORY];
+    return true;
+}
+
+static void _RGL_TraceAppend(char* buf, size_t buf_size, size_t* length, const char* format, ...) {
+    char* dst = (buf && *length < buf_size) ? buf + *length : NULL;
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(dst, dst ? buf_size - *length : 0, format, args);
+    va_end(args);
+    if (written > 0) *length += (size_t)written;
+}
+
+static void _RGL_TraceAppendEvent(char* buf, size_t buf_size, size_t* length, const char* name, int tid, double start_us, double duration_us) {
+    // Zone names are caller strings: escape them for JSON and drop control characters.
+    char escaped[128];
+    size_t out = 0;
+    for (const char* c = name; *c && out + 2 < sizeof(escaped); c++) {
+        if ((unsigned char)*c < 0x20) continue;
+        if (*c == '"' || *c == '\\') escaped[out++] = '\\';
+        escaped[out++] = *c;
+    }
+    escaped[out] = '\0';
+    _RGL_TraceAppend(buf, buf_size, length, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                     escaped, tid, start_us, duration_us);
+}
+
+/**
+ * @brief Exports every frame in the profiler ring as Chrome trace event JSON.
+ * Open the output in chrome://tracing or ui.perfetto.dev. CPU zones are on thread 1 on the
+ * SituationTimerGetTime clock. GPU zones are on thread 2, placed from the start of their CPU frame,
+ * because the GPU clock is not synchronised with the CPU one.
+ * @param buf Destination, or NULL with buf_size 0 to measure.
+ * @return The length of the full trace excluding the terminator; it was truncated if this is >= buf_size.
+ */
+SITAPI size_t RGL_ExportProfileTrace(char* buf, size_t buf_size) {
+    size_t length = 0;
+    if (buf && buf_size > 0) buf[0] = '\0';
+    _RGL_TraceAppend(buf, buf_size, &length,
+                     "{\"traceEvents\":[\n"
+                     "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"RGL\"}},\n"
+                     "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n"
+                     "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}");
+
+    // Oldest frame first.
+    for (int ago = RGL_GetProfileFrameCount() - 1; ago >= 0; ago--) {
+        const RGLFrameProfile* frame = &RGL.profiler.frames[(RGL.profiler.frame_counter - 1 - (uint64_t)ago) % RGL_PROFILE_FRAME_HISTORY];
+        double frame_us = frame->cpu_start_ms * 1000.0;
+        char frame_name[32];
+        snprintf(frame_name, sizeof(frame_name), "Frame %llu", (unsigned long long)frame->frame_index);
+
+        _RGL_TraceAppendEvent(buf, buf_size, &length, frame_name, 1, frame_us, frame->cpu_ms * 1000.0);
+        if (frame->gpu_resolved) _RGL_TraceAppendEvent(buf, buf_size, &length, frame_name, 2, frame_us, frame->gpu_ms * 1000.0);
+        for (int i = 0; i < frame->zone_count; i++) {
+            const RGLProfileZone* zone = &frame->zones[i];
+            _RGL_TraceAppendEvent(buf, buf_size, &length, zone->name, 1, frame_us + zone->cpu_start_ms * 1000.0, zone->cpu_ms * 1000.0);
+            if (zone->gpu_ms >= 0.0f) {
+                _RGL_TraceAppendEvent(buf, buf_size, &length, zone->name, 2, frame_us + zone->gpu_start_ms * 1000.0, zone->gpu_ms * 1000.0);
+            }
+        }
+    }
+    _RGL_TraceAppend(buf, buf_size, &length, "\n]}\n");
+    return length;
+}
+
+/**
+ * @brief Writes RGL_ExportProfileTrace output to a file.
+ * @return True on success. Errors are reported via SituationGetLastErrorMsg().
+ */
+SITAPI bool RGL_SaveProfileTrace(const char* file_path) {
+    if (!file_path) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_INVALID_PARAM, "RGL_SaveProfileTrace: file_path is NULL.");
+        return false;
+    }
+    size_t length = RGL_ExportProfileTrace(NULL, 0);
+    char* json = (char*)malloc(length + 1);
+    if (!json) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate profile trace buffer");
+        return false;
+    }
+    RGL_ExportProfileTrace(json, length + 1);
+
+    FILE* file = fopen(file_path, "wb");
+    if (!file) {
+        free(json);
+        _SituationSetErrorFromCode(SITUATION_ERROR_FILE_ACCESS, "Failed to open profile trace file for writing.");
+        return false;
+    }
+    bool success = fwrite(json, 1, length, file) == length;
+    success = (fclose(file) == 0) && success;
+    free(json);
+    if (!success) _SituationSetErrorFromCode(SITUATION_ERROR_FILE_ACCESS, "Failed to write profile trace file.");
+    return success;
+}
+
+#ifdef RGL_ENABLE_BENCHMARKS
+// --- Benchmarks ---
+
+static const char* const g_rgl_benchmark_names[RGL_BENCHMARK_COUNT] = { "sprites", "path", "level", "lights", "text" };
+#define RGL_BENCHMARK_PATH_NAME "__rgl_benchmark_path"
+#define RGL_BENCHMARK_LEVEL_NAME "__rgl_benchmark_level"
+
+/**
+ * @brief Gets the standard benchmark configuration.
+ * Keep the defaults fixed between releases; only compare runs made with the same configuration.
+ */
+SITAPI RGLBenchmarkConfig RGL_GetDefaultBenchmarkConfig(void) {
+    RGLBenchmarkConfig config = {0};
+    config.scenarios = 0;
+    config.seed = 0x52474C31u; // "RGL1"
+    config.frames = 120;
+    config.warmup_frames = 10;
+    config.virtual_display_id = -1;
+    config.cpu_only = false;
+    config.sprite_count = 20000;
+    config.path_point_count = 100000;
+    config.draw_distances[0] = 50;
+    config.draw_distances[1] = 200;
+    config.draw_distances[2] = 800;
+    config.draw_distance_count = 3;
+    config.level_grid = 32;
+    config.light_count = 64;
+    config.stencil_casters = 16;
+    config.text_lines = 48;
+    return config;
+}
+
+/**
+ * @brief (INTERNAL) xorshift32 in [0, 1); the same seed gives the same scene on every machine and release.
+ */
+static float _RGL_BenchmarkRandom(RGLBenchmarkScene* scene) {
+    uint32_t x = scene->random_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    scene->random_state = x;
+    return (float)(x >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief (INTERNAL) Runs warmup plus measured frames of one scenario and averages the frame stats.
+ */
+static void _RGL_BenchmarkMeasure(RGLBenchmarkScene* scene, RGLBenchmarkScenario scenario, int variant, void (*draw_frame)(RGLBenchmarkScene* scene, int frame), RGLBenchmarkResult* out_result) {
+    const RGLBenchmarkConfig* config = scene->config;
+    double seconds = 0.0, commands = 0.0, flushes = 0.0, draw_calls = 0.0, bytes = 0.0;
+
+    for (int frame = 0; frame < config->warmup_frames + config->frames; frame++) {
+        double start_time = SituationTimerGetTime();
+        RGL_Begin(config->virtual_display_id);
+        draw_frame(scene, frame);
+        RGL_End();
+        double elapsed = SituationTimerGetTime() - start_time;
+        if (frame < config->warmup_frames) continue;
+
+        // RGL_Begin resets the per-frame stats, so they still describe this frame here.
+        seconds += elapsed;
+        commands += RGL.stats.commands_flushed;
+        flushes += (double)RGL.stats.batch_flushes;
+        draw_calls += (double)RGL.stats.total_draw_calls;
+        bytes += (double)RGL.stats.bytes_uploaded;
+    }
+
+    double frames = (double)config->frames;
+    memset(out_result, 0, sizeof(RGLBenchmarkResult));
+    out_result->scenario = scenario;
+    out_result->variant = variant;
+    out_result->frames = config->frames;
+    out_result->cpu_ms = seconds * 1000.0 / frames;
+    out_result->commands = commands / frames;
+    out_result->ns_per_command = commands > 0.0 ? seconds * 1e9 / commands : 0.0;
+    out_result->flushes = flushes / frames;
+    out_result->draw_calls = draw_calls / frames;
+    out_result->bytes_uploaded = bytes / frames;
+}
+
+/** @brief (INTERNAL) Sprite scenario frame: the whole field through RGL_DrawSpritePro, spinning. */
+static void _RGL_BenchmarkDrawSprites(RGLBenchmarkScene* scene, int frame) {
+    for (int i = 0; i < scene->item_count; i++) {
+        RGLBenchmarkSprite* item = &scene->items[i];
+        Color colors[4] = { item->color, item->color, item->color, item->color };
+        RGL_DrawSpritePro(scene->sprites[item->sprite], item->position, item->size, (vec2){0.5f, 0.5f},
+                          (vec3){0.0f, 0.0f, item->rotation_deg + (float)frame}, (vec2){0.0f, 0.0f}, colors, NULL);
+    }
+}
+
+/** @brief (INTERNAL) Path scenario frame: a chase camera moving down the road. */
+static void _RGL_BenchmarkDrawPath(RGLBenchmarkScene* scene, int frame) {
+    float z = 100.0f + (float)frame * 4.0f;
+    RGLPathPoint here;
+    if (!RGL_GetPathPropertiesAt(z, &here)) return;
+    RGL_SetCamera3D((Vector3){here.world_x_offset, here.world_y_offset + 5.0f, z - 15.0f},
+                    (Vector3){here.world_x_offset, here.world_y_offset + 2.0f, z + 50.0f},
+                    (Vector3){0.0f, 1.0f, 0.0f}, RGL_DEFAULT_FOV_DEGREES);
+    RGL_DrawPath(z, scene->draw_distance);
+}
+
+/** @brief (INTERNAL) Level scenario frame: a camera orbiting the maze. */
+static void _RGL_BenchmarkDrawLevel(RGLBenchmarkScene* scene, int frame) {
+    float half = scene->level_extent * 0.5f;
+    float angle = (float)frame * 0.02f;
+    RGL_SetCamera3D((Vector3){half + cosf(angle) * half * 0.6f, 12.0f, half + sinf(angle) * half * 0.6f},
+                    (Vector3){half, 0.0f, half}, (Vector3){0.0f, 1.0f, 0.0f}, RGL_DEFAULT_FOV_DEGREES);
+    RGL_DrawLevel();
+}
+
+/** @brief (INTERNAL) Light scenario frame: moving point lights over a tiled floor with stencil-shadowed cubes. */
+static void _RGL_BenchmarkDrawLights(RGLBenchmarkScene* scene, int frame) {
+    const float tile = 4.0f, extent = 48.0f * 4.0f;
+    RGL_SetCamera3D((Vector3){extent * 0.5f, 60.0f, -20.0f}, (Vector3){extent * 0.5f, 0.0f, extent * 0.5f},
+                    (Vector3){0.0f, 1.0f, 0.0f}, RGL_DEFAULT_FOV_DEGREES);
+
+    // 1. --- Move every light so the cluster grid is rebuilt each frame ---
+    for (int i = 0; i < scene->light_count; i++) {
+        float angle = (float)frame * 0.03f + (float)i * 0.7f;
+        float radius = extent * (0.15f + 0.3f * (float)(i % 8) / 8.0f);
+        RGL_SetLightPosition(scene->light_ids[i], (Vector3){extent * 0.5f + cosf(angle) * radius, 6.0f, extent * 0.5f + sinf(angle) * radius});
+    }
+
+    // 2. --- Lit floor and the caster cubes ---
+    for (int z = 0; z < 48; z++) {
+        for (int x = 0; x < 48; x++) {
+            float x0 = x * tile, z0 = z * tile;
+            RGL_DrawQuad3D((Vector3){x0, 0.0f, z0}, (Vector3){x0 + tile, 0.0f, z0}, (Vector3){x0 + tile, 0.0f, z0 + tile},
+                           (Vector3){x0, 0.0f, z0 + tile}, (Vector3){0.0f, 1.0f, 0.0f}, scene->sprites[1 + ((x + z) % 3)], WHITE, 0.2f);
+        }
+    }
+    for (int i = 0; i < scene->item_count; i++) {
+        RGL_DrawCube((Vector3){scene->items[i].position[0], scene->items[i].position[1], scene->items[i].position[2]},
+                     scene->items[i].size[0], (RGLMaterial){ scene->items[i].color, 0.2f });
+    }
+
+    // 3. --- One stencil pass for all casters (GPU work only, so skipped in cpu_only runs) ---
+    if (scene->config->cpu_only || scene->item_count == 0 || scene->light_count == 0 || scene->caster_mesh.id == 0) return;
+    RGLShadowConfig shadow = { scene->light_ids[0], (Color){0, 0, 0, 140}, 100.0f };
+    RGL_BeginStencilShadows(&shadow);
+    for (int i = 0; i < scene->item_count; i++) {
+        mat4 transform;
+        glm_translate_make(transform, scene->items[i].position);
+        glm_scale_uni(transform, scene->items[i].size[0]);
+        RGL_CastStencilShadowFromMesh(scene->caster_mesh, transform, &shadow);
+    }
+    RGL_EndStencilShadows();
+}
+
+/** @brief (INTERNAL) Text scenario frame: HUD-style lines in the debug font, half of them reformatted every frame. */
+static void _RGL_BenchmarkDrawText(RGLBenchmarkScene* scene, int frame) {
+    static const char* const static_lines[] = {
+        "LAP 3/5", "POSITION 2ND", "BEST 01:12.48", "FUEL", "GEAR", "TURBO READY",
+        "CHECKPOINT AHEAD", "PRESS START", "HI-SCORE 0123450", "WRONG WAY"
+    };
+    if (!RGL.debug.font_initialized && !_RGL_InitDebugTextSystem()) return;
+    char line[64];
+    for (int i = 0; i < scene->config->text_lines; i++) {
+        vec2 position = { 16.0f + (float)(i % 3) * 240.0f, 16.0f + (float)(i / 3) * 18.0f };
+        const char* text = static_lines[(i / 2) % 10];
+        if (i % 2) {
+            snprintf(line, sizeof(line), "SPEED %3d KM/H  TIME %02d:%05.2f", (frame * 7 + i) % 300, (frame / 3600) % 60, (float)(frame % 3600) / 60.0f);
+            text = line;
+        }
+        RGL_DrawText(text, position, RGL.debug.font, (Color){255, 255, (unsigned char)(i * 16), 255});
+    }
+}
+
+/**
+ * @brief (INTERNAL) Builds the path scenario's road: S-curves, hills, banking, and a scenery sprite every 8 points.
+ */
+static bool _RGL_BenchmarkBuildPath(RGLBenchmarkScene* scene) {
+    if (!RGL_CreatePath(RGL_BENCHMARK_PATH_NAME)) return false;
+    for (int i = 0; i < scene->config->path_point_count; i++) {
+        RGLPathPoint point = {0};
+        point.world_z = (float)i * RGL_PATH_SAMPLE_SPACING;
+        point.world_x_offset = sinf((float)i / 50.0f) * 300.0f;
+        point.world_y_offset = sinf((float)i / 20.0f) * 10.0f;
+        point.path_roll_degrees = sinf((float)i / 80.0f) * 8.0f;
+        point.primary_ribbon_width = 20.0f;
+        point.primary_lanes = 2 + (i / 2000) % 3;
+        point.rumble_width = 2.0f;
+        point.color_surface = (i / 3) % 2 ? (Color){80, 80, 80, 255} : (Color){90, 90, 90, 255};
+        point.color_rumble = (i / 3) % 2 ? (Color){200, 0, 0, 255} : WHITE;
+        point.color_lines = WHITE;
+        if (i % 8 == 0) {
+            RGLScenery* side = _RGL_BenchmarkRandom(scene) < 0.5f ? &point.scenery_left : &point.scenery_right;
+            side->type = RGL_SCENERY_SPRITE;
+            side->x_offset = (side == &point.scenery_left ? -1.0f : 1.0f) * (16.0f + _RGL_BenchmarkRandom(scene) * 20.0f);
+            side->data.visual.sprite = scene->sprites[2];
+            side->data.visual.size_in_world_units[0] = 4.0f;
+            side->data.visual.size_in_world_units[1] = 8.0f;
+        }
+        RGL_AddPathPoint(RGL_BENCHMARK_PATH_NAME, point);
+    }
+    return RGL_SetActivePath(RGL_BENCHMARK_PATH_NAME);
+}
+
+/**
+ * @brief (INTERNAL) Builds the level scenario's maze: a floor per cell, walls on about half the cell edges, a thing per cell.
+ */
+static bool _RGL_BenchmarkBuildLevel(RGLBenchmarkScene* scene) {
+    const int grid = scene->config->level_grid;
+    const float cell = 8.0f;
+    if (grid <= 0 || !RGL_CreateLevel(RGL_BENCHMARK_LEVEL_NAME)) return false;
+    scene->level_extent = grid * cell;
+
+    for (int z = 0; z <= grid; z++) {
+        for (int x = 0; x <= grid; x++) RGL_AddVertex(RGL_BENCHMARK_LEVEL_NAME, (RGLVertex3D_pos){ x * cell, 0.0f, z * cell });
+    }
+    for (int z = 0; z <= grid; z++) {
+        for (int x = 0; x <= grid; x++) {
+            int v = z * (grid + 1) + x;
+            RGLWall wall = {0};
+            wall.top_y = 3.0f + _RGL_BenchmarkRandom(scene) * 3.0f;
+            wall.texture = scene->sprites[1 + (x + z) % 3];
+            wall.u_scale = wall.v_scale = 1.0f;
+            wall.brightness = 0.8f;
+            wall.start_vertex = v;
+            if (x < grid && _RGL_BenchmarkRandom(scene) < 0.5f) { wall.end_vertex = v + 1; RGL_AddWall(RGL_BENCHMARK_LEVEL_NAME, wall); }
+            if (z < grid && _RGL_BenchmarkRandom(scene) < 0.5f) { wall.end_vertex = v + grid + 1; RGL_AddWall(RGL_BENCHMARK_LEVEL_NAME, wall); }
+            if (x == grid || z == grid) continue;
+
+            int corners[4] = { v, v + 1, v + grid + 2, v + grid + 1 };
+            RGLFlat floor = {0};
+            floor.vertex_indices = corners;
+            floor.vertex_count = 4;
+            floor.texture = scene->sprites[1 + (x * 3 + z) % 3];
+            floor.u_scale = floor.v_scale = 1.0f;
+            floor.brightness = 0.7f;
+            RGL_AddFlat(RGL_BENCHMARK_LEVEL_NAME, floor);
+
+            RGLThing thing = {0};
+            thing.x = (x + 0.2f + _RGL_BenchmarkRandom(scene) * 0.6f) * cell;
+            thing.y = 1.0f;
+            thing.z = (z + 0.2f + _RGL_BenchmarkRandom(scene) * 0.6f) * cell;
+            thing.texture = scene->sprites[3];
+            thing.scale = 1.5f;
+            thing.brightness = 1.0f;
+            RGL_AddThing(RGL_BENCHMARK_LEVEL_NAME, thing);
+        }
+    }
+    return RGL_SetActiveLevel(RGL_BENCHMARK_LEVEL_NAME);
+}
+
+/**
+ * @brief (INTERNAL) Pre-generates random sprites: screen-space for the sprite scenario, world-space cubes for the light scenario.
+ */
+static bool _RGL_BenchmarkGenerateItems(RGLBenchmarkScene* scene, int count, bool world_space) {
+    free(scene->items);
+    scene->items = NULL;
+    scene->item_count = 0;
+    if (count <= 0) return true;
+    scene->items = (RGLBenchmarkSprite*)malloc(sizeof(RGLBenchmarkSprite) * (size_t)count);
+    if (!scene->items) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate benchmark sprites");
+        return false;
+    }
+    for (int i = 0; i < count; i++) {
+        RGLBenchmarkSprite* item = &scene->items[i];
+        if (world_space) {
+            item->position[0] = 20.0f + _RGL_BenchmarkRandom(scene) * 152.0f;
+            item->position[1] = 2.0f;
+            item->position[2] = 20.0f + _RGL_BenchmarkRandom(scene) * 152.0f;
+            item->size[0] = item->size[1] = 2.0f + _RGL_BenchmarkRandom(scene) * 3.0f;
+        } else {
+            item->position[0] = _RGL_BenchmarkRandom(scene) * RGL.viewport.width;
+            item->position[1] = _RGL_BenchmarkRandom(scene) * RGL.viewport.height;
+            item->position[2] = _RGL_BenchmarkRandom(scene);
+            item->size[0] = 8.0f + _RGL_BenchmarkRandom(scene) * 32.0f;
+            item->size[1] = 8.0f + _RGL_BenchmarkRandom(scene) * 32.0f;
         }
-        int char_index = (unsigned char)*p;
+        item->rotation_deg = _RGL_BenchmarkRandom(scene) * 360.0f;
+        item->color = (Color){ (unsigned char)(128 + _RGL_BenchmarkRandom(scene) * 127), (unsigned char)(128 + _RGL_BenchmarkRandom(scene) * 127),
+                               (unsigned char)(128 + _RGL_BenchmarkRandom(scene) * 127), _RGL_BenchmarkRandom(scene) < 0.25f ? 160 : 255 };
+        item->sprite = (int)(_RGL_BenchmarkRandom(scene) * 4.0f) & 3;
+    }
+    scene->item_count = count;
+    return true;
+}
 
-        // Calculate source rectangle in the font atlas
-        SitRectangle src_rect = {
-            (float)((char_index % font.chars_per_row) * font.char_width),
-            (float)((char_index / font.chars_per_row) * font.char_height),
-            (float)font.char_width,
-            (float)font.char_height
-        };
+/**
+ * @brief Runs the fixed-seed benchmark scenarios and reports per-frame averages.
+ * Call it outside RGL_Begin/RGL_End; it renders its own frames to config->virtual_display_id and does not
+ * present them. Each scenario creates its own textures, path, level and lights and removes them afterwards,
+ * restoring the active path and level. In cpu_only mode the flushes stop after sorting, vertex assembly and
+ * light binning, so results measure RGL's CPU cost without driver or GPU time (a GL context is still needed,
+ * since RGL_Init creates GL objects).
+ * @param config The run to perform, or NULL for RGL_GetDefaultBenchmarkConfig().
+ * @param out_results Receives one result per scenario, and one per draw distance for the path scenario.
+ * @param max_results Capacity of out_results; RGL_BENCHMARK_COUNT + 3 is always enough.
+ * @return The number of results written.
+ */
+SITAPI int RGL_RunBenchmarks(const RGLBenchmarkConfig* config, RGLBenchmarkResult* out_results, int max_results) {
+    if (!RGL.is_initialized) { _SituationSetErrorFromCode(SITUATION_ERROR_NOT_INITIALIZED, "RGL not initialized"); return 0; }
+    if (RGL.is_batching) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_INVALID_PARAM, "RGL_RunBenchmarks must be called outside RGL_Begin/RGL_End.");
+        return 0;
+    }
+    if (!out_results || max_results <= 0) return 0;
+    RGLBenchmarkConfig defaults = RGL_GetDefaultBenchmarkConfig();
+    if (!config) config = &defaults;
+    if (config->frames <= 0) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_INVALID_PARAM, "RGL_RunBenchmarks: frames must be positive.");
+        return 0;
+    }
+    uint32_t scenarios = config->scenarios ? config->scenarios : (1u << RGL_BENCHMARK_COUNT) - 1u;
 
-        RGLSprite glyph_sprite = { font.atlas_texture, src_rect };
-        Color colors[4] = {color, color, color, color};
+    // 1. --- Shared scene: three tiny textures so the batch has texture changes to sort ---
+    RGLBenchmarkScene scene;
+    memset(&scene, 0, sizeof(scene));
+    scene.config = config;
+    scene.random_state = config->seed ? config->seed : 1u;
+    for (int i = 0; i < 3; i++) {
+        unsigned char pixels[16];
+        for (int p = 0; p < 4; p++) {
+            pixels[p * 4 + 0] = (unsigned char)(i == 0 ? 220 : 90 + p * 30);
+            pixels[p * 4 + 1] = (unsigned char)(i == 1 ? 220 : 90 + p * 30);
+            pixels[p * 4 + 2] = (unsigned char)(i == 2 ? 220 : 90 + p * 30);
+            pixels[p * 4 + 3] = 255;
+        }
+        SituationImage image = { pixels, 2, 2, 4, SITUATION_COLOR_SRGB };
+        scene.textures[i].virtual_display_id = -1;
+        scene.textures[i].is_opaque = true;
+        if (SituationCreateTexture(image, false, &scene.textures[i].texture) != SITUATION_SUCCESS) memset(&scene.textures[i], 0, sizeof(RGLTexture));
+        scene.sprites[1 + i].texture = scene.textures[i];
+        scene.sprites[1 + i].source_rect = (SitRectangle){ 0.0f, 0.0f, 2.0f, 2.0f };
+    }
+
+    int prev_path = RGL.active_Path_index;
+    int prev_level = RGL.active_level_index;
+    RGL.benchmark_cpu_only = config->cpu_only;
+    int result_count = 0;
+
+    // 2. --- Scenarios, each set up and torn down on its own ---
+    if ((scenarios & (1u << RGL_BENCHMARK_SPRITES)) && result_count < max_results) {
+        RGL_Begin(config->virtual_display_id); // Sets RGL.viewport for the placements
+        RGL_End();
+        if (_RGL_BenchmarkGenerateItems(&scene, config->sprite_count, false)) {
+            _RGL_BenchmarkMeasure(&scene, RGL_BENCHMARK_SPRITES, 0, _RGL_BenchmarkDrawSprites, &out_results[result_count++]);
+        }
+    }
+    if ((scenarios & (1u << RGL_BENCHMARK_PATH)) && result_count < max_results && config->path_point_count > 1) {
+        if (_RGL_BenchmarkBuildPath(&scene)) {
+            for (int d = 0; d < config->draw_distance_count && d < 4 && result_count < max_results; d++) {
+                scene.draw_distance = config->draw_distances[d];
+                _RGL_BenchmarkMeasure(&scene, RGL_BENCHMARK_PATH, scene.draw_distance, _RGL_BenchmarkDrawPath, &out_results[result_count++]);
+            }
+        }
+        RGL_DestroyPathByName(RGL_BENCHMARK_PATH_NAME);
+    }
+    if ((scenarios & (1u << RGL_BENCHMARK_LEVEL)) && result_count < max_results) {
+        if (_RGL_BenchmarkBuildLevel(&scene)) {
+            _RGL_BenchmarkMeasure(&scene, RGL_BENCHMARK_LEVEL, 0, _RGL_BenchmarkDrawLevel, &out_results[result_count++]);
+        }
+        RGL_DestroyLevelByName(RGL_BENCHMARK_LEVEL_NAME);
+    }
+    if ((scenarios & (1u << RGL_BENCHMARK_LIGHTS)) && result_count < max_results) {
+        scene.light_ids = (int*)calloc(config->light_count > 0 ? (size_t)config->light_count : 1, sizeof(int));
+        if (scene.light_ids && _RGL_BenchmarkGenerateItems(&scene, config->stencil_casters, true)) {
+            for (int i = 0; i < config->light_count; i++) {
+                Color color = { (unsigned char)(80 + _RGL_BenchmarkRandom(&scene) * 175), (unsigned char)(80 + _RGL_BenchmarkRandom(&scene) * 175),
+                                (unsigned char)(80 + _RGL_BenchmarkRandom(&scene) * 175), 255 };
+                int id = RGL_CreatePointLight((Vector3){0.0f, 6.0f, 0.0f}, color, 20.0f + _RGL_BenchmarkRandom(&scene) * 20.0f, 1.0f);
+                if (id <= 0) break;
+                scene.light_ids[scene.light_count++] = id;
+            }
+            if (config->stencil_casters > 0 && !config->cpu_only) scene.caster_mesh = RGL_GenMeshCube(1.0f, 1.0f, 1.0f);
+            _RGL_BenchmarkMeasure(&scene, RGL_BENCHMARK_LIGHTS, 0, _RGL_BenchmarkDrawLights, &out_results[result_count++]);
+        }
+        for (int i = 0; i < scene.light_count; i++) RGL_DestroyLight(scene.light_ids[i]);
+        if (scene.caster_mesh.id) RGL_DestroyMesh(&scene.caster_mesh);
+        free(scene.light_ids);
+        scene.light_ids = NULL;
+        scene.light_count = 0;
+    }
+    if ((scenarios & (1u << RGL_BENCHMARK_TEXT)) && result_count < max_results) {
+        _RGL_BenchmarkMeasure(&scene, RGL_BENCHMARK_TEXT, 0, _RGL_BenchmarkDrawText, &out_results[result_count++]);
+    }
+
+    // 3. --- Restore the caller's world and drop everything the run created ---
+    RGL.benchmark_cpu_only = false;
+    RGL.light_clusters.built = false; // A cpu_only run binned lights it never uploaded
+    if (prev_path < (int)RGL.Path_count) RGL.active_Path_index = prev_path;
+    if (prev_level < (int)RGL.level_count) RGL.active_level_index = prev_level;
+    free(scene.items);
+    for (int i = 0; i < 3; i++) {
+        if (scene.textures[i].texture.slot_index != 0) RGL_UnloadTexture(scene.textures[i]);
+    }
+    return result_count;
+}
 
-        // Use the master drawing function to draw the character at the correct scaled size
-        RGL_DrawSpritePro(
-            glyph_sprite,
-            (vec3){(float)x, (float)y, 0.0f},
-            char_size,
-            (vec2){0.0f, 0.0f}, // Top-left origin
-            (vec3){0.0f, 0.0f, 0.0f}, // No rotation
-            (vec2){0.0f, 0.0f}, // No skew
-            colors,
-            NULL
-        );
-        x += char_size[0];
+/**
+ * @brief Formats benchmark results as a fixed-width text table, one row per result.
+ * @param buf Destination, or NULL with buf_size 0 to measure.
+ * @return The length of the full report excluding the terminator; it was truncated if this is >= buf_size.
+ */
+SITAPI size_t RGL_FormatBenchmarkReport(const RGLBenchmarkResult* results, int count, char* buf, size_t buf_size) {
+    size_t length = 0;
+    if (buf && buf_size > 0) buf[0] = '\0';
+    _RGL_TraceAppend(buf, buf_size, &length, "%-8s %7s %9s %10s %9s %8s %8s %10s\n",
+                     "scene", "variant", "cmds", "ns/cmd", "cpu ms", "flushes", "draws", "KB up");
+    for (int i = 0; results && i < count; i++) {
+        const RGLBenchmarkResult* r = &results[i];
+        const char* name = (r->scenario >= 0 && r->scenario < RGL_BENCHMARK_COUNT) ? g_rgl_benchmark_names[r->scenario] : "?";
+        _RGL_TraceAppend(buf, buf_size, &length, "%-8s %7d %9.0f %10.1f %9.3f %8.1f %8.1f %10.1f\n",
+                         name, r->variant, r->commands, r->ns_per_command, r->cpu_ms, r->flushes, r->draw_calls, r->bytes_uploaded / 1024.0);
     }
+    return length;
 }
+#endif // RGL_ENABLE_BENCHMARKS
 
 /**
  * @brief Draws a real-time performance overlay with detailed rendering statistics.
@@ -7796,7 +15245,7 @@ SITAPI void RGL_DrawPerformanceOverlay(void) {
     const int PADDING = 10;
     const int LINE_HEIGHT = FONT_SIZE + 4;
     const int PANEL_WIDTH = 280;
-    const int PANEL_HEIGHT = 160;
+    int panel_height = 178;
     const int START_X = PADDING;
     const int START_Y = PADDING;
     Color text_color = {220, 220, 220, 255}; // Light gray
@@ -7805,8 +15254,33 @@ SITAPI void RGL_DrawPerformanceOverlay(void) {
     Color bad_color = {255, 100, 100, 255}; // Red
     char buffer[128];
 
+    // Profiled zones: the newest frame whose GPU times have come back, summed per top-level zone name.
+    const RGLFrameProfile* profile = NULL;
+    const char* zone_names[8];
+    float zone_cpu_ms[8], zone_gpu_ms[8];
+    int zone_rows = 0;
+    for (int ago = 0; ago < RGL_GetProfileFrameCount() && ago <= RGL_PROFILE_GPU_LATENCY; ago++) {
+        profile = &RGL.profiler.frames[(RGL.profiler.frame_counter - 1 - (uint64_t)ago) % RGL_PROFILE_FRAME_HISTORY];
+        if (profile->gpu_resolved) break;
+    }
+    for (int i = 0; profile && i < profile->zone_count; i++) {
+        const RGLProfileZone* zone = &profile->zones[i];
+        if (zone->depth > 1) continue;
+        int row = 0;
+        while (row < zone_rows && strcmp(zone_names[row], zone->name) != 0) row++;
+        if (row == zone_rows) {
+            if (zone_rows == 8) continue;
+            zone_names[row] = zone->name;
+            zone_cpu_ms[row] = zone_gpu_ms[row] = 0.0f;
+            zone_rows++;
+        }
+        zone_cpu_ms[row] += zone->cpu_ms;
+        if (zone->gpu_ms > 0.0f) zone_gpu_ms[row] += zone->gpu_ms;
+    }
+    if (profile) panel_height += (zone_rows + 1) * LINE_HEIGHT;
+
     // --- 4. Draw Background Panel ---
-    RGL_DrawRectangle((SitRectangle){(float)START_X, (float)START_Y, (float)PANEL_WIDTH, (float)PANEL_HEIGHT}, 0.0f, (Color){20, 20, 20, 200});
+    RGL_DrawRectangle((SitRectangle){(float)START_X, (float)START_Y, (float)PANEL_WIDTH, (float)panel_height}, 0.0f, (Color){20, 20, 20, 200});
 
     // --- 5. Render Statistics Text ---
     int current_y = START_Y + PADDING;
@@ -7846,7 +15320,7 @@ SITAPI void RGL_DrawPerformanceOverlay(void) {
 
     // --- Memory Usage ---
     float cmd_mem_kb = (RGL.command_capacity * sizeof(RGLInternalDraw)) / 1024.0f;
-    float vbo_mem_kb = (RGL.cpu_vertex_buffer_floats_capacity * sizeof(float)) / 1024.0f;
+    float vbo_mem_kb = (RGL.batch_vertex_capacity * sizeof(RGLBatchVertex)) / 1024.0f;
     snprintf(buffer, sizeof(buffer), "Buffer Mem: %.1f KB", cmd_mem_kb + vbo_mem_kb);
     _RGL_DrawDebugText(buffer, START_X + PADDING, current_y, FONT_SIZE, text_color);
     current_y += LINE_HEIGHT;
@@ -7861,6 +15335,21 @@ SITAPI void RGL_DrawPerformanceOverlay(void) {
     current_y += LINE_HEIGHT;
     snprintf(buffer, sizeof(buffer), "Stencil Shad: %d", RGL.stats.stencil_volumes_drawn);
     _RGL_DrawDebugText(buffer, START_X + PADDING, current_y, FONT_SIZE, text_color);
+    current_y += LINE_HEIGHT;
+    snprintf(buffer, sizeof(buffer), "Frame Arena: %.1f / %.1f KB", RGL.stats.frame_arena_used / 1024.0f, RGL.stats.frame_arena_high_water / 1024.0f);
+    _RGL_DrawDebugText(buffer, START_X + PADDING, current_y, FONT_SIZE, RGL.stats.frame_arena_high_water > RGL.frame_arena.capacity ? warn_color : text_color);
+
+    // --- Profiled Zones (CPU / GPU ms) ---
+    if (profile) {
+        current_y += LINE_HEIGHT;
+        snprintf(buffer, sizeof(buffer), "Profile CPU %.2f GPU %.2f", profile->cpu_ms, profile->gpu_ms);
+        _RGL_DrawDebugText(buffer, START_X + PADDING, current_y, FONT_SIZE, profile->dropped_zones > 0 ? warn_color : text_color);
+        for (int row = 0; row < zone_rows; row++) {
+            current_y += LINE_HEIGHT;
+            snprintf(buffer, sizeof(buffer), " %-16.16s %.2f / %.2f", zone_names[row], zone_cpu_ms[row], zone_gpu_ms[row]);
+            _RGL_DrawDebugText(buffer, START_X + PADDING, current_y, FONT_SIZE, text_color);
+        }
+    }
 
     // --- 6. Reset Per-Frame Stats and Increment Frame Counter ---
     // Only reset stats every frame to show the data for the *previous* complete frame.
@@ -7875,6 +15364,7 @@ SITAPI void RGL_DrawPerformanceOverlay(void) {
 
 SITAPI void RGL_DrawShadowVolumeDebug(vec3 world_pos, vec2 size, const RGLShadowConfig* config) {
     if (!RGL.is_batching || !config) return;
+    if (!_RGL_InitDebugRendering()) return;
 
     // ... (copy the entire "Find the Light Source" block from RGL_DrawSpriteWithShadow) ...
     RGLLight* light = &RGL.lights[config->light_id -1]; // Simplified
@@ -7922,9 +15412,9 @@ SITAPI void RGL_DrawShadowVolumeDebug(vec3 world_pos, vec2 size, const RGLShadow
         glm_vec3_add(caster_verts[i], dir, extruded_verts[i]);
     }
 
-    // -- Part C: Build the final, closed volume mesh (12 triangles)
+    // -- Part C: Build the volume mesh (10 triangles: four sides and the back cap)
     // The winding order (CW/CCW) is critical for the front/back stencil ops to work.
-    vec3 volume_mesh[36];
+    vec3 volume_mesh[30];
 
     // Helper macro to copy vertices
     #define V(idx, src) glm_vec3_copy(src, volume_mesh[idx])
@@ -7963,17 +15453,15 @@ SITAPI void RGL_DrawShadowVolumeDebug(vec3 world_pos, vec2 size, const RGLShadow
     vec4 norm_color; SituationConvertColorToVec4((Color){255,0,255,255}, norm_color);
     glUniform4fv(RGL.debug.wireframe_color_loc, 1, norm_color);
 
-    glBindVertexArray(RGL.batch_vao);
-    glBindBuffer(GL_ARRAY_BUFFER, RGL.batch_vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(volume_mesh), volume_mesh, GL_DYNAMIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-    glEnableVertexAttribArray(0);
-    glDisableVertexAttribArray(1);
+    // The wireframe VAO already has the tightly packed vec3 layout; the batch buffers are never touched.
+    glBindVertexArray(RGL.debug.wireframe_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, RGL.debug.wireframe_vbo);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(volume_mesh), volume_mesh);
 
     glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); // RENDER AS WIREFRAME
-    glDrawArrays(GL_TRIANGLES, 0, 36);
+    glDrawArrays(GL_TRIANGLES, 0, 30);
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL); // Restore fill mode
+    glBindVertexArray(0);
 
     // --- Final Cleanup ---
     glEnable(GL_CULL_FACE);
@@ -7995,9 +15483,202 @@ SITAPI RGLTexture RGL_LoadTexture(const char* filename, bool generate_mipmaps) {
 }
 
 SITAPI void RGL_UnloadTexture(RGLTexture texture) {
+    _RGL_ReleaseBindlessTexture(texture.texture.slot_index);
     SituationDestroyTexture(&texture.texture);
 }
 
+/**
+ * @brief Flags a texture as fully opaque (or not) for the batcher's opaque pass.
+ * Draws that use an opaque texture with fully opaque vertex colors are sorted by texture and
+ * front-to-back and rendered with blending off, which restores early-Z rejection for road
+ * surfaces, walls and cube faces. Leave this off for textures with any translucent or
+ * cut-out texels; those must stay in the back-to-front alpha pass.
+ * @note RGLSprite copies the RGLTexture by value, so set this before building sprites from it.
+ * @param texture The texture to modify.
+ * @param is_opaque True if the texture has no translucent texels.
+ */
+SITAPI void RGL_SetTextureOpaque(RGLTexture* texture, bool is_opaque) {
+    if (!texture) return;
+    texture->is_opaque = is_opaque;
+}
+
+/**
+ * @brief (INTERNAL) Reserves a rectangle on an atlas page, shelf by shelf.
+ * Images are placed left to right on the current shelf; one that does not fit starts a new shelf
+ * below the tallest image so far.
+ */
+static bool _RGL_AtlasPageAllocate(RGLAtlasPage* page, int width, int height, int* out_x, int* out_y) {
+    const int page_size = RGL_TEXTURE_ATLAS_PAGE_SIZE;
+    if (width > page_size || height > page_size) return false;
+
+    if (page->shelf_x + width > page_size) {
+        page->shelf_y += page->shelf_height;
+        page->shelf_x = 0;
+        page->shelf_height = 0;
+    }
+    if (page->shelf_y + height > page_size) return false;
+
+    *out_x = page->shelf_x;
+    *out_y = page->shelf_y;
+    page->shelf_x += width;
+    if (height > page->shelf_height) page->shelf_height = height;
+    return true;
+}
+
+/**
+ * @brief (INTERNAL) Appends an empty RGBA8 atlas page.
+ */
+static RGLAtlasPage* _RGL_AddAtlasPage(void) {
+    if (RGL.atlas.page_count >= RGL.atlas.page_capacity) {
+        size_t new_capacity = RGL.atlas.page_capacity == 0 ? 4 : RGL.atlas.page_capacity * 2;
+        RGLAtlasPage* new_pages = realloc(RGL.atlas.pages, sizeof(RGLAtlasPage) * new_capacity);
+        if (!new_pages) {
+            _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to grow sprite atlas page list");
+            return NULL;
+        }
+        RGL.atlas.pages = new_pages;
+        RGL.atlas.page_capacity = new_capacity;
+    }
+
+    GLuint texture_id;
+    glGenTextures(1, &texture_id);
+    glBindTexture(GL_TEXTURE_2D, texture_id);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, RGL_TEXTURE_ATLAS_PAGE_SIZE, RGL_TEXTURE_ATLAS_PAGE_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    RGLAtlasPage* page = &RGL.atlas.pages[RGL.atlas.page_count++];
+    memset(page, 0, sizeof(*page));
+    page->texture.texture.slot_index = texture_id;
+    page->texture.texture.width = RGL_TEXTURE_ATLAS_PAGE_SIZE;
+    page->texture.texture.height = RGL_TEXTURE_ATLAS_PAGE_SIZE;
+    page->texture.virtual_display_id = -1;
+    return page;
+}
+
+/**
+ * @brief Packs a CPU image into the shared sprite atlas.
+ *
+ * Sprites that live on the same atlas page share one texture, so they batch together even
+ * without bindless texture support. Each image gets a border of repeated edge texels
+ * (RGL_TEXTURE_ATLAS_PADDING) so bilinear filtering never reads a neighbour.
+ * @note Atlas sprites clamp at their edges; keep tiled textures (UVs outside 0-1) as standalone textures.
+ * @param image An RGBA, RGB, grey+alpha or grey image. It is not modified or freed.
+ * @return A sprite whose texture is the atlas page and whose source_rect is the packed image.
+ *         Images larger than RGL_TEXTURE_ATLAS_MAX_IMAGE get a texture of their own instead.
+ */
+SITAPI RGLSprite RGL_AddImageToAtlas(SituationImage image) {
+    RGLSprite sprite = {0};
+    sprite.texture.virtual_display_id = -1;
+    if (!image.data || image.width <= 0 || image.height <= 0 || image.channels < 1 || image.channels > 4) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_INVALID_PARAM, "Invalid image for sprite atlas");
+        return sprite;
+    }
+
+    // 1. --- Oversized images stay standalone ---
+    if (image.width > RGL_TEXTURE_ATLAS_MAX_IMAGE || image.height > RGL_TEXTURE_ATLAS_MAX_IMAGE) {
+        if (SituationCreateTexture(image, false, &sprite.texture.texture) == SITUATION_SUCCESS) {
+            sprite.source_rect = (SitRectangle){0.0f, 0.0f, (float)image.width, (float)image.height};
+        }
+        return sprite;
+    }
+
+    // 2. --- Find room on an existing page, or open a new one ---
+    const int pad = RGL_TEXTURE_ATLAS_PADDING;
+    const int padded_w = image.width + pad * 2;
+    const int padded_h = image.height + pad * 2;
+    RGLAtlasPage* page = NULL;
+    int x = 0, y = 0;
+    for (size_t i = 0; i < RGL.atlas.page_count && !page; i++) {
+        if (_RGL_AtlasPageAllocate(&RGL.atlas.pages[i], padded_w, padded_h, &x, &y)) page = &RGL.atlas.pages[i];
+    }
+    if (!page) {
+        page = _RGL_AddAtlasPage();
+        if (!page || !_RGL_AtlasPageAllocate(page, padded_w, padded_h, &x, &y)) return sprite;
+    }
+
+    // 3. --- Expand to RGBA with an extruded border and upload ---
+    unsigned char* pixels = (unsigned char*)malloc((size_t)padded_w * padded_h * 4);
+    if (!pixels) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate sprite atlas upload buffer");
+        return sprite;
+    }
+    const unsigned char* src = (const unsigned char*)image.data;
+    for (int py = 0; py < padded_h; py++) {
+        int sy = py - pad;
+        sy = sy < 0 ? 0 : (sy >= image.height ? image.height - 1 : sy);
+        for (int px = 0; px < padded_w; px++) {
+            int sx = px - pad;
+            sx = sx < 0 ? 0 : (sx >= image.width ? image.width - 1 : sx);
+            const unsigned char* in = src + ((size_t)sy * image.width + sx) * image.channels;
+            unsigned char* out = pixels + ((size_t)py * padded_w + px) * 4;
+            switch (image.channels) {
+                case 1: out[0] = out[1] = out[2] = in[0]; out[3] = 255; break;
+                case 2: out[0] = out[1] = out[2] = in[0]; out[3] = in[1]; break;
+                case 3: out[0] = in[0]; out[1] = in[1]; out[2] = in[2]; out[3] = 255; break;
+                default: memcpy(out, in, 4); break;
+            }
+        }
+    }
+
+    glBindTexture(GL_TEXTURE_2D, page->texture.texture.slot_index);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, padded_w, padded_h, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    free(pixels);
+
+    sprite.texture = page->texture;
+    sprite.source_rect = (SitRectangle){(float)(x + pad), (float)(y + pad), (float)image.width, (float)image.height};
+    return sprite;
+}
+
+/**
+ * @brief Loads an image file into the shared sprite atlas.
+ * @see RGL_AddImageToAtlas
+ */
+SITAPI RGLSprite RGL_LoadSpriteIntoAtlas(const char* filename) {
+    RGLSprite sprite = {0};
+    sprite.texture.virtual_display_id = -1;
+    SituationImage image = {0};
+    if (SituationLoadImage(filename, &image) != SITUATION_SUCCESS) return sprite;
+    sprite = RGL_AddImageToAtlas(image);
+    SituationUnloadImage(image);
+    return sprite;
+}
+
+/**
+ * @brief Maps a rectangle given in the original image's pixels to its place on the atlas page.
+ * Use it to cut frames out of a sprite sheet that was packed with RGL_AddImageToAtlas.
+ * @param atlas_sprite The sprite returned when the image was packed.
+ * @param local_rect The rectangle relative to the top-left of the original image.
+ */
+SITAPI SitRectangle RGL_GetAtlasSubRect(RGLSprite atlas_sprite, SitRectangle local_rect) {
+    return (SitRectangle){
+        atlas_sprite.source_rect.x + local_rect.x,
+        atlas_sprite.source_rect.y + local_rect.y,
+        local_rect.width,
+        local_rect.height
+    };
+}
+
+/**
+ * @brief Frees every sprite atlas page. Sprites packed into them become invalid.
+ * Also done by RGL_Shutdown.
+ */
+SITAPI void RGL_UnloadSpriteAtlas(void) {
+    for (size_t i = 0; i < RGL.atlas.page_count; i++) {
+        GLuint texture_id = RGL.atlas.pages[i].texture.texture.slot_index;
+        _RGL_ReleaseBindlessTexture(texture_id);
+        glDeleteTextures(1, &texture_id);
+    }
+    free(RGL.atlas.pages);
+    memset(&RGL.atlas, 0, sizeof(RGL.atlas));
+}
+
 /**
  * @brief Linearly interpolates between two float values.
  * @param a The starting value.
@@ -8913,48 +16594,339 @@ SITAPI RGLBitmapFont RGL_CreateVGA8x8FontWithOutline(const unsigned char* font_d
     return RGL_CreatePackedBitmapFont(font_data, &config);
 }
 
+// --- Bitmap Font Text Runs ---
+
+static void _RGL_MakeTextLayoutKey(const RGLBitmapFont* font, float box_width, float box_height, bool word_wrap, RGLTextLayoutKey* out_key) {
+    memset(out_key, 0, sizeof(*out_key)); // Padding must be zero; the key is hashed and compared as bytes
+    out_key->atlas_slot = font->atlas_texture.texture.slot_index;
+    out_key->atlas_width = font->atlas_texture.texture.width;
+    out_key->atlas_height = font->atlas_texture.texture.height;
+    out_key->char_width = font->char_width;
+    out_key->char_height = font->char_height;
+    out_key->chars_per_row = font->chars_per_row;
+    out_key->first_char = font->first_char;
+    out_key->char_count = font->char_count;
+    out_key->char_spacing = font->char_spacing;
+    out_key->line_spacing = font->line_spacing;
+    out_key->box_width = box_width;
+    out_key->box_height = box_height;
+    out_key->word_wrap = word_wrap;
+}
+
+static uint64_t _RGL_HashTextLayout(const char* text, size_t length, const RGLTextLayoutKey* key) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (unsigned char)text[i]) * 1099511628211ULL;
+    }
+    const unsigned char* key_bytes = (const unsigned char*)key;
+    for (size_t i = 0; i < sizeof(*key); i++) {
+        hash = (hash ^ key_bytes[i]) * 1099511628211ULL;
+    }
+    return hash ? hash : 1; // 0 marks an empty cache slot
+}
+
+static bool _RGL_ReserveGlyphQuads(RGLTextRun* run, size_t capacity) {
+    if (capacity <= run->quad_capacity) return true;
+    size_t new_capacity = run->quad_capacity ? run->quad_capacity : 32;
+    while (new_capacity < capacity) new_capacity *= 2;
+    RGLGlyphQuad* new_quads = realloc(run->quads, sizeof(RGLGlyphQuad) * new_capacity);
+    if (!new_quads) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to grow text run glyph buffer");
+        return false;
+    }
+    run->quads = new_quads;
+    run->quad_capacity = new_capacity;
+    return true;
+}
+
 /**
- * @brief Draws text using a bitmap font
+ * @brief (INTERNAL) Lays a string out into glyph quads relative to the run origin.
+ * Unbounded layouts follow RGL_DrawText (unknown characters fall back to '?'); keys with a
+ * clip box follow RGL_DrawTextBoxed (unknown characters are skipped, glyphs outside the box
+ * are dropped). The run's width/height are set to the size of the laid-out text.
  */
-SITAPI void RGL_DrawText(const char* text, vec2 position, RGLBitmapFont font, Color color) {
-    if (!text || font.atlas_texture.texture.slot_index == 0) return;
+static bool _RGL_LayoutTextRun(RGLTextRun* run, const char* text) {
+    const RGLTextLayoutKey* key = &run->key;
+    run->quad_count = 0;
+    run->width = 0.0f;
+    run->height = 0.0f;
+    if (key->chars_per_row <= 0 || key->char_count <= 0) return false;
 
-    vec2 cursor = {position[0], position[1]};
+    // 1. --- Reserve once: a run never has more glyphs than characters ---
+    if (!_RGL_ReserveGlyphQuads(run, run->text_length)) return false;
+
+    const float advance = key->char_width + key->char_spacing;
+    const float line_advance = key->char_height + key->line_spacing;
+    const bool boxed = key->box_width > 0.0f || key->box_height > 0.0f;
+
+    int fallback_index = '?' - key->first_char;
+    if (fallback_index < 0 || fallback_index >= key->char_count) fallback_index = 0;
+
+    float cursor_x = 0.0f, cursor_y = 0.0f;
+    float max_width = 0.0f;
+    int line_count = 1;
+
+    // State for word wrapping (boxed layouts only).
+    float word_x = 0.0f, word_y = 0.0f;
+    const char* word_ptr = text;
+    size_t word_quad = 0;
 
     for (const char* c = text; *c != '\0'; c++) {
+        // 2. --- Line breaks ---
         if (*c == '\n') {
-            cursor[0] = position[0];
-            cursor[1] += font.char_height + font.line_spacing;
+            max_width = fmaxf(max_width, cursor_x);
+            cursor_x = 0.0f;
+            cursor_y += line_advance;
+            line_count++;
+            if (boxed) {
+                if (cursor_y + key->char_height > key->box_height) break; // Out of bounds
+                word_x = cursor_x; word_y = cursor_y;
+                word_ptr = c + 1;
+                word_quad = run->quad_count;
+            }
             continue;
         }
 
         if (*c == '\r') continue; // Skip carriage returns
 
-        // Calculate character index in atlas
-        int char_index = *c - font.first_char;
-        if (char_index < 0 || char_index >= font.char_count) {
-            char_index = '?' - font.first_char; // Fallback to '?'
-            if (char_index < 0 || char_index >= font.char_count) {
-                char_index = 0; // Fallback to first character
+        // 3. --- Word wrapping ---
+        if (boxed && key->word_wrap && cursor_x + key->char_width > key->box_width) {
+            // Wrap here for a space, the first letter of a word, or a word too long for a whole line.
+            if (*c == ' ' || word_ptr == c || word_x <= 0.0f) {
+                cursor_x = 0.0f;
+                cursor_y += line_advance;
+                if (cursor_y + key->char_height > key->box_height) break;
+                word_x = cursor_x; word_y = cursor_y;
+                word_quad = run->quad_count;
+                if (*c == ' ') {
+                    word_ptr = c + 1;
+                    continue; // The space is consumed by the line break
+                }
+                word_ptr = c;
+            } else {
+                // Move the whole word down: drop the glyphs it already placed and restart from its first letter.
+                cursor_x = 0.0f;
+                cursor_y = word_y + line_advance;
+                if (cursor_y + key->char_height > key->box_height) break;
+                run->quad_count = word_quad;
+                word_x = cursor_x; word_y = cursor_y;
+                c = word_ptr - 1;
+                continue;
             }
         }
 
-        // Calculate source rectangle in atlas
-        int atlas_x = (char_index % font.chars_per_row) * font.char_width;
-        int atlas_y = (char_index / font.chars_per_row) * font.char_height;
+        // Remember where the next word starts
+        const bool word_boundary = boxed && *c == ' ';
+        if (word_boundary) {
+            word_x = cursor_x + advance;
+            word_y = cursor_y;
+            word_ptr = c + 1;
+        }
 
-        SitRectangle source_rect = {
-            (float)atlas_x, (float)atlas_y,
-            (float)font.char_width, (float)font.char_height
-        };
+        // 4. --- Resolve the glyph and place its quad ---
+        int char_index = *c - key->first_char;
+        bool visible = true;
+        if (char_index < 0 || char_index >= key->char_count) {
+            char_index = fallback_index;
+            visible = !boxed; // Boxed text skips unknown characters
+        }
+        if (boxed && (cursor_x < 0.0f || cursor_x + key->char_width > key->box_width ||
+                      cursor_y < 0.0f || cursor_y + key->char_height > key->box_height)) {
+            visible = false;
+        }
 
-        // Create sprite and draw
-        RGLSprite char_sprite = {font.atlas_texture, source_rect};
-        RGL_DrawSprite(char_sprite, cursor, 0.0f, 1.0f, color);
+        if (visible) {
+            RGLGlyphQuad* quad = &run->quads[run->quad_count++];
+            float atlas_x = (float)((char_index % key->chars_per_row) * key->char_width);
+            float atlas_y = (float)((char_index / key->chars_per_row) * key->char_height);
+            quad->offset[0] = cursor_x;
+            quad->offset[1] = cursor_y;
+            if (key->atlas_width > 0 && key->atlas_height > 0) {
+                quad->uv_min[0] = atlas_x / key->atlas_width;
+                quad->uv_min[1] = atlas_y / key->atlas_height;
+                quad->uv_max[0] = (atlas_x + key->char_width) / key->atlas_width;
+                quad->uv_max[1] = (atlas_y + key->char_height) / key->atlas_height;
+            } else {
+                quad->uv_min[0] = quad->uv_min[1] = 0.0f;
+                quad->uv_max[0] = quad->uv_max[1] = 1.0f;
+            }
+        }
+        if (word_boundary) word_quad = run->quad_count; // The next word's glyphs start here
 
-        // Advance cursor
-        cursor[0] += font.char_width + font.char_spacing;
+        cursor_x += advance;
+    }
+
+    // 5. --- Measure ---
+    max_width = fmaxf(max_width, cursor_x);
+    if (boxed) {
+        // The extent of the glyphs that were actually placed.
+        for (size_t i = 0; i < run->quad_count; i++) {
+            run->width = fmaxf(run->width, run->quads[i].offset[0] + key->char_width);
+            run->height = fmaxf(run->height, run->quads[i].offset[1] + key->char_height);
+        }
+    } else {
+        run->width = max_width - key->char_spacing; // Remove trailing spacing
+        run->height = (float)(line_count * key->char_height + (line_count - 1) * key->line_spacing);
+    }
+    return true;
+}
+
+/**
+ * @brief (INTERNAL) Finds the cached layout of a string, laying it out on a miss.
+ * The cache is a fixed table probed over a short window from the hash; a miss replaces the
+ * least recently used slot of that window, so strings that stop being drawn age out on their own.
+ * Only the render thread may call this.
+ */
+static RGLTextRun* _RGL_GetTextRun(const char* text, const RGLTextLayoutKey* key) {
+    size_t length = strlen(text);
+    uint64_t hash = _RGL_HashTextLayout(text, length, key);
+    RGL.text_run_clock++;
+
+    // 1. --- Probe for a hit, remembering the stalest slot ---
+    size_t base = (size_t)hash & (RGL_TEXT_RUN_CACHE_SIZE - 1);
+    RGLTextRun* victim = NULL;
+    for (size_t p = 0; p < RGL_TEXT_RUN_PROBE_LENGTH; p++) {
+        RGLTextRun* run = &RGL.text_runs[(base + p) & (RGL_TEXT_RUN_CACHE_SIZE - 1)];
+        if (run->hash == hash && run->text_length == length &&
+            memcmp(&run->key, key, sizeof(*key)) == 0 && memcmp(run->text, text, length) == 0) {
+            run->last_used = RGL.text_run_clock;
+            return run;
+        }
+        if (!victim || run->last_used < victim->last_used) victim = run; // Empty slots have last_used 0
+    }
+
+    // 2. --- Miss: lay the string out into the replaced slot, reusing its buffers ---
+    char* text_copy = realloc(victim->text, length + 1);
+    if (!text_copy) {
+        _SituationSetErrorFromCode(SITUATION_ERROR_MEMORY_ALLOCATION, "Failed to allocate text run");
+        _RGL_FreeTextRun(victim);
+        return NULL;
+    }
+    memcpy(text_copy, text, length + 1);
+    victim->text = text_copy;
+    victim->text_length = length;
+    memcpy(&victim->key, key, sizeof(*key)); // Keep the zeroed padding the lookup compares
+    if (!_RGL_LayoutTextRun(victim, text)) {
+        _RGL_FreeTextRun(victim);
+        return NULL;
+    }
+    victim->hash = hash;
+    victim->last_used = RGL.text_run_clock;
+    RGL.stats.text_runs_built++;
+    return victim;
+}
+
+static void _RGL_FreeTextRun(RGLTextRun* run) {
+    free(run->text);
+    free(run->quads);
+    memset(run, 0, sizeof(*run));
+}
+
+/**
+ * @brief (INTERNAL) Emits a laid-out run into the command buffer.
+ * Capacity is reserved for the whole run (in the largest chunks the batch allows) and every
+ * glyph is written in place, skipping the per-glyph matrix setup of RGL_DrawSpritePro.
+ * The result matches drawing each glyph with RGL_DrawSprite, including RGL_SetTransform.
+ */
+static void _RGL_EmitTextRun(const RGLTextRun* run, RGLTexture atlas, float x, float y, Color color) {
+    if (!RGL.is_initialized || !RGL.is_batching || run->quad_count == 0) return;
+
+    // 1. --- Per-run constants ---
+    vec4 tint;
+    SituationConvertColorToVec4(color, tint);
+
+    mat4 model_matrix;
+    glm_mat4_identity(model_matrix);
+    glm_translate(model_matrix, (vec3){x, y, 0.0f});
+
+    vec3 normal = {0.0f, 0.0f, 1.0f};
+    if (RGL.use_transform) {
+        glm_mat4_mul(RGL.transform, model_matrix, model_matrix);
+        mat4 global_rot_only;
+        glm_mat4_copy(RGL.transform, global_rot_only);
+        global_rot_only[3][0] = global_rot_only[3][1] = global_rot_only[3][2] = 0.0f;
+        glm_mat4_mulv3(global_rot_only, (vec3){0.0f, 0.0f, 1.0f}, 0.0f, normal);
+        glm_vec3_normalize(normal);
+    }
+
+    const float glyph_w = (float)run->key.char_width;
+    const float glyph_h = (float)run->key.char_height;
+
+    // 2. --- Reserve and write the glyph commands ---
+    size_t emitted = 0;
+    while (emitted < run->quad_count) {
+        size_t chunk = run->quad_count - emitted;
+        if (chunk > RGL_DEFAULT_BATCH_CAPACITY) chunk = RGL_DEFAULT_BATCH_CAPACITY;
+        if (!_RGL_EnsureCommandCapacity(chunk)) return;
+
+        for (size_t i = 0; i < chunk; i++) {
+            const RGLGlyphQuad* quad = &run->quads[emitted + i];
+            RGLInternalDraw* cmd = _RGL_PeekCommand();
+
+            const float x0 = quad->offset[0], y0 = quad->offset[1];
+            const float x1 = x0 + glyph_w, y1 = y0 + glyph_h;
+            // TL, BL, BR, TR, as the batcher expects.
+            vec3 local_verts[4] = {{x0, y0, 0.0f}, {x0, y1, 0.0f}, {x1, y1, 0.0f}, {x1, y0, 0.0f}};
+            vec2 uvs[4] = {
+                {quad->uv_min[0], quad->uv_min[1]}, {quad->uv_min[0], quad->uv_max[1]},
+                {quad->uv_max[0], quad->uv_max[1]}, {quad->uv_max[0], quad->uv_min[1]}
+            };
+
+            cmd->texture = atlas;
+            cmd->z_depth = 0.0f;
+            cmd->is_triangle = false;
+            for (int v = 0; v < 4; v++) {
+                glm_mat4_mulv3(model_matrix, local_verts[v], 1.0f, cmd->world_positions[v]);
+                glm_vec3_copy(normal, cmd->normals[v]);
+                glm_vec2_copy(uvs[v], cmd->tex_coords[v]);
+                glm_vec4_copy(tint, cmd->colors[v]);
+                cmd->light_levels[v] = 1.0f;
+            }
+            _RGL_CommitCommand();
+        }
+        emitted += chunk;
+    }
+}
+
+static void _RGL_DrawTextLayout(const char* text, const RGLTextLayoutKey* key, RGLTexture atlas, float x, float y, Color color) {
+    if (!g_rgl_recording_list) {
+        const RGLTextRun* run = _RGL_GetTextRun(text, key);
+        if (run) _RGL_EmitTextRun(run, atlas, x, y, color);
+        return;
+    }
+
+    // Worker threads must not touch the shared cache; lay out into a throwaway run instead.
+    RGLTextRun run = {0};
+    memcpy(&run.key, key, sizeof(*key));
+    run.text_length = strlen(text);
+    if (_RGL_LayoutTextRun(&run, text)) _RGL_EmitTextRun(&run, atlas, x, y, color);
+    free(run.quads);
+}
+
+/**
+ * @brief Frees every cached text layout.
+ * Layouts are also replaced automatically as new strings are drawn; call this after a burst of
+ * one-off strings (e.g. a log dump) to return the memory, or when reloading fonts.
+ */
+SITAPI void RGL_ClearTextRunCache(void) {
+    for (size_t i = 0; i < RGL_TEXT_RUN_CACHE_SIZE; i++) {
+        _RGL_FreeTextRun(&RGL.text_runs[i]);
     }
+    RGL.text_run_clock = 0;
+}
+
+/**
+ * @brief Draws text using a bitmap font
+ *
+ * The string is laid out once into a cached glyph run keyed by its text and the font metrics;
+ * later calls with the same string only emit the cached quads.
+ */
+SITAPI void RGL_DrawText(const char* text, vec2 position, RGLBitmapFont font, Color color) {
+    if (!text || font.atlas_texture.texture.slot_index == 0) return;
+
+    RGLTextLayoutKey key;
+    _RGL_MakeTextLayoutKey(&font, 0.0f, 0.0f, false, &key);
+    _RGL_DrawTextLayout(text, &key, font.atlas_texture, position[0], position[1], color);
 }
 
 /**
@@ -9017,72 +16989,12 @@ SITAPI void RGL_DrawTextEx(const char* text, vec2 position, RGLBitmapFont font,
  */
 SITAPI void RGL_DrawTextBoxed(const char* text, SitRectangle bounds, RGLBitmapFont font, Color color, bool word_wrap) {
     if (!text || font.atlas_texture.texture.slot_index == 0) return;
+    if (bounds.width <= 0.0f || bounds.height <= 0.0f) return; // Nothing fits
 
-    vec2 cursor = {bounds.x, bounds.y};
-    vec2 word_start; glm_vec2_copy(cursor, word_start);
-    const char* word_start_ptr = text;
-
-    for (const char* c = text; *c != '\0'; c++) {
-        if (*c == '\n') {
-            cursor[0] = bounds.x;
-            cursor[1] += font.char_height + font.line_spacing;
-            if (cursor[1] + font.char_height > bounds.y + bounds.height) break; // Out of bounds
-            glm_vec2_copy(cursor, word_start);
-            word_start_ptr = c + 1;
-            continue;
-        }
-
-        if (*c == '\r') continue;
-
-        // Check if we need to wrap
-        if (word_wrap && cursor[0] + font.char_width > bounds.x + bounds.width) {
-            if (*c == ' ' || word_start_ptr == c) {
-                // Wrap at current position
-                cursor[0] = bounds.x;
-                cursor[1] += font.char_height + font.line_spacing;
-                if (cursor[1] + font.char_height > bounds.y + bounds.height) break;
-                glm_vec2_copy(cursor, word_start);
-                word_start_ptr = c + 1;
-                continue;
-            } else {
-                // Wrap at word boundary
-                glm_vec2_copy(word_start, cursor);
-                cursor[1] += font.char_height + font.line_spacing;
-                if (cursor[1] + font.char_height > bounds.y + bounds.height) break;
-                c = word_start_ptr - 1; // Restart from word beginning
-                glm_vec2_copy(cursor, word_start);
-                continue;
-            }
-        }
-
-        // Path word boundaries
-        if (*c == ' ') {
-            glm_vec2_copy(cursor, word_start);
-            word_start[0] += font.char_width + font.char_spacing;
-            word_start_ptr = c + 1;
-        }
-
-        // Draw character if within bounds
-        if (cursor[0] >= bounds.x && cursor[0] + font.char_width <= bounds.x + bounds.width &&
-            cursor[1] >= bounds.y && cursor[1] + font.char_height <= bounds.y + bounds.height) {
-
-            int char_index = *c - font.first_char;
-            if (char_index >= 0 && char_index < font.char_count) {
-                int atlas_x = (char_index % font.chars_per_row) * font.char_width;
-                int atlas_y = (char_index / font.chars_per_row) * font.char_height;
-
-                SitRectangle source_rect = {
-                    (float)atlas_x, (float)atlas_y,
-                    (float)font.char_width, (float)font.char_height
-                };
-
-                RGLSprite char_sprite = {font.atlas_texture, source_rect};
-                RGL_DrawSprite(char_sprite, cursor, 0.0f, 1.0f, color);
-            }
-        }
-
-        cursor[0] += font.char_width + font.char_spacing;
-    }
+    // The layout depends only on the box size, so moving the box reuses the cached run.
+    RGLTextLayoutKey key;
+    _RGL_MakeTextLayoutKey(&font, bounds.width, bounds.height, word_wrap, &key);
+    _RGL_DrawTextLayout(text, &key, font.atlas_texture, bounds.x, bounds.y, color);
 }
 
 /**
@@ -9213,6 +17125,14 @@ SITAPI void RGL_DrawTextWave(const char* text, vec2 position, RGLBitmapFont font
 SITAPI Vector2 RGL_MeasureText(const char* text, RGLBitmapFont font) {
     if (!text) return (Vector2){0.0f, 0.0f};
 
+    // Share the layout RGL_DrawText builds for the same string, so measure-then-draw lays out once.
+    if (!g_rgl_recording_list && font.atlas_texture.texture.slot_index != 0) {
+        RGLTextLayoutKey key;
+        _RGL_MakeTextLayoutKey(&font, 0.0f, 0.0f, false, &key);
+        const RGLTextRun* run = _RGL_GetTextRun(text, &key);
+        if (run) return (Vector2){run->width, run->height};
+    }
+
     float max_width = 0;
     float current_width = 0;
     int line_count = 1;
@@ -9294,6 +17214,12 @@ SITAPI int RGL_GetTextLineCount(const char* text, RGLBitmapFont font, float max_
  */
 SITAPI void RGL_UnloadBitmapFont(RGLBitmapFont font) {
     if (font.atlas_texture.texture.slot_index > 0) {
+        // Drop this font's layouts; a later texture may reuse the slot.
+        for (size_t i = 0; i < RGL_TEXT_RUN_CACHE_SIZE; i++) {
+            if (RGL.text_runs[i].hash != 0 && RGL.text_runs[i].key.atlas_slot == font.atlas_texture.texture.slot_index) {
+                _RGL_FreeTextRun(&RGL.text_runs[i]);
+            }
+        }
         RGL_UnloadTexture(font.atlas_texture);
     }
 }
@@ -9388,8 +17314,7 @@ static void _RGL_DrawLineQuad(vec3 start, vec3 end, float thickness, Color color
     }
 
     // Create draw command
-    size_t cmd_idx = RGL.command_count++;
-    RGLInternalDraw* cmd = &RGL.commands[cmd_idx];
+    RGLInternalDraw* cmd = _RGL_PushCommand();
     cmd->texture.texture.slot_index = 0; // No texture
     vec2 tex_coords[4] = { {0,0}, {1,0}, {1,1}, {0,1} }; // Dummy UVs
     Color colors[4] = { color, color, color, color };